@@ -0,0 +1,55 @@
+/**
+ * @file Formatter.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/FormatBuffer.hpp>
+#include <E2D/Core/Formatter.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+TEST_CASE("Formatter Benchmarks", "[Formatter]")
+{
+    const std::string identifier = "Player";
+
+    BENCHMARK("Format without arguments")
+    {
+        return e2d::Formatter::format("Loading scene");
+    };
+
+    BENCHMARK("Format mixed arguments")
+    {
+        return e2d::Formatter::format("Object '{}' moved to ({}, {}) after {} ms", identifier, 12.5f, -3, 16.6);
+    };
+
+    BENCHMARK("Format mixed arguments to a buffer")
+    {
+        e2d::FormatBuffer buffer;
+        e2d::Formatter::formatTo(buffer, "Object '{}' moved to ({}, {}) after {} ms", identifier, 12.5f, -3, 16.6);
+        return buffer.getSize();
+    };
+}
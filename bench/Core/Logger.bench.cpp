@@ -0,0 +1,99 @@
+/**
+ * @file Logger.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/ConsoleLogSink.hpp>
+#include <E2D/Core/LogSink.hpp>
+#include <E2D/Core/Logger.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace
+{
+/**
+ * @brief Discards messages, so that only the cost of the logger itself is measured.
+ */
+class NullSink final : public e2d::LogSink
+{
+public:
+    void write(const e2d::LogMessage& message) override
+    {
+        this->m_size.fetch_add(message.text.size(), std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::size_t> m_size{0};
+};
+
+constexpr int MessageCount = 1000;
+} // namespace
+
+TEST_CASE("Logger Benchmarks", "[Logger]")
+{
+    const auto level = e2d::Logger::getLevel();
+    e2d::Logger::setLevel(e2d::E2D_LOG_LEVEL_INFO);
+    e2d::Logger::clearSinks();
+    e2d::Logger::addSink(std::make_shared<NullSink>());
+
+    const std::string identifier = "Player";
+
+    BENCHMARK("Log 1000 filtered messages")
+    {
+        for (int i = 0; i < MessageCount; ++i)
+        {
+            e2d::log::debug("Object '{}' moved to ({}, {})", identifier, i, 16.6);
+        }
+    };
+
+    BENCHMARK("Log 1000 messages synchronously")
+    {
+        for (int i = 0; i < MessageCount; ++i)
+        {
+            e2d::log::info("Object '{}' moved to ({}, {})", identifier, i, 16.6);
+        }
+    };
+
+    e2d::Logger::enableAsync(8192, e2d::Logger::OverflowPolicy::Block);
+
+    BENCHMARK("Log 1000 messages asynchronously")
+    {
+        for (int i = 0; i < MessageCount; ++i)
+        {
+            e2d::log::info("Object '{}' moved to ({}, {})", identifier, i, 16.6);
+        }
+        e2d::Logger::flush();
+    };
+
+    e2d::Logger::disableAsync();
+    e2d::Logger::clearSinks();
+    e2d::Logger::addSink(std::make_shared<e2d::ConsoleLogSink>());
+    e2d::Logger::setLevel(level);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file Rect.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Rect.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+TEST_CASE("Rect Benchmarks", "[Rect]")
+{
+    std::vector<e2d::FloatRect> rectangles;
+    rectangles.reserve(1000);
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        rectangles.emplace_back(e2d::Vector2f{static_cast<float>(i % 40) * 20.0f, static_cast<float>(i / 40) * 20.0f},
+                                e2d::Vector2f{32.0f, 32.0f});
+    }
+    const e2d::FloatRect viewport({100.0f, 100.0f}, {400.0f, 300.0f});
+
+    BENCHMARK("Contains point for 1000 rectangles")
+    {
+        std::size_t hits = 0;
+        for (const auto& rectangle : rectangles)
+        {
+            if (rectangle.contains(viewport.getCenter()))
+            {
+                ++hits;
+            }
+        }
+        return hits;
+    };
+
+    BENCHMARK("Intersect 1000 rectangles with a viewport")
+    {
+        std::size_t visible = 0;
+        for (const auto& rectangle : rectangles)
+        {
+            if (rectangle.findIntersection(viewport))
+            {
+                ++visible;
+            }
+        }
+        return visible;
+    };
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Vector2.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Vector2.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+TEST_CASE("Vector2 Benchmarks", "[Vector2]")
+{
+    std::vector<e2d::Vector2f> positions(10000);
+    std::vector<e2d::Vector2f> velocities(10000);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        positions[i]  = {static_cast<float>(i), static_cast<float>(i) * 0.5f};
+        velocities[i] = {1.0f, -2.0f};
+    }
+
+    BENCHMARK("Integrate 10000 positions")
+    {
+        const float deltaTime = 1.0f / 60.0f;
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            positions[i] += velocities[i] * deltaTime;
+        }
+        return positions.back();
+    };
+
+    BENCHMARK("Compare 10000 vectors")
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 1; i < positions.size(); ++i)
+        {
+            if (positions[i] == positions[i - 1])
+            {
+                ++equal;
+            }
+        }
+        return equal;
+    };
+}
@@ -0,0 +1,123 @@
+/**
+ * @file ObjectRegistry.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/Object.hpp>
+#include <E2D/Engine/ObjectRegistry.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace
+{
+class Enemy final : public e2d::Object
+{
+public:
+    explicit Enemy(const std::string& identifier) : e2d::Object(identifier)
+    {
+    }
+};
+
+class Pickup final : public e2d::Object
+{
+public:
+    explicit Pickup(const std::string& identifier) : e2d::Object(identifier)
+    {
+    }
+};
+
+std::vector<std::string> createIdentifiers(std::size_t count)
+{
+    std::vector<std::string> identifiers;
+    identifiers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        identifiers.push_back("Object" + std::to_string(i));
+    }
+    return identifiers;
+}
+} // namespace
+
+TEST_CASE("ObjectRegistry Benchmarks", "[ObjectRegistry]")
+{
+    // Objects log their lifetime at debug level, which would dominate the measurements in debug builds
+    const auto level = e2d::Logger::getLevel();
+    e2d::Logger::setLevel(e2d::E2D_LOG_LEVEL_WARN);
+
+    for (const std::size_t count : {1000U, 10000U})
+    {
+        const auto identifiers = createIdentifiers(count);
+
+        BENCHMARK("Create and remove " + std::to_string(count) + " objects")
+        {
+            e2d::ObjectRegistry objectRegistry;
+            for (const auto& identifier : identifiers)
+            {
+                objectRegistry.createObject<Enemy>(identifier);
+            }
+            for (const auto& identifier : identifiers)
+            {
+                objectRegistry.removeObject(identifier);
+            }
+            objectRegistry.clean();
+        };
+
+        e2d::ObjectRegistry objectRegistry;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i % 4 == 0)
+            {
+                objectRegistry.createObject<Pickup>(identifiers[i]);
+            }
+            else
+            {
+                objectRegistry.createObject<Enemy>(identifiers[i]);
+            }
+        }
+
+        BENCHMARK("Iterate " + std::to_string(count) + " objects")
+        {
+            std::size_t length = 0;
+            for (const auto* object : objectRegistry.getAllObjects())
+            {
+                length += object->getIdentifier().size();
+            }
+            return length;
+        };
+
+        BENCHMARK("Get objects of type among " + std::to_string(count) + " objects")
+        {
+            return objectRegistry.getAllObjectsOfType<Pickup>().size();
+        };
+    }
+
+    e2d::Logger::setLevel(level);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file RenderQueue.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderQueue.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+class BenchRenderable final : public e2d::Renderable
+{
+public:
+    void render() const final
+    {
+    }
+};
+} // namespace
+
+TEST_CASE("RenderQueue Benchmarks", "[RenderQueue]")
+{
+    std::mt19937 random(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    for (const std::size_t count : {1000U, 10000U, 100000U, 1000000U})
+    {
+        std::vector<BenchRenderable>       renderables(count);
+        std::uniform_int_distribution<int> priority(0, 100);
+        for (auto& renderable : renderables)
+        {
+            renderable.setRenderPriority(priority(random));
+        }
+
+        BENCHMARK("Push and pop " + std::to_string(count) + " renderables")
+        {
+            e2d::internal::RenderQueue renderQueue;
+            for (const auto& renderable : renderables)
+            {
+                renderQueue.push(&renderable);
+            }
+
+            const e2d::Renderable* last = nullptr;
+            while (!renderQueue.isEmpty())
+            {
+                last = renderQueue.pop();
+            }
+            return last;
+        };
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file Transformable.bench.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/Transformable.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+class BenchTransformable final : public e2d::Transformable
+{
+public:
+    e2d::Vector2f getSize() const final
+    {
+        return {32.0f, 48.0f};
+    }
+};
+} // namespace
+
+TEST_CASE("Transformable Benchmarks", "[Transformable]")
+{
+    std::vector<BenchTransformable> transformables(1000);
+    for (std::size_t i = 0; i < transformables.size(); ++i)
+    {
+        auto& transformable = transformables[i];
+        transformable.setPosition({static_cast<float>(i % 100) * 10.0f, static_cast<float>(i / 100) * 10.0f});
+        transformable.setOrigin({16.0f, 24.0f});
+        transformable.setScale({1.5f, 1.5f});
+    }
+
+    BENCHMARK("Global bounds of 1000 unrotated transformables")
+    {
+        float area = 0.0f;
+        for (const auto& transformable : transformables)
+        {
+            const auto bounds = transformable.getGlobalBounds();
+            area += bounds.width * bounds.height;
+        }
+        return area;
+    };
+
+    for (std::size_t i = 0; i < transformables.size(); ++i)
+    {
+        transformables[i].setRotation(static_cast<double>(i % 360));
+    }
+
+    BENCHMARK("Global bounds of 1000 rotated transformables")
+    {
+        float area = 0.0f;
+        for (const auto& transformable : transformables)
+        {
+            const auto bounds = transformable.getGlobalBounds();
+            area += bounds.width * bounds.height;
+        }
+        return area;
+    };
+}
@@ -175,6 +175,28 @@ macro(e2d_add_example target)
     endif()
 endmacro()
 
+# Makes Catch2 available to the test suite and the benchmarks, fetching it only once
+macro(e2d_fetch_catch2)
+    if(NOT TARGET Catch2)
+        include(FetchContent)
+
+        set(CATCH_CONFIG_FAST_COMPILE ON CACHE BOOL "")
+        FetchContent_Declare(Catch2
+                             GIT_REPOSITORY https://github.com/catchorg/Catch2.git
+                             GIT_TAG v3.7.1
+                             GIT_SHALLOW ON)
+        FetchContent_MakeAvailable(Catch2)
+
+        target_compile_features(Catch2 PRIVATE cxx_std_17)
+
+        set_target_properties(Catch2 PROPERTIES COMPILE_OPTIONS "" EXPORT_COMPILE_COMMANDS OFF)
+        set_target_properties(Catch2WithMain PROPERTIES EXPORT_COMPILE_COMMANDS OFF)
+        get_target_property(CATCH2_INCLUDE_DIRS Catch2 INTERFACE_INCLUDE_DIRECTORIES)
+        target_include_directories(Catch2 SYSTEM INTERFACE ${CATCH2_INCLUDE_DIRS})
+    endif()
+    include(Catch)
+endmacro()
+
 function(e2d_add_test target SOURCES DEPENDS)
     source_group("" FILES ${SOURCES})
 
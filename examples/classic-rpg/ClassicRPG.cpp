@@ -30,7 +30,7 @@
 
 #include <E2D/Engine/SceneManager.hpp>
 
-ClassicRPG::ClassicRPG() : e2d::Application("ClassicRPG")
+ClassicRPG::ClassicRPG(e2d::RenderMode renderMode) : e2d::Application("ClassicRPG", renderMode)
 {
 }
 
@@ -32,7 +32,7 @@
 class ClassicRPG final : public e2d::Application
 {
 public:
-    ClassicRPG();
+    explicit ClassicRPG(e2d::RenderMode renderMode = e2d::RenderMode::Windowed);
 
     ~ClassicRPG() final;
 
@@ -28,6 +28,9 @@
 
 #include "Player.hpp"
 
+#include <E2D/Engine/RenderLayer.hpp>
+#include <E2D/Engine/ResourceRegistry.hpp>
+
 GameScene::GameScene() : e2d::Scene("GameScene")
 {
 }
@@ -36,5 +39,10 @@ GameScene::~GameScene() = default;
 
 void GameScene::onLoad()
 {
-    this->createObject<Player>();
+    e2d::ResourceRegistry::getInstance().loadManifest("classic-rpg.manifest");
+
+    // Characters further down the screen are drawn in front, as the origin of their sprites is at their feet
+    auto& characters = this->createLayer("Characters");
+    characters.setSortMode(e2d::RenderLayer::SortMode::PositionY);
+    characters.add(this->createObject<Player>());
 }
@@ -46,7 +46,8 @@ Player::~Player() = default;
 
 void Player::onLoad()
 {
-    if (!e2d::ResourceRegistry::getInstance().loadFromFile<e2d::Texture>("Player", "classic-rpg-player.png"))
+    // The texture is loaded up front together with the other resources of the scene, see GameScene::onLoad
+    if (!e2d::ResourceRegistry::getInstance().exists<e2d::Texture>("Player"))
     {
         return;
     }
@@ -26,9 +26,39 @@
 
 #include "ClassicRPG.hpp"
 
-int main()
+#include <string_view>
+
+// Usage: e2d-example-classic-rpg [--headless] [--record <file>] [--replay <file>]
+int main(int argc, char* argv[])
 {
-    auto* application = new ClassicRPG();
+    auto        renderMode = e2d::RenderMode::Windowed;
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        if (argument == "--headless")
+        {
+            renderMode = e2d::RenderMode::Headless;
+        }
+        else if (argument == "--record" && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (argument == "--replay" && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+    }
+
+    auto* application = new ClassicRPG(renderMode);
+
+    if ((recordPath && !application->startRecording(recordPath)) ||
+        (replayPath && !application->startReplay(replayPath)))
+    {
+        delete application;
+        return 1;
+    }
 
     const auto exitCode = application->run();
 
@@ -0,0 +1,69 @@
+/**
+ * @file MovingSprite.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "MovingSprite.hpp"
+
+#include <E2D/Engine/ResourceRegistry.hpp>
+#include <E2D/Engine/Texture.hpp>
+
+#include <utility>
+
+const e2d::Vector2f screenSize = {800, 600};
+const e2d::IntRect  frameRect({0, 0}, {52, 72});
+
+MovingSprite::MovingSprite(std::string textureIdentifier, const e2d::Vector2f& position, const e2d::Vector2f& velocity) :
+m_textureIdentifier(std::move(textureIdentifier)),
+m_velocity(velocity)
+{
+    this->setPosition(position);
+}
+
+MovingSprite::~MovingSprite() = default;
+
+void MovingSprite::onLoad()
+{
+    // The textures are loaded up front together with the other resources of the scene, see StressScene::onLoad
+    if (!e2d::ResourceRegistry::getInstance().exists<e2d::Texture>(this->m_textureIdentifier))
+    {
+        return;
+    }
+    this->setTexture(e2d::ResourceRegistry::getInstance().get<e2d::Texture>(this->m_textureIdentifier));
+    this->setTextureRect(frameRect);
+}
+
+void MovingSprite::onVariableUpdate(double deltaTime)
+{
+    auto position = this->getPosition() + this->m_velocity * static_cast<float>(deltaTime);
+    if (position.x < 0 || position.x > screenSize.x)
+    {
+        this->m_velocity.x = -this->m_velocity.x;
+    }
+    if (position.y < 0 || position.y > screenSize.y)
+    {
+        this->m_velocity.y = -this->m_velocity.y;
+    }
+    this->setPosition(position);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file MovingSprite.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_EXAMPLE_STRESS_TEST_MOVING_SPRITE_HPP
+#define E2D_EXAMPLE_STRESS_TEST_MOVING_SPRITE_HPP
+
+#include <E2D/Engine/Sprite.hpp>
+
+#include <string>
+
+class MovingSprite final : public e2d::Sprite
+{
+public:
+    MovingSprite(std::string textureIdentifier, const e2d::Vector2f& position, const e2d::Vector2f& velocity);
+
+    ~MovingSprite() final;
+
+    void onLoad() final;
+
+    void onVariableUpdate(double deltaTime) final;
+
+private:
+    std::string   m_textureIdentifier;
+    e2d::Vector2f m_velocity;
+};
+
+#endif //E2D_EXAMPLE_STRESS_TEST_MOVING_SPRITE_HPP
@@ -0,0 +1,165 @@
+/**
+ * @file StressOptions.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "StressOptions.hpp"
+
+#include <E2D/Core/Logger.hpp>
+
+#include <charconv>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+std::optional<std::size_t> parseCount(std::string_view value)
+{
+    std::size_t result = 0;
+    const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (error != std::errc() || end != value.data() + value.size())
+    {
+        return std::nullopt;
+    }
+    return result;
+}
+
+std::optional<Workload> parseWorkload(std::string_view value)
+{
+    for (const auto workload : {Workload::Sprites,
+                                Workload::Texts,
+                                Workload::Churn,
+                                Workload::Priorities,
+                                Workload::Buffers,
+                                Workload::Particles})
+    {
+        if (value == toString(workload))
+        {
+            return workload;
+        }
+    }
+    return std::nullopt;
+}
+} // namespace
+
+std::string toString(Workload workload)
+{
+    switch (workload)
+    {
+        case Workload::Sprites:
+            return "sprites";
+        case Workload::Texts:
+            return "texts";
+        case Workload::Churn:
+            return "churn";
+        case Workload::Priorities:
+            return "priorities";
+        case Workload::Buffers:
+            return "buffers";
+        case Workload::Particles:
+            return "particles";
+    }
+    return "unknown";
+}
+
+std::optional<StressOptions> parseOptions(int argc, char* argv[])
+{
+    StressOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        if (argument == "--partial")
+        {
+            options.partialRedraw = true;
+            continue;
+        }
+        if (argument == "--csv")
+        {
+            options.csv = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            e2d::log::error("Missing value for argument '{}'", argument);
+            return std::nullopt;
+        }
+
+        const std::string_view value = argv[++i];
+        if (argument == "--workload")
+        {
+            const auto workload = parseWorkload(value);
+            if (!workload)
+            {
+                e2d::log::error("Unknown workload '{}'", value);
+                return std::nullopt;
+            }
+            options.workload = *workload;
+            continue;
+        }
+
+        const auto number = parseCount(value);
+        if (!number)
+        {
+            e2d::log::error("Invalid value '{}' for argument '{}'", value, argument);
+            return std::nullopt;
+        }
+        if (argument == "--count")
+        {
+            options.count = *number;
+        }
+        else if (argument == "--frames")
+        {
+            if (*number == 0)
+            {
+                e2d::log::error("At least one frame must be measured");
+                return std::nullopt;
+            }
+            options.frames = *number;
+        }
+        else if (argument == "--warmup")
+        {
+            options.warmupFrames = *number;
+        }
+        else
+        {
+            e2d::log::error("Unknown argument '{}'", argument);
+            return std::nullopt;
+        }
+    }
+    return options;
+}
+
+void printUsage(const std::string& program)
+{
+    std::cout << "Usage: " << program << " [--workload sprites|texts|churn|priorities|buffers|particles] [--count N]"
+              << " [--frames N] [--warmup N] [--partial] [--csv]\n"
+              << "\n"
+              << "Runs N frames of a worst-case scene headless and prints frame time percentiles per phase.\n"
+              << "  --workload  The scene to stress (default: sprites)\n"
+              << "  --count     The number of objects in the scene (default: 1000)\n"
+              << "  --frames    The number of frames to measure (default: 600)\n"
+              << "  --warmup    The number of frames to run before measuring (default: 60)\n"
+              << "  --partial   Redraw only the parts of the frame that changed\n"
+              << "  --csv       Print a CSV header and a single row instead of a table\n";
+}
@@ -0,0 +1,59 @@
+/**
+ * @file StressOptions.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_EXAMPLE_STRESS_TEST_STRESS_OPTIONS_HPP
+#define E2D_EXAMPLE_STRESS_TEST_STRESS_OPTIONS_HPP
+
+#include <optional>
+#include <string>
+
+enum class Workload
+{
+    Sprites,    // N sprites moving every frame
+    Texts,      // N texts whose string changes every frame
+    Churn,      // N sprites created and N destroyed every frame
+    Priorities, // N sprites whose render priorities interleave two textures and change every frame
+    Buffers,    // N sprites moving every frame, moved and recorded into command buffers by worker threads
+    Particles,  // N particles moving every frame, expiring and being replaced continuously
+};
+
+struct StressOptions
+{
+    Workload    workload{Workload::Sprites};
+    std::size_t count{1000};
+    std::size_t frames{600};
+    std::size_t warmupFrames{60};
+    bool        partialRedraw{false};
+    bool        csv{false};
+};
+
+std::string toString(Workload workload);
+
+std::optional<StressOptions> parseOptions(int argc, char* argv[]);
+
+void printUsage(const std::string& program);
+
+#endif //E2D_EXAMPLE_STRESS_TEST_STRESS_OPTIONS_HPP
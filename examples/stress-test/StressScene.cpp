@@ -0,0 +1,264 @@
+/**
+ * @file StressScene.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "StressScene.hpp"
+
+#include "MovingSprite.hpp"
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/Font.hpp>
+#include <E2D/Engine/ParticleSystem.hpp>
+#include <E2D/Engine/ResourceRegistry.hpp>
+#include <E2D/Engine/SceneManager.hpp>
+#include <E2D/Engine/Text.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+namespace
+{
+// Calls back into the scene once per frame, since scenes themselves have no per-frame hook
+class FrameDriver final : public e2d::Object
+{
+public:
+    explicit FrameDriver(StressScene& scene) : m_scene(scene)
+    {
+    }
+
+    ~FrameDriver() final = default;
+
+    void onFixedUpdate() final
+    {
+        this->m_scene.onFrame();
+    }
+
+private:
+    StressScene& m_scene;
+};
+} // namespace
+
+const float maxSpeed = 200;
+
+StressScene::StressScene(const StressOptions& options) : e2d::Scene("StressScene"), m_options(options)
+{
+}
+
+StressScene::~StressScene() = default;
+
+void StressScene::onLoad()
+{
+    // The resources are loaded up front by StressTest, so that a missing file aborts the run
+    this->createWorkload();
+    this->createObject<FrameDriver>(*this);
+}
+
+void StressScene::onFrame()
+{
+    if (this->m_frame == this->m_options.warmupFrames)
+    {
+        // Only the frames after the warmup are measured
+        e2d::Metrics::reset();
+    }
+    if (this->m_frame == this->m_options.warmupFrames + this->m_options.frames - 1)
+    {
+        // The last frame still completes, and the application quits once no scene is left
+        this->getSceneManager().popScene();
+    }
+
+    this->updateWorkload();
+    ++this->m_frame;
+}
+
+MovingSprite& StressScene::createSprite(const std::string& textureIdentifier)
+{
+    std::uniform_real_distribution<float> x(0, 800);
+    std::uniform_real_distribution<float> y(0, 600);
+    std::uniform_real_distribution<float> speed(-maxSpeed, maxSpeed);
+
+    auto& sprite = this->createObject<MovingSprite>(textureIdentifier,
+                                                    e2d::Vector2f(x(this->m_random), y(this->m_random)),
+                                                    e2d::Vector2f(speed(this->m_random), speed(this->m_random)));
+    this->m_sprites.push_back(&sprite);
+    return sprite;
+}
+
+std::unique_ptr<MovingSprite> StressScene::createDetachedSprite()
+{
+    std::uniform_real_distribution<float> x(0, 800);
+    std::uniform_real_distribution<float> y(0, 600);
+    std::uniform_real_distribution<float> speed(-maxSpeed, maxSpeed);
+
+    // Not part of the scene, so the sprite is loaded by hand and only drawn through the command buffers
+    auto sprite = std::make_unique<MovingSprite>("Player",
+                                                 e2d::Vector2f(x(this->m_random), y(this->m_random)),
+                                                 e2d::Vector2f(speed(this->m_random), speed(this->m_random)));
+    sprite->onLoad();
+    return sprite;
+}
+
+void StressScene::recordInParallel()
+{
+    const std::size_t workers = this->m_buffers.size();
+    const std::size_t count   = this->m_detachedSprites.size();
+
+    std::vector<std::thread> threads;
+    for (std::size_t worker = 0; worker < workers; ++worker)
+    {
+        threads.emplace_back(
+            [this, worker, begin = count * worker / workers, end = count * (worker + 1) / workers]
+            {
+                auto& buffer = this->m_buffers[worker];
+                buffer.clear();
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    this->m_detachedSprites[i]->onVariableUpdate(1.0 / 60.0);
+                    buffer.drawSprite(*this->m_detachedSprites[i]);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& buffer : this->m_buffers)
+    {
+        this->submit(buffer);
+    }
+}
+
+void StressScene::createParticles()
+{
+    e2d::ParticleEmitter emitter;
+    emitter.position    = {400, 300};
+    emitter.area        = {800, 600};
+    emitter.minSpeed    = 0;
+    emitter.maxSpeed    = maxSpeed;
+    emitter.minLifetime = 1;
+    emitter.maxLifetime = 2;
+    emitter.minSize     = 2;
+    emitter.maxSize     = 4;
+
+    auto& particles = this->createObject<e2d::ParticleSystem>();
+    particles.setEmitter(emitter);
+    particles.setAcceleration({0, 100});
+    particles.setCapacity(this->m_options.count);
+    particles.burst(this->m_options.count);
+
+    // Particles live for 1.5 seconds on average, so this replaces them as fast as they expire
+    particles.setEmissionRate(static_cast<float>(this->m_options.count) / 1.5f);
+}
+
+void StressScene::createWorkload()
+{
+    if (this->m_options.workload == Workload::Particles)
+    {
+        this->createParticles();
+        return;
+    }
+    if (this->m_options.workload == Workload::Buffers)
+    {
+        this->m_buffers = std::vector<e2d::RenderCommandBuffer>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    const auto& resources = e2d::ResourceRegistry::getInstance();
+    for (std::size_t i = 0; i < this->m_options.count; ++i)
+    {
+        switch (this->m_options.workload)
+        {
+            case Workload::Sprites:
+            case Workload::Churn:
+                this->createSprite("Player");
+                break;
+            case Workload::Texts:
+            {
+                auto& text = this->createObject<e2d::Text>();
+                text.setFont(resources.get<e2d::Font>("OpenSans"));
+                text.setFontSize(16);
+                text.setPosition({static_cast<float>(i % 10) * 80, static_cast<float>(i / 10 % 30) * 20});
+                this->m_texts.push_back(&text);
+                break;
+            }
+            case Workload::Priorities:
+                // Alternates between two textures so that every other sprite in render order switches texture
+                this->createSprite(i % 2 == 0 ? "Player" : "PlayerCopy");
+                break;
+            case Workload::Buffers:
+                this->m_detachedSprites.push_back(this->createDetachedSprite());
+                break;
+            case Workload::Particles:
+                break;
+        }
+    }
+}
+
+void StressScene::updateWorkload()
+{
+    switch (this->m_options.workload)
+    {
+        case Workload::Sprites:
+            break;
+        case Workload::Texts:
+        {
+            const auto string = std::to_string(this->m_frame);
+            for (auto* text : this->m_texts)
+            {
+                text->setString(string);
+            }
+            break;
+        }
+        case Workload::Churn:
+        {
+            for (const auto* sprite : this->m_sprites)
+            {
+                this->removeObject(sprite->getIdentifier());
+            }
+            this->m_sprites.clear();
+            for (std::size_t i = 0; i < this->m_options.count; ++i)
+            {
+                this->createSprite("Player");
+            }
+            break;
+        }
+        case Workload::Priorities:
+        {
+            // Rotates the render order every frame so the render queue never sees the same order twice
+            const auto count = this->m_sprites.size();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                this->m_sprites[i]->setRenderPriority(static_cast<int>((i + this->m_frame) % count));
+            }
+            break;
+        }
+        case Workload::Buffers:
+            this->recordInParallel();
+            break;
+        case Workload::Particles:
+            break;
+    }
+}
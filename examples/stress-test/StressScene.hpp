@@ -0,0 +1,80 @@
+/**
+ * @file StressScene.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_EXAMPLE_STRESS_TEST_STRESS_SCENE_HPP
+#define E2D_EXAMPLE_STRESS_TEST_STRESS_SCENE_HPP
+
+#include "StressOptions.hpp"
+
+#include <E2D/Engine/RenderCommandBuffer.hpp>
+#include <E2D/Engine/Scene.hpp>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class MovingSprite;
+
+namespace e2d
+{
+class Text;
+} // namespace e2d
+
+class StressScene final : public e2d::Scene
+{
+public:
+    explicit StressScene(const StressOptions& options);
+
+    ~StressScene() final;
+
+    void onLoad() final;
+
+    void onFrame();
+
+private:
+    MovingSprite& createSprite(const std::string& textureIdentifier);
+
+    std::unique_ptr<MovingSprite> createDetachedSprite();
+
+    void recordInParallel();
+
+    void createParticles();
+
+    void createWorkload();
+
+    void updateWorkload();
+
+    StressOptions                              m_options;
+    std::size_t                                m_frame{0};
+    std::mt19937                               m_random{1234};
+    std::vector<MovingSprite*>                 m_sprites;
+    std::vector<e2d::Text*>                    m_texts;
+    std::vector<std::unique_ptr<MovingSprite>> m_detachedSprites;
+    std::vector<e2d::RenderCommandBuffer>      m_buffers;
+};
+
+#endif //E2D_EXAMPLE_STRESS_TEST_STRESS_SCENE_HPP
@@ -0,0 +1,57 @@
+/**
+ * @file StressTest.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "StressTest.hpp"
+
+#include "StressScene.hpp"
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/ResourceRegistry.hpp>
+#include <E2D/Engine/SceneManager.hpp>
+
+StressTest::StressTest(const StressOptions& options) :
+e2d::Application("StressTest", e2d::RenderMode::Headless),
+m_options(options)
+{
+    // Frames run back to back so the frame times measure the engine rather than the frame rate limit
+    this->setFrameRateLimit(0);
+    this->setPartialRedraw(options.partialRedraw);
+}
+
+StressTest::~StressTest() = default;
+
+void StressTest::onRunning()
+{
+    if (!e2d::ResourceRegistry::getInstance().loadManifest("stress-test.manifest"))
+    {
+        e2d::log::error("Failed to load the resources of the stress test");
+        this->quit(1);
+        return;
+    }
+
+    this->getSceneManager().pushScene<StressScene>(this->m_options);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file main.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "StressOptions.hpp"
+#include "StressTest.hpp"
+
+#include <E2D/Core/Logger.hpp>
+#include <E2D/Core/Metrics.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+struct Phase
+{
+    const char* name;
+    const char* metric;
+};
+
+const Phase phases[] = {
+    {"frame", "frame.time_us"},
+    {"events", "frame.events_us"},
+    {"update", "frame.update_us"},
+    {"draw", "frame.draw_us"},
+    {"render", "frame.render_us"},
+    {"clean", "frame.clean_us"},
+};
+
+double getMean(const e2d::HistogramSnapshot& histogram)
+{
+    return histogram.count == 0 ? 0.0 : static_cast<double>(histogram.sum) / static_cast<double>(histogram.count);
+}
+
+double getPerFrame(const e2d::MetricsSnapshot& snapshot, const std::string& counter, std::size_t frames)
+{
+    return static_cast<double>(snapshot.counters.at(counter)) / static_cast<double>(frames);
+}
+
+void printTable(const StressOptions& options, const e2d::MetricsSnapshot& snapshot)
+{
+    const auto& frameTime = snapshot.histograms.at("frame.time_us");
+
+    std::cout << "workload " << toString(options.workload) << ", count " << options.count << ", frames "
+              << options.frames << " (+" << options.warmupFrames << " warmup)\n\n";
+
+    std::cout << std::left << std::setw(8) << "phase" << std::right;
+    for (const auto* column : {"mean", "p50", "p90", "p99", "p99.9", "max"})
+    {
+        std::cout << std::setw(10) << column;
+    }
+    std::cout << "   (us)\n";
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto& phase : phases)
+    {
+        const auto& histogram = snapshot.histograms.at(phase.metric);
+        std::cout << std::left << std::setw(8) << phase.name << std::right << std::setw(10) << getMean(histogram)
+                  << std::setw(10) << histogram.p50 << std::setw(10) << histogram.p90 << std::setw(10)
+                  << histogram.p99 << std::setw(10) << histogram.p999 << std::setw(10) << histogram.max << "\n";
+    }
+
+    const double meanFrameTime = getMean(frameTime);
+    std::cout << "\nframes per second     " << (meanFrameTime > 0 ? 1000000.0 / meanFrameTime : 0.0) << "\n"
+              << "renderables per frame " << getPerFrame(snapshot, "renderer.renderables_drawn", options.frames)
+              << "\n"
+              << "draw calls per frame  " << getPerFrame(snapshot, "renderer.draw_calls", options.frames) << "\n"
+              << "texture switches      " << getPerFrame(snapshot, "renderer.texture_switches", options.frames)
+              << " per frame\n";
+}
+
+void printCsv(const StressOptions& options, const e2d::MetricsSnapshot& snapshot)
+{
+    std::cout << "workload,count,frames";
+    for (const auto& phase : phases)
+    {
+        for (const auto* column : {"mean", "p50", "p90", "p99", "p999", "max"})
+        {
+            std::cout << "," << phase.name << "_" << column << "_us";
+        }
+    }
+    std::cout << ",draw_calls_per_frame,texture_switches_per_frame\n";
+
+    std::cout << toString(options.workload) << "," << options.count << "," << options.frames;
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto& phase : phases)
+    {
+        const auto& histogram = snapshot.histograms.at(phase.metric);
+        std::cout << "," << getMean(histogram) << "," << histogram.p50 << "," << histogram.p90 << ","
+                  << histogram.p99 << "," << histogram.p999 << "," << histogram.max;
+    }
+    std::cout << "," << getPerFrame(snapshot, "renderer.draw_calls", options.frames) << ","
+              << getPerFrame(snapshot, "renderer.texture_switches", options.frames) << "\n";
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        if (argument == "--help" || argument == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+    }
+
+    const auto options = parseOptions(argc, argv);
+    if (!options)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Keeps the report readable, the engine logs every object it constructs at debug level
+    e2d::Logger::setLevel(e2d::E2D_LOG_LEVEL_WARN);
+
+    auto* application = new StressTest(*options);
+
+    const auto exitCode = application->run();
+
+    delete application;
+
+    if (exitCode != 0)
+    {
+        return exitCode;
+    }
+
+    const auto snapshot = e2d::Metrics::getSnapshot();
+    if (options->csv)
+    {
+        printCsv(*options, snapshot);
+    }
+    else
+    {
+        printTable(*options, snapshot);
+    }
+
+    return 0;
+}
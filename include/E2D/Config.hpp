@@ -74,6 +74,30 @@
 #define E2D_DEBUG
 #endif
 
+/**
+ * Define the lowest log level compiled into the program, as the value of the matching LogLevel.
+ * Log calls below it are removed entirely, so by default debug messages cost nothing in release builds.
+ */
+#ifndef E2D_LOG_MIN_LEVEL
+#ifdef E2D_DEBUG
+#define E2D_LOG_MIN_LEVEL 0
+#else
+#define E2D_LOG_MIN_LEVEL 1
+#endif
+#endif
+
+/**
+ * Define whether DebugDraw shapes are compiled into the program, as 1 or 0.
+ * Without them, drawing with a DebugDraw costs nothing, so by default debug overlays are removed from release builds.
+ */
+#ifndef E2D_DEBUG_DRAW
+#ifdef E2D_DEBUG
+#define E2D_DEBUG_DRAW 1
+#else
+#define E2D_DEBUG_DRAW 0
+#endif
+#endif
+
 /**
  * Define helpers to create portable import / export macros for each module
  */
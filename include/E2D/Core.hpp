@@ -29,11 +29,20 @@
 
 #include <E2D/Core/Export.hpp>
 
+#include <E2D/Core/BinaryLogSink.hpp>
 #include <E2D/Core/Color.hpp>
+#include <E2D/Core/ConsoleLogSink.hpp>
+#include <E2D/Core/FormatBuffer.hpp>
+#include <E2D/Core/FormatString.hpp>
 #include <E2D/Core/Formatter.hpp>
+#include <E2D/Core/LogArguments.hpp>
+#include <E2D/Core/LogSink.hpp>
 #include <E2D/Core/Logger.hpp>
+#include <E2D/Core/Metrics.hpp>
 #include <E2D/Core/NonCopyable.hpp>
 #include <E2D/Core/Rect.hpp>
+#include <E2D/Core/RingBufferLogSink.hpp>
+#include <E2D/Core/RotatingFileLogSink.hpp>
 #include <E2D/Core/Timer.hpp>
 #include <E2D/Core/Vector2.hpp>
 
@@ -0,0 +1,136 @@
+/**
+ * @file BinaryLogSink.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_BINARY_LOG_SINK_HPP
+#define E2D_CORE_BINARY_LOG_SINK_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/LogSink.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace e2d
+{
+
+/**
+ * @class BinaryLogSink
+ * @ingroup core
+ * @brief Writes log messages to a compact binary file that is decoded offline.
+ *
+ * Instead of formatted text, every message is stored as the id of its format string followed by
+ * its raw arguments as encoded by LogArguments. Each format string is written to the file only
+ * once, the first time it is used, and timestamps are stored as the difference to the previous
+ * message. Ids, lengths and time differences are variable length integers, so a typical message
+ * takes a few bytes plus its arguments instead of a full line of text. Use decode or decodeFile to
+ * turn a binary log back into text.
+ *
+ * Floating point arguments are stored in the native byte order of the machine that wrote the log.
+ */
+class E2D_CORE_API BinaryLogSink final : public LogSink
+{
+public:
+    /**
+     * @brief Constructs a new BinaryLogSink object.
+     *
+     * Creates the file, replacing any existing file with the same name.
+     *
+     * @param filepath The path of the binary log file.
+     */
+    explicit BinaryLogSink(const std::string& filepath);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~BinaryLogSink() override;
+
+    /**
+     * @brief Writes a message to the binary log file.
+     *
+     * @param message The message to write.
+     */
+    void write(const LogMessage& message) override;
+
+    /**
+     * @brief Flushes the binary log file.
+     */
+    void flush() override;
+
+    /**
+     * @brief Checks whether the binary log file could be created.
+     *
+     * @return True if messages are written to the file, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Decodes a binary log to text.
+     *
+     * Every message is written as a line in the same format as the other text based sinks use.
+     *
+     * @param input The stream to read the binary log from.
+     * @param output The stream to write the text to.
+     * @return True if the whole log was decoded, false if it is not a binary log or is corrupted.
+     */
+    static bool decode(std::istream& input, std::ostream& output);
+
+    /**
+     * @brief Decodes a binary log file to a text file.
+     *
+     * @param inputFilepath The path of the binary log file.
+     * @param outputFilepath The path of the text file to write.
+     * @return True if the whole log was decoded, false otherwise.
+     */
+    static bool decodeFile(const std::string& inputFilepath, const std::string& outputFilepath);
+
+private:
+    /**
+     * @brief Looks up the id of a format string, writing a definition for it if it is new.
+     *
+     * @param format The format string.
+     * @return The id of the format string.
+     */
+    std::uint32_t getFormatId(std::string_view format);
+
+    std::ofstream                                    m_file;      //!< The open binary log file.
+    std::int64_t                                     m_lastTime;  //!< The time of the previous message in microseconds.
+    std::unordered_map<std::uint64_t, std::uint32_t> m_formatIds; //!< The ids of known format strings, by hash.
+    std::vector<std::string>                         m_formats;   //!< The known format strings, by id.
+
+}; // class BinaryLogSink
+
+} // namespace e2d
+
+#endif //E2D_CORE_BINARY_LOG_SINK_HPP
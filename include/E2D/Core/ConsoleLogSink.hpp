@@ -0,0 +1,77 @@
+/**
+ * @file ConsoleLogSink.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_CONSOLE_LOG_SINK_HPP
+#define E2D_CORE_CONSOLE_LOG_SINK_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/LogSink.hpp>
+
+namespace e2d
+{
+
+/**
+ * @class ConsoleLogSink
+ * @ingroup core
+ * @brief Writes log messages to the standard output with colored log levels.
+ *
+ * The logger starts out with a single ConsoleLogSink registered.
+ */
+class E2D_CORE_API ConsoleLogSink final : public LogSink
+{
+public:
+    /**
+     * @brief Constructs a new ConsoleLogSink object.
+     *
+     * Enables ANSI color codes on consoles that need them to be switched on explicitly.
+     */
+    ConsoleLogSink();
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~ConsoleLogSink() override;
+
+    /**
+     * @brief Writes a message to the standard output.
+     *
+     * @param message The message to write.
+     */
+    void write(const LogMessage& message) override;
+
+    /**
+     * @brief Flushes the standard output.
+     */
+    void flush() override;
+
+}; // class ConsoleLogSink
+
+} // namespace e2d
+
+#endif //E2D_CORE_CONSOLE_LOG_SINK_HPP
@@ -0,0 +1,159 @@
+/**
+ * @file FormatBuffer.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_FORMAT_BUFFER_HPP
+#define E2D_CORE_FORMAT_BUFFER_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace e2d
+{
+
+/**
+ * @class FormatBuffer
+ * @ingroup core
+ * @brief A character buffer that formatted text is written to.
+ *
+ * By default the buffer keeps short strings in inline storage and only allocates memory on the heap
+ * once the text outgrows it. Alternatively it can write into storage supplied by the caller, in
+ * which case it never allocates and truncates text that does not fit.
+ *
+ * The text in the buffer is always null terminated.
+ */
+class E2D_CORE_API FormatBuffer final : NonCopyable
+{
+public:
+    /**
+     * @brief The number of characters, including the null terminator, held in inline storage.
+     */
+    static constexpr std::size_t InlineCapacity = 256;
+
+    /**
+     * @brief Constructs an empty FormatBuffer that uses inline storage.
+     */
+    FormatBuffer();
+
+    /**
+     * @brief Constructs an empty FormatBuffer that writes into the given storage.
+     *
+     * @param buffer The storage to write into.
+     * @param capacity The size of the storage, including room for the null terminator.
+     */
+    FormatBuffer(char* buffer, std::size_t capacity);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~FormatBuffer();
+
+    /**
+     * @brief Appends text to the buffer.
+     *
+     * @param text The text to append.
+     */
+    void append(std::string_view text);
+
+    /**
+     * @brief Appends a single character to the buffer.
+     *
+     * @param character The character to append.
+     */
+    void append(char character);
+
+    /**
+     * @brief Removes all text from the buffer.
+     *
+     * Memory allocated on the heap is kept for reuse.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the text in the buffer as a null terminated string.
+     *
+     * @return A pointer to the text.
+     */
+    const char* getData() const;
+
+    /**
+     * @brief Retrieves the length of the text in the buffer.
+     *
+     * @return The number of characters, not counting the null terminator.
+     */
+    std::size_t getSize() const;
+
+    /**
+     * @brief Retrieves a view of the text in the buffer.
+     *
+     * @return A view that is valid until the buffer is modified or destroyed.
+     */
+    std::string_view getView() const;
+
+    /**
+     * @brief Copies the text in the buffer to a string.
+     *
+     * @return The text in the buffer.
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Checks whether text had to be cut off because the caller supplied storage was full.
+     *
+     * @return True if text was truncated, false otherwise.
+     */
+    bool isTruncated() const;
+
+private:
+    /**
+     * @brief Makes room for at least the given number of characters plus the null terminator.
+     *
+     * @param size The total number of characters that must fit.
+     * @return The total number of characters that fit, which is less than requested only for caller supplied storage.
+     */
+    std::size_t reserve(std::size_t size);
+
+    std::array<char, InlineCapacity> m_inline{};         //!< The inline storage.
+    std::unique_ptr<char[]>          m_heap;             //!< The heap storage, once inline storage is outgrown.
+    char*                            m_data;             //!< The storage currently in use.
+    std::size_t                      m_size{0};          //!< The number of characters in the buffer.
+    std::size_t                      m_capacity;         //!< The size of the storage in use.
+    bool                             m_fixed;            //!< Whether the storage was supplied by the caller.
+    bool                             m_truncated{false}; //!< Whether text was cut off.
+
+}; // class FormatBuffer
+
+} // namespace e2d
+
+#endif //E2D_CORE_FORMAT_BUFFER_HPP
@@ -0,0 +1,181 @@
+/**
+ * @file FormatString.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_FORMAT_STRING_HPP
+#define E2D_CORE_FORMAT_STRING_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Format strings passed as literals are only validated at compile time when the compiler supports consteval (C++20).
+ * The engine is built as C++17, where they are validated when the call is made and a mismatch throws a
+ * std::runtime_error. Only E2D_FORMAT checks a format string at compile time there. Without consteval, any
+ * character array is accepted, so only E2D_FORMAT marks a format string as static.
+ */
+#if defined(__cpp_consteval)
+#define E2D_FORMAT_CONSTEVAL           consteval
+#define E2D_FORMAT_ARRAYS_ARE_CONSTANT true
+#else
+#define E2D_FORMAT_CONSTEVAL           constexpr
+#define E2D_FORMAT_ARRAYS_ARE_CONSTANT false
+#endif
+
+/**
+ * @ingroup core
+ * @brief Wraps a string literal so that its placeholders are counted at compile time.
+ *
+ * A mismatch between the number of placeholders and the number of arguments becomes a compile error,
+ * even in C++17.
+ *
+ * @code
+ * e2d::log::info(E2D_FORMAT("Loaded {} textures in {} ms"), count, elapsed);
+ * @endcode
+ */
+#define E2D_FORMAT(text)                                                   \
+    []                                                                     \
+    {                                                                      \
+        struct CompiledFormat : ::e2d::internal::CompiledFormatBase        \
+        {                                                                  \
+            static constexpr std::string_view value()                      \
+            {                                                              \
+                return text;                                               \
+            }                                                              \
+        };                                                                 \
+        return CompiledFormat{};                                           \
+    }()
+
+namespace e2d
+{
+
+namespace internal
+{
+/**
+ * @struct CompiledFormatBase
+ * @ingroup core
+ * @brief @internal Tag base of the types created by E2D_FORMAT.
+ */
+struct CompiledFormatBase
+{
+};
+
+/**
+ * @ingroup core
+ * @brief @internal Counts the placeholders in a format string.
+ *
+ * "{}" is a placeholder, while "{{" and "}}" are escaped braces. Any other brace is taken literally.
+ *
+ * @param text The format string.
+ * @return The number of placeholders.
+ */
+constexpr std::size_t countPlaceholders(std::string_view text);
+} // namespace internal
+
+/**
+ * @class FormatString
+ * @ingroup core
+ * @brief A format string whose placeholder count has been checked against the number of arguments.
+ *
+ * FormatString is used as the parameter type of the formatting and logging functions and is
+ * normally created implicitly from a string literal. Strings that are only known at runtime are
+ * accepted too. A mismatch throws a std::runtime_error, except for E2D_FORMAT, and for literals when
+ * the compiler supports consteval, where it is a compile error.
+ *
+ * @tparam ArgumentCount The number of arguments the string is formatted with.
+ */
+template <std::size_t ArgumentCount>
+class FormatString
+{
+public:
+    /**
+     * @brief Constructs a FormatString from a string literal.
+     *
+     * The format string ends at the first null character. Only with consteval (C++20) is a mismatch a
+     * compile error. In C++17 the count is checked when the call is made, so use E2D_FORMAT for a
+     * compile-time check. Without consteval this also accepts character arrays filled at runtime, so
+     * the format string is only static with consteval.
+     *
+     * @param text The format string.
+     *
+     * @throws std::runtime_error If the number of placeholders does not match the number of arguments
+     *         and the compiler does not support consteval.
+     */
+    template <std::size_t N>
+    E2D_FORMAT_CONSTEVAL FormatString(const char (&text)[N]); // NOLINT(google-explicit-constructor)
+
+    /**
+     * @brief Constructs a FormatString from a string created with E2D_FORMAT.
+     *
+     * @param text The compiled format string.
+     */
+    template <typename T, std::enable_if_t<std::is_base_of_v<internal::CompiledFormatBase, T>, int> = 0>
+    constexpr FormatString(T text); // NOLINT(google-explicit-constructor)
+
+    /**
+     * @brief Constructs a FormatString from a string known only at runtime.
+     *
+     * @param text The format string.
+     *
+     * @throws std::runtime_error If the number of placeholders does not match the number of arguments.
+     */
+    template <typename T,
+              std::enable_if_t<std::is_convertible_v<const T&, std::string_view> && !std::is_array_v<T>, int> = 0>
+    FormatString(const T& text); // NOLINT(google-explicit-constructor)
+
+    /**
+     * @brief Retrieves the format string.
+     *
+     * @return A view of the format string.
+     */
+    constexpr std::string_view getView() const;
+
+    /**
+     * @brief Checks whether the format string was created from a string literal.
+     *
+     * A string literal stays valid for the whole run of the program, so it can be referenced
+     * instead of copied by code that needs the format string after the call has returned. This is
+     * only known for E2D_FORMAT, and for character arrays when the compiler supports consteval.
+     *
+     * @return True if the format string is a string literal, false otherwise.
+     */
+    constexpr bool isStatic() const;
+
+private:
+    std::string_view m_text;          //!< The format string.
+    bool             m_static{false}; //!< Whether the format string is a string literal.
+
+}; // class FormatString
+
+#include <E2D/Core/FormatString.inl>
+
+} // namespace e2d
+
+#endif //E2D_CORE_FORMAT_STRING_HPP
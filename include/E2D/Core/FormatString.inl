@@ -0,0 +1,93 @@
+/**
+ * @file FormatString.inl
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+constexpr std::size_t internal::countPlaceholders(std::string_view text)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        if (i + 1 >= text.size())
+        {
+            break;
+        }
+        if (text[i] == '{' && text[i + 1] == '}')
+        {
+            ++count;
+            ++i;
+        }
+        else if ((text[i] == '{' && text[i + 1] == '{') || (text[i] == '}' && text[i + 1] == '}'))
+        {
+            ++i;
+        }
+    }
+    return count;
+}
+
+template <std::size_t ArgumentCount>
+template <std::size_t N>
+E2D_FORMAT_CONSTEVAL FormatString<ArgumentCount>::FormatString(const char (&text)[N])
+    : m_text(text, std::char_traits<char>::length(text))
+    , m_static(E2D_FORMAT_ARRAYS_ARE_CONSTANT)
+{
+    if (internal::countPlaceholders(this->m_text) != ArgumentCount)
+    {
+        // With consteval, reaching this throw makes the mismatch a compile error, in C++17 it throws when called
+        throw std::runtime_error("The number of placeholders does not match the number of arguments.");
+    }
+}
+
+template <std::size_t ArgumentCount>
+template <typename T, std::enable_if_t<std::is_base_of_v<internal::CompiledFormatBase, T>, int>>
+constexpr FormatString<ArgumentCount>::FormatString(T /* text */)
+    : m_text(T::value())
+    , m_static(true)
+{
+    static_assert(internal::countPlaceholders(T::value()) == ArgumentCount,
+                  "The number of placeholders does not match the number of arguments.");
+}
+
+template <std::size_t ArgumentCount>
+template <typename T, std::enable_if_t<std::is_convertible_v<const T&, std::string_view> && !std::is_array_v<T>, int>>
+FormatString<ArgumentCount>::FormatString(const T& text)
+    : m_text(text)
+{
+    if (internal::countPlaceholders(this->m_text) != ArgumentCount)
+    {
+        throw std::runtime_error("The number of placeholders does not match the number of arguments.");
+    }
+}
+
+template <std::size_t ArgumentCount>
+constexpr std::string_view FormatString<ArgumentCount>::getView() const
+{
+    return this->m_text;
+}
+
+template <std::size_t ArgumentCount>
+constexpr bool FormatString<ArgumentCount>::isStatic() const
+{
+    return this->m_static;
+}
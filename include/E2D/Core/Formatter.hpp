@@ -29,6 +29,8 @@
 
 #include <E2D/Core/Export.hpp>
 
+#include <E2D/Core/FormatBuffer.hpp>
+#include <E2D/Core/FormatString.hpp>
 #include <E2D/Core/NonCopyable.hpp>
 
 #include <iostream>
@@ -44,9 +46,16 @@ namespace e2d
  * @brief A utility class for formatting strings with placeholders.
  *
  * This class provides static methods to format strings with placeholders and arguments.
+ *
+ * The formatTo functions are the allocation-free path used by the logger and by anything that formats
+ * text every frame. They check the number of placeholders against the number of arguments when the
+ * format string is created, write numbers with std::to_chars, and write into a FormatBuffer or a caller
+ * supplied character array. Only types without built-in support fall back to their stream operator.
  */
 class E2D_CORE_API Formatter final : NonCopyable
 {
+    friend class LogArguments;
+
 public:
     /**
      * @brief Formats a string with the given arguments.
@@ -61,6 +70,34 @@ public:
     template <typename... Args>
     static std::string format(const std::string& text, Args&&... args);
 
+    /**
+     * @brief Formats a string with the given arguments and appends it to a buffer.
+     *
+     * Replaces placeholders "{}" in the text with the provided arguments. "{{" and "}}" are written as single braces.
+     *
+     * @tparam Args The types of the arguments to format.
+     * @param buffer The buffer to append the formatted text to.
+     * @param text The format string, with exactly one placeholder per argument.
+     * @param args The arguments to replace the placeholders.
+     */
+    template <typename... Args>
+    static void formatTo(FormatBuffer& buffer, FormatString<sizeof...(Args)> text, Args&&... args);
+
+    /**
+     * @brief Formats a string with the given arguments into a character array.
+     *
+     * The result is always null terminated and is truncated if it does not fit. No memory is allocated.
+     *
+     * @tparam Args The types of the arguments to format.
+     * @param buffer The character array to write to.
+     * @param size The size of the character array, including room for the null terminator.
+     * @param text The format string, with exactly one placeholder per argument.
+     * @param args The arguments to replace the placeholders.
+     * @return The number of characters written, not counting the null terminator.
+     */
+    template <typename... Args>
+    static std::size_t formatTo(char* buffer, std::size_t size, FormatString<sizeof...(Args)> text, Args&&... args);
+
 private:
     /**
      * @brief Constructs a new Formatter object.
@@ -112,6 +149,67 @@ private:
      * @return The modified format string with double braces replaced by single braces.
      */
     static std::string handleEscapedBraces(const std::string& text);
+
+    /**
+     * @brief Appends the literal text up to the next placeholder to a buffer.
+     *
+     * Escaped braces are written as single braces.
+     *
+     * @param buffer The buffer to append to.
+     * @param text The format string.
+     * @param pos The position in the format string to start at.
+     * @return The position just past the placeholder, or the size of the text if there is none.
+     */
+    static std::size_t appendLiteral(FormatBuffer& buffer, std::string_view text, std::size_t pos);
+
+    /**
+     * @brief Appends a single argument to a buffer.
+     *
+     * The output matches what the stream operator would produce for the argument.
+     *
+     * @tparam T The type of the argument.
+     * @param buffer The buffer to append to.
+     * @param value The argument to write.
+     */
+    template <typename T>
+    static void writeArgument(FormatBuffer& buffer, const T& value);
+
+    /**
+     * @brief Appends a signed integer to a buffer.
+     *
+     * @param buffer The buffer to append to.
+     * @param value The integer to write.
+     */
+    static void writeInteger(FormatBuffer& buffer, long long value);
+
+    /**
+     * @brief Appends an unsigned integer to a buffer.
+     *
+     * @param buffer The buffer to append to.
+     * @param value The integer to write.
+     */
+    static void writeInteger(FormatBuffer& buffer, unsigned long long value);
+
+    /**
+     * @brief Appends a floating point number to a buffer.
+     *
+     * Uses the shortest of fixed and scientific notation with six significant digits, like a default stream.
+     *
+     * @param buffer The buffer to append to.
+     * @param value The number to write.
+     */
+    static void writeFloat(FormatBuffer& buffer, double value);
+
+    /**
+     * @brief Appends an argument to a buffer through its stream operator.
+     *
+     * The stream writes directly into the buffer without an intermediate string.
+     *
+     * @param buffer The buffer to append to.
+     * @param value A pointer to the argument.
+     * @param write A function that writes the argument to a stream.
+     */
+    static void writeStream(FormatBuffer& buffer, const void* value, void (*write)(std::ostream&, const void*));
 };
 
 // class Formatter
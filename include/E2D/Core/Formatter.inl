@@ -50,3 +50,61 @@ void Formatter::formatImpl(std::ostringstream& oss, const std::string& text, siz
     oss << std::forward<T>(arg);
     formatImpl(oss, text, nextPos + 2, std::forward<Args>(args)...);
 }
+
+template <typename... Args>
+void Formatter::formatTo(FormatBuffer&                 buffer,
+                         FormatString<sizeof...(Args)> text,
+                         Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+{
+    const std::string_view view = text.getView();
+    std::size_t            pos  = 0;
+    ((pos = appendLiteral(buffer, view, pos), writeArgument(buffer, args)), ...);
+    appendLiteral(buffer, view, pos);
+}
+
+template <typename... Args>
+std::size_t Formatter::formatTo(char* buffer, std::size_t size, FormatString<sizeof...(Args)> text, Args&&... args)
+{
+    FormatBuffer output(buffer, size);
+    formatTo(output, text, std::forward<Args>(args)...);
+    return output.getSize();
+}
+
+template <typename T>
+void Formatter::writeArgument(FormatBuffer& buffer, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        buffer.append(value ? '1' : '0');
+    }
+    else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+    {
+        buffer.append(static_cast<char>(value));
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        writeInteger(buffer, static_cast<long long>(value));
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        writeInteger(buffer, static_cast<unsigned long long>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        writeFloat(buffer, static_cast<double>(value));
+    }
+    else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>)
+    {
+        buffer.append(value != nullptr ? std::string_view(value) : std::string_view("(null)"));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        buffer.append(std::string_view(value));
+    }
+    else
+    {
+        writeStream(buffer,
+                    &value,
+                    [](std::ostream& stream, const void* argument) { stream << *static_cast<const T*>(argument); });
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * @file LogArguments.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_LOG_ARGUMENTS_HPP
+#define E2D_CORE_LOG_ARGUMENTS_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/FormatBuffer.hpp>
+#include <E2D/Core/Formatter.hpp>
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace e2d
+{
+
+/**
+ * @class LogArguments
+ * @ingroup core
+ * @brief Encodes log message arguments into a compact binary form and formats them later.
+ *
+ * The logger does not format messages on the thread that logs them. Instead it stores the arguments
+ * in this encoding next to the format string, and the text is produced by the writer thread or, for
+ * BinaryLogSink, by the offline decoder. Numbers, booleans, characters and strings are stored raw.
+ * Any other type is formatted through its stream operator when it is encoded and stored as a string.
+ *
+ * Every argument is a one byte type tag followed by its value. Integers are stored as variable length
+ * integers (7 bits per byte, signed values zigzag encoded first), so small numbers take a single byte.
+ * Floating point numbers are stored as 8 bytes in native byte order, booleans and characters as one
+ * byte, and strings as a variable length integer length followed by the characters.
+ */
+class E2D_CORE_API LogArguments final : NonCopyable
+{
+public:
+    /**
+     * @enum Type
+     * @brief The type tag stored in front of every encoded argument.
+     */
+    enum class Type : std::uint8_t
+    {
+        Int,    //!< A signed integer, stored as a zigzag encoded variable length integer.
+        UInt,   //!< An unsigned integer, stored as a variable length integer.
+        Float,  //!< A floating point number, stored as a double.
+        Bool,   //!< A boolean, stored as one byte.
+        Char,   //!< A single character.
+        String, //!< A string, stored as a variable length integer length followed by the characters.
+    };
+
+    /**
+     * @brief Appends the encoding of the given arguments to a buffer.
+     *
+     * @tparam Args The types of the arguments to encode.
+     * @param buffer The buffer to append to.
+     * @param args The arguments to encode.
+     */
+    template <typename... Args>
+    static void encode(FormatBuffer& buffer, const Args&... args);
+
+    /**
+     * @brief Formats a string with encoded arguments.
+     *
+     * The output is identical to what Formatter::formatTo produces for the original arguments.
+     *
+     * @param buffer The buffer to append the formatted text to.
+     * @param format The format string.
+     * @param arguments The encoded arguments.
+     * @return True if the arguments were decoded successfully, false if they are malformed.
+     */
+    static bool format(FormatBuffer& buffer, std::string_view format, std::string_view arguments);
+
+    /**
+     * @brief Appends an unsigned integer in variable length encoding to a buffer.
+     *
+     * Each byte holds 7 bits of the value, least significant first, with the high bit set on every byte but the last.
+     *
+     * @param buffer The buffer to append to.
+     * @param value The value to append.
+     */
+    static void encodeVarint(FormatBuffer& buffer, std::uint64_t value);
+
+    /**
+     * @brief Reads an unsigned integer in variable length encoding.
+     *
+     * @param data The encoded data.
+     * @param pos The position of the integer, advanced past it on success.
+     * @param value Receives the value.
+     * @return True if the integer was read, false if the data ends before it does.
+     */
+    static bool decodeVarint(std::string_view data, std::size_t& pos, std::uint64_t& value);
+
+private:
+    /**
+     * @brief Constructs a new LogArguments object.
+     *
+     * Initializes a new instance of the LogArguments class.
+     */
+    LogArguments() = default;
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~LogArguments() = default;
+
+    /**
+     * @brief Appends the encoding of a single argument to a buffer.
+     *
+     * @tparam T The type of the argument.
+     * @param buffer The buffer to append to.
+     * @param value The argument to encode.
+     */
+    template <typename T>
+    static void encodeArgument(FormatBuffer& buffer, const T& value);
+
+    /**
+     * @brief Appends a type tag and the raw bytes of a value to a buffer.
+     *
+     * @tparam T The type of the value.
+     * @param buffer The buffer to append to.
+     * @param type The type tag.
+     * @param value The value to append.
+     */
+    template <typename T>
+    static void encodeValue(FormatBuffer& buffer, Type type, T value);
+
+    /**
+     * @brief Appends a signed integer argument to a buffer.
+     *
+     * @param buffer The buffer to append to.
+     * @param value The integer to encode.
+     */
+    static void encodeInteger(FormatBuffer& buffer, std::int64_t value);
+
+    /**
+     * @brief Appends an unsigned integer argument to a buffer.
+     *
+     * @param buffer The buffer to append to.
+     * @param value The integer to encode.
+     */
+    static void encodeInteger(FormatBuffer& buffer, std::uint64_t value);
+
+    /**
+     * @brief Appends a string argument to a buffer.
+     *
+     * @param buffer The buffer to append to.
+     * @param text The string to encode.
+     */
+    static void encodeString(FormatBuffer& buffer, std::string_view text);
+
+    /**
+     * @brief Decodes a single argument and appends its text to a buffer.
+     *
+     * @param buffer The buffer to append the text to.
+     * @param arguments The encoded arguments.
+     * @param pos The position of the argument, advanced past it on success.
+     * @return True if the argument was decoded, false if it is malformed.
+     */
+    static bool formatArgument(FormatBuffer& buffer, std::string_view arguments, std::size_t& pos);
+
+}; // class LogArguments
+
+#include <E2D/Core/LogArguments.inl>
+
+} // namespace e2d
+
+#endif //E2D_CORE_LOG_ARGUMENTS_HPP
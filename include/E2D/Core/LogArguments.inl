@@ -0,0 +1,79 @@
+/**
+ * @file LogArguments.inl
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+template <typename... Args>
+void LogArguments::encode(FormatBuffer& buffer, const Args&... args)
+{
+    (encodeArgument(buffer, args), ...);
+}
+
+template <typename T>
+void LogArguments::encodeArgument(FormatBuffer& buffer, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        encodeValue(buffer, Type::Bool, static_cast<std::uint8_t>(value ? 1 : 0));
+    }
+    else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+    {
+        encodeValue(buffer, Type::Char, static_cast<char>(value));
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        encodeInteger(buffer, static_cast<std::int64_t>(value));
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        encodeInteger(buffer, static_cast<std::uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        encodeValue(buffer, Type::Float, static_cast<double>(value));
+    }
+    else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>)
+    {
+        encodeString(buffer, value != nullptr ? std::string_view(value) : std::string_view("(null)"));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        encodeString(buffer, std::string_view(value));
+    }
+    else
+    {
+        FormatBuffer text;
+        Formatter::formatTo(text, "{}", value);
+        encodeString(buffer, text.getView());
+    }
+}
+
+template <typename T>
+void LogArguments::encodeValue(FormatBuffer& buffer, Type type, T value)
+{
+    std::array<char, 1 + sizeof(T)> bytes{};
+    bytes[0] = static_cast<char>(type);
+    std::memcpy(bytes.data() + 1, &value, sizeof(T));
+    buffer.append(std::string_view(bytes.data(), bytes.size()));
+}
@@ -0,0 +1,127 @@
+/**
+ * @file LogSink.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_LOG_SINK_HPP
+#define E2D_CORE_LOG_SINK_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/FormatBuffer.hpp>
+#include <E2D/Core/Logger.hpp>
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <chrono>
+#include <string_view>
+
+namespace e2d
+{
+
+/**
+ * @struct LogMessage
+ * @ingroup core
+ * @brief A log message as it is handed to the log sinks.
+ *
+ * Besides the formatted text the message carries the format string and the encoded arguments it
+ * was produced from, so that sinks can store messages in a compact form. All views are only valid
+ * for the duration of the LogSink::write call.
+ */
+struct LogMessage
+{
+    LogLevel                              level;     //!< The log level of the message.
+    std::chrono::system_clock::time_point time;      //!< The time the message was logged.
+    std::string_view                      format;    //!< The format string of the message.
+    std::string_view                      arguments; //!< The arguments of the message, encoded by LogArguments.
+    std::string_view                      text;      //!< The formatted message text.
+};
+
+/**
+ * @class LogSink
+ * @ingroup core
+ * @brief Base class for destinations of log messages.
+ *
+ * Sinks are registered on the Logger and receive every message that passes the log level filter.
+ * The logger never calls a sink from more than one thread at a time: in asynchronous mode all
+ * sinks run on the background writer thread, otherwise they run on the logging thread while the
+ * logger holds its output lock. A sink must not log messages itself.
+ */
+class E2D_CORE_API LogSink : NonCopyable
+{
+public:
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    virtual ~LogSink();
+
+    /**
+     * @brief Writes a message to the sink.
+     *
+     * @param message The message to write.
+     */
+    virtual void write(const LogMessage& message) = 0;
+
+    /**
+     * @brief Makes sure that every message written so far has reached its destination.
+     *
+     * Called after every batch of messages in asynchronous mode and when Logger::flush is called.
+     * The default implementation does nothing.
+     */
+    virtual void flush();
+
+protected:
+    /**
+     * @brief Constructs a new LogSink object.
+     *
+     * Initializes a new instance of the LogSink class.
+     */
+    LogSink() = default;
+
+    /**
+     * @brief Formats a message as a line of text.
+     *
+     * The line contains the local date and time with millisecond precision, the log level and the
+     * message text, and ends with a newline.
+     *
+     * @param buffer The buffer to append the line to.
+     * @param message The message to format.
+     * @param colored True to highlight the log level with ANSI color codes, false otherwise.
+     */
+    static void formatLine(FormatBuffer& buffer, const LogMessage& message, bool colored);
+
+    /**
+     * @brief Converts a log level to its string representation.
+     *
+     * @param level The log level to convert.
+     * @return The name of the log level.
+     */
+    static std::string_view logLevelToString(LogLevel level);
+
+}; // class LogSink
+
+} // namespace e2d
+
+#endif //E2D_CORE_LOG_SINK_HPP
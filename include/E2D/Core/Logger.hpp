@@ -29,15 +29,33 @@
 
 #include <E2D/Core/Export.hpp>
 
+#include <E2D/Core/FormatBuffer.hpp>
+#include <E2D/Core/FormatString.hpp>
 #include <E2D/Core/Formatter.hpp>
+#include <E2D/Core/LogArguments.hpp>
 #include <E2D/Core/NonCopyable.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace e2d
 {
 
+namespace internal
+{
+struct LogRecord;
+class LogQueue;
+} // namespace internal
+
+class LogSink;
+
 /**
  * @enum LogLevel
  * @ingroup core
@@ -57,22 +75,133 @@ enum LogLevel
  * @brief Provides logging functionality with different log levels.
  *
  * This class handles logging messages with various levels of severity, formatting the messages, and ensuring thread-safe logging.
+ *
+ * Messages are handed to a list of sinks, which by default contains a single ConsoleLogSink. The thread
+ * that logs a message only encodes its arguments; turning them into text is left to the sinks' side.
+ * By default the sinks are called on the thread that logs the message. In asynchronous mode the
+ * logging thread pushes the message to a lock-free queue instead, and a background writer thread
+ * formats it and calls the sinks.
  */
 class E2D_CORE_API Logger final : NonCopyable
 {
 public:
+    /**
+     * @enum OverflowPolicy
+     * @brief Decides what happens when a message is logged while the asynchronous queue is full.
+     */
+    enum class OverflowPolicy
+    {
+        Drop,  //!< Discard the message and count it as dropped.
+        Block, //!< Wait until the writer thread has made room for the message.
+    };
+
     /**
      * @brief Logs a message with the given log level and arguments.
      *
      * Formats the message with the provided arguments and logs it with the specified log level.
+     * If the log level is filtered out, the function returns before any formatting takes place.
      *
      * @tparam Args The types of the arguments to format the message.
      * @param level The log level of the message.
-     * @param message The message to log, containing placeholders for the arguments.
+     * @param message The message to log, containing one placeholder per argument.
      * @param args The arguments to replace the placeholders in the message.
      */
     template <typename... Args>
-    static void log(LogLevel level, const std::string& message, Args&&... args);
+    static void log(LogLevel level, FormatString<sizeof...(Args)> message, Args&&... args);
+
+    /**
+     * @brief Sets the minimum log level of messages that are written.
+     *
+     * Messages below this level are discarded before they are formatted. The level cannot be lowered
+     * below E2D_LOG_MIN_LEVEL, since calls under that level are removed at compile time.
+     *
+     * @param level The new minimum log level.
+     */
+    static void setLevel(LogLevel level);
+
+    /**
+     * @brief Retrieves the minimum log level of messages that are written.
+     *
+     * @return The current minimum log level.
+     */
+    static LogLevel getLevel();
+
+    /**
+     * @brief Checks whether messages with the given log level are currently written.
+     *
+     * Can be used to skip expensive work that only produces log output.
+     *
+     * @param level The log level to check.
+     * @return True if messages with the log level are written, false otherwise.
+     */
+    static bool isEnabled(LogLevel level);
+
+    /**
+     * @brief Switches the logger to asynchronous mode.
+     *
+     * Starts a background writer thread and routes all subsequent messages through a bounded queue.
+     * If asynchronous mode is already enabled, pending messages are written and the queue is
+     * recreated with the new settings.
+     *
+     * This function must not be called while other threads are inside a call to enableAsync or disableAsync.
+     *
+     * @param capacity The minimum number of messages the queue can hold. Rounded up to a power of two.
+     * @param policy What to do with messages logged while the queue is full.
+     */
+    static void enableAsync(std::size_t capacity = 8192, OverflowPolicy policy = OverflowPolicy::Drop);
+
+    /**
+     * @brief Switches the logger back to synchronous mode.
+     *
+     * Writes all pending messages and stops the background writer thread. This also happens
+     * automatically when the program exits.
+     */
+    static void disableAsync();
+
+    /**
+     * @brief Checks whether the logger is in asynchronous mode.
+     *
+     * @return True if messages are written by a background thread, false otherwise.
+     */
+    static bool isAsyncEnabled();
+
+    /**
+     * @brief Waits until every message logged so far has been written.
+     *
+     * In synchronous mode this only flushes the console output.
+     */
+    static void flush();
+
+    /**
+     * @brief Retrieves the number of messages discarded because the asynchronous queue was full.
+     *
+     * The counter is reset when asynchronous mode is enabled.
+     *
+     * @return The number of dropped messages.
+     */
+    static std::size_t getDroppedCount();
+
+    /**
+     * @brief Registers a sink that receives every message that passes the log level filter.
+     *
+     * @param sink The sink to add.
+     */
+    static void addSink(std::shared_ptr<LogSink> sink);
+
+    /**
+     * @brief Unregisters a sink.
+     *
+     * The sink is not called anymore once this function returns. Messages still queued in asynchronous
+     * mode do not reach it, so call flush first to make sure the sink sees everything logged before.
+     *
+     * @param sink The sink to remove.
+     */
+    static void removeSink(const std::shared_ptr<LogSink>& sink);
+
+    /**
+     * @brief Unregisters all sinks, including the default console sink.
+     */
+    static void clearSinks();
 
 private:
     /**
@@ -87,7 +216,7 @@ private:
      *
      * Ensures proper cleanup of resources upon destruction.
      */
-    ~Logger() = default;
+    ~Logger();
 
     /**
      * @brief Gets the singleton instance of the Logger.
@@ -102,53 +231,88 @@ private:
      * @brief Logs a message with the given log level.
      *
      * Internal implementation of the log function that actually logs the message.
+     * The log level has already been checked by the caller.
      *
      * @param level The log level.
-     * @param message The message to log.
+     * @param format The format string of the message.
+     * @param arguments The arguments of the message, encoded by LogArguments.
      */
-    void logImpl(LogLevel level, const std::string& message);
+    void logImpl(LogLevel level, std::string_view format, std::string_view arguments);
 
     /**
-     * @brief Gets the current date and time as a string.
+     * @brief Starts the background writer thread with a new queue.
      *
-     * Retrieves the current date and time in a formatted string.
-     *
-     * @return The current date and time as a string.
+     * @param capacity The minimum number of messages the queue can hold.
+     * @param policy What to do with messages logged while the queue is full.
      */
-    std::string currentDateTime();
+    void startWriter(std::size_t capacity, OverflowPolicy policy);
 
     /**
-     * @brief Converts a log level to its string representation.
-     *
-     * Converts the specified log level to a string for logging purposes.
+     * @brief Writes all pending messages and stops the background writer thread.
      *
-     * @param level The log level to convert.
-     * @return The string representation of the log level.
+     * Does nothing if the logger is not in asynchronous mode.
      */
-    std::string logLevelToString(LogLevel level);
+    void stopWriter();
 
     /**
-     * @brief Pads the log level string to a consistent length.
+     * @brief Pushes a message to the asynchronous queue, applying the overflow policy if it is full.
      *
-     * Pads the log level string to ensure consistent formatting in log messages.
+     * @param level The log level of the message.
+     * @param time The time the message was logged.
+     * @param format The format string of the message.
+     * @param arguments The arguments of the message, encoded by LogArguments.
+     */
+    void enqueue(LogLevel                              level,
+                 std::chrono::system_clock::time_point time,
+                 std::string_view                      format,
+                 std::string_view                      arguments);
+
+    /**
+     * @brief Wakes the writer thread if it is waiting for new messages.
+     */
+    void wakeWriter();
+
+    /**
+     * @brief The main loop of the background writer thread.
      *
-     * @param logLevel The log level string.
-     * @return The padded log level string.
+     * Pops records from the queue and writes them in batches until the logger leaves asynchronous mode
+     * and the queue is empty.
      */
-    std::string padLogLevel(const std::string& logLevel);
+    void writerLoop();
 
     /**
-     * @brief Gets the color code for the specified log level.
+     * @brief Formats a message and hands it to every registered sink.
      *
-     * Retrieves the ANSI color code associated with the specified log level.
+     * The caller must hold the output mutex.
      *
-     * @param level The log level for which to get the color code.
-     * @return The ANSI color code as a C-string.
+     * @param level The log level of the message.
+     * @param time The time the message was logged.
+     * @param format The format string of the message.
+     * @param arguments The encoded arguments of the message.
+     * @param text A buffer to format the message text in.
      */
-    const char* getColorForLogLevel(LogLevel level);
+    void writeToSinks(LogLevel                              level,
+                      std::chrono::system_clock::time_point time,
+                      std::string_view                      format,
+                      std::string_view                      arguments,
+                      FormatBuffer&                         text);
 
-    LogLevel   m_currentLevel{E2D_LOG_LEVEL_INFO}; //!< The current log level.
-    std::mutex m_mutex;                            //!< Mutex for synchronizing log access.
+    std::atomic<LogLevel>                 m_currentLevel{E2D_LOG_LEVEL_INFO}; //!< The current log level.
+    std::mutex                            m_mutex;                            //!< Mutex for synchronizing log access.
+    std::vector<std::shared_ptr<LogSink>> m_sinks;                            //!< The registered sinks.
+    std::mutex                            m_controlMutex;                     //!< Mutex for switching between modes.
+    std::unique_ptr<internal::LogQueue>   m_queue;                            //!< The queue of asynchronous mode.
+    std::thread                           m_writerThread;                     //!< The background writer thread.
+    OverflowPolicy                        m_overflowPolicy{};                 //!< What to do when the queue is full.
+    std::atomic<bool>                     m_async{false};                     //!< Whether messages are queued.
+    std::atomic<bool>                     m_running{false};                   //!< Whether the writer keeps running.
+    std::atomic<bool>                     m_writerSleeping{false};            //!< Whether the writer thread is idle.
+    std::atomic<std::size_t>              m_activeProducers{0};               //!< Threads pushing to the queue.
+    std::atomic<std::size_t>              m_written{0};                       //!< Records written from the queue.
+    std::atomic<std::size_t>              m_dropped{0};                       //!< Records dropped on overflow.
+    std::mutex                            m_wakeMutex;                        //!< Mutex for the condition variables.
+    std::condition_variable               m_wakeCondition;                    //!< Wakes the writer thread.
+    std::condition_variable               m_flushCondition;                   //!< Wakes threads waiting for a flush.
 
 }; // Logger class
 
@@ -160,15 +324,16 @@ namespace log
  * @brief Logs a debug message.
  *
  * Formats the message with the provided arguments and logs it with the DEBUG log level.
+ * The call compiles to nothing when E2D_LOG_MIN_LEVEL is above the DEBUG level, which is the default in release builds.
  *
  * @tparam Args The types of the arguments to format the message.
- * @param message The message to log, containing placeholders for the arguments.
+ * @param message The message to log, containing one placeholder per argument.
  * @param args The arguments to replace the placeholders in the message.
  *
  * @see Logger
  */
 template <typename... Args>
-inline void debug(const std::string& message, Args&&... args);
+inline void debug(FormatString<sizeof...(Args)> message, Args&&... args);
 
 /**
  * @ingroup core
@@ -177,13 +342,13 @@ inline void debug(const std::string& message, Args&&... args);
  * Formats the message with the provided arguments and logs it with the INFO log level.
  *
  * @tparam Args The types of the arguments to format the message.
- * @param message The message to log, containing placeholders for the arguments.
+ * @param message The message to log, containing one placeholder per argument.
  * @param args The arguments to replace the placeholders in the message.
  *
  * @see Logger
  */
 template <typename... Args>
-inline void info(const std::string& message, Args&&... args);
+inline void info(FormatString<sizeof...(Args)> message, Args&&... args);
 
 /**
  * @ingroup core
@@ -192,13 +357,13 @@ inline void info(const std::string& message, Args&&... args);
  * Formats the message with the provided arguments and logs it with the WARN log level.
  *
  * @tparam Args The types of the arguments to format the message.
- * @param message The message to log, containing placeholders for the arguments.
+ * @param message The message to log, containing one placeholder per argument.
  * @param args The arguments to replace the placeholders in the message.
  *
  * @see Logger
  */
 template <typename... Args>
-inline void warn(const std::string& message, Args&&... args);
+inline void warn(FormatString<sizeof...(Args)> message, Args&&... args);
 
 /**
  * @ingroup core
@@ -207,13 +372,13 @@ inline void warn(const std::string& message, Args&&... args);
  * Formats the message with the provided arguments and logs it with the ERROR log level.
  *
  * @tparam Args The types of the arguments to format the message.
- * @param message The message to log, containing placeholders for the arguments.
+ * @param message The message to log, containing one placeholder per argument.
  * @param args The arguments to replace the placeholders in the message.
  *
  * @see Logger
  */
 template <typename... Args>
-inline void error(const std::string& message, Args&&... args);
+inline void error(FormatString<sizeof...(Args)> message, Args&&... args);
 
 } // namespace log
 
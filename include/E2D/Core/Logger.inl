@@ -25,31 +25,56 @@
 */
 
 template <typename... Args>
-void e2d::Logger::log(LogLevel level, const std::string& message, Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+void e2d::Logger::log(LogLevel                      level,
+                      FormatString<sizeof...(Args)> message,
+                      Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
 {
-    getInstance().logImpl(level, Formatter::format(message, std::forward<Args>(args)...));
+    if (static_cast<int>(level) < E2D_LOG_MIN_LEVEL || !isEnabled(level))
+    {
+        return;
+    }
+
+    FormatBuffer arguments;
+    LogArguments::encode(arguments, args...);
+    getInstance().logImpl(level, message.getView(), arguments.getView());
 }
 
 template <typename... Args>
-void e2d::log::debug(const std::string& message, Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+void e2d::log::debug([[maybe_unused]] FormatString<sizeof...(Args)> message,
+                     [[maybe_unused]] Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
 {
-    Logger::log(E2D_LOG_LEVEL_DEBUG, message, std::forward<Args>(args)...);
+    if constexpr (E2D_LOG_MIN_LEVEL <= static_cast<int>(E2D_LOG_LEVEL_DEBUG))
+    {
+        Logger::log(E2D_LOG_LEVEL_DEBUG, message, std::forward<Args>(args)...);
+    }
 }
 
 template <typename... Args>
-void e2d::log::info(const std::string& message, Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+void e2d::log::info([[maybe_unused]] FormatString<sizeof...(Args)> message,
+                    [[maybe_unused]] Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
 {
-    Logger::log(E2D_LOG_LEVEL_INFO, message, std::forward<Args>(args)...);
+    if constexpr (E2D_LOG_MIN_LEVEL <= static_cast<int>(E2D_LOG_LEVEL_INFO))
+    {
+        Logger::log(E2D_LOG_LEVEL_INFO, message, std::forward<Args>(args)...);
+    }
 }
 
 template <typename... Args>
-void e2d::log::warn(const std::string& message, Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+void e2d::log::warn([[maybe_unused]] FormatString<sizeof...(Args)> message,
+                    [[maybe_unused]] Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
 {
-    Logger::log(E2D_LOG_LEVEL_WARN, message, std::forward<Args>(args)...);
+    if constexpr (E2D_LOG_MIN_LEVEL <= static_cast<int>(E2D_LOG_LEVEL_WARN))
+    {
+        Logger::log(E2D_LOG_LEVEL_WARN, message, std::forward<Args>(args)...);
+    }
 }
 
 template <typename... Args>
-void e2d::log::error(const std::string& message, Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+void e2d::log::error([[maybe_unused]] FormatString<sizeof...(Args)> message,
+                     [[maybe_unused]] Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
 {
-    Logger::log(E2D_LOG_LEVEL_ERROR, message, std::forward<Args>(args)...);
+    if constexpr (E2D_LOG_MIN_LEVEL <= static_cast<int>(E2D_LOG_LEVEL_ERROR))
+    {
+        Logger::log(E2D_LOG_LEVEL_ERROR, message, std::forward<Args>(args)...);
+    }
 }
@@ -0,0 +1,378 @@
+/**
+ * @file Metrics.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_METRICS_HPP
+#define E2D_CORE_METRICS_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace e2d
+{
+
+/**
+ * @class Counter
+ * @ingroup core
+ * @brief A monotonically increasing count of events.
+ *
+ * Increments are spread over a number of shards, each on its own cache line, and every thread
+ * sticks to one shard. Threads counting the same event therefore rarely touch the same memory,
+ * and incrementing never takes a lock. Reading the value sums up all shards.
+ */
+class E2D_CORE_API Counter final : NonCopyable
+{
+public:
+    /**
+     * @brief Constructs a new Counter object with a value of zero.
+     */
+    Counter();
+
+    /**
+     * @brief Adds to the counter.
+     *
+     * @param amount The amount to add.
+     */
+    void increment(std::uint64_t amount = 1);
+
+    /**
+     * @brief Retrieves the value of the counter.
+     *
+     * @return The sum of all increments since construction or the last reset.
+     */
+    std::uint64_t getValue() const;
+
+    /**
+     * @brief Resets the counter to zero.
+     */
+    void reset();
+
+private:
+    static constexpr std::size_t CacheLineSize = 64; //!< The assumed size of a cache line in bytes.
+    static constexpr std::size_t ShardCount    = 16; //!< The number of shards increments are spread over.
+
+    /**
+     * @struct Shard
+     * @brief The part of the count that a group of threads adds to, padded to fill a cache line.
+     */
+    struct Shard
+    {
+        std::atomic<std::uint64_t>                                          value{0};   //!< The partial count.
+        std::array<char, CacheLineSize - sizeof(std::atomic<std::uint64_t>)> padding{}; //!< Keeps shards apart.
+    };
+
+    /**
+     * @brief Retrieves the shard the calling thread increments.
+     *
+     * @return The index of the shard, which is the same for every call on the same thread.
+     */
+    static std::size_t getShardIndex();
+
+    std::array<Shard, ShardCount> m_shards; //!< The partial counts.
+
+}; // class Counter
+
+/**
+ * @class Gauge
+ * @ingroup core
+ * @brief A value that can go up and down, such as the number of objects alive.
+ *
+ * Updates are lock-free.
+ */
+class E2D_CORE_API Gauge final : NonCopyable
+{
+public:
+    /**
+     * @brief Constructs a new Gauge object with a value of zero.
+     */
+    Gauge();
+
+    /**
+     * @brief Sets the value of the gauge.
+     *
+     * @param value The new value.
+     */
+    void set(std::int64_t value);
+
+    /**
+     * @brief Adds to the value of the gauge.
+     *
+     * @param delta The amount to add, negative to subtract.
+     */
+    void add(std::int64_t delta);
+
+    /**
+     * @brief Retrieves the value of the gauge.
+     *
+     * @return The current value.
+     */
+    std::int64_t getValue() const;
+
+private:
+    std::atomic<std::int64_t> m_value{0}; //!< The current value.
+
+}; // class Gauge
+
+/**
+ * @struct HistogramSnapshot
+ * @ingroup core
+ * @brief The distribution of the values recorded by a Histogram at one point in time.
+ *
+ * Percentiles are accurate to within the precision of the histogram.
+ */
+struct HistogramSnapshot
+{
+    std::uint64_t count{0}; //!< The number of recorded values.
+    std::uint64_t sum{0};   //!< The sum of all recorded values.
+    std::uint64_t min{0};   //!< The smallest recorded value, zero if nothing was recorded.
+    std::uint64_t max{0};   //!< The largest recorded value.
+    std::uint64_t p50{0};   //!< The median.
+    std::uint64_t p90{0};   //!< The 90th percentile.
+    std::uint64_t p99{0};   //!< The 99th percentile.
+    std::uint64_t p999{0};  //!< The 99.9th percentile.
+};
+
+/**
+ * @class Histogram
+ * @ingroup core
+ * @brief Records the distribution of values such as latencies.
+ *
+ * Like an HDR histogram, values are counted in buckets whose width grows with the magnitude of the
+ * value: values below 32 get a bucket each, and every power of two above that is split into 16
+ * buckets. This covers the whole range of 64-bit values in under a thousand buckets while keeping
+ * the relative error of every percentile below 6.25%. Recording is lock-free and does not
+ * allocate, which makes it cheap enough to record every frame or every operation.
+ */
+class E2D_CORE_API Histogram final : NonCopyable
+{
+public:
+    /**
+     * @brief Constructs a new, empty Histogram object.
+     */
+    Histogram();
+
+    /**
+     * @brief Records a value.
+     *
+     * @param value The value to record, in the unit of the histogram (for example microseconds).
+     */
+    void record(std::uint64_t value);
+
+    /**
+     * @brief Retrieves the number of recorded values.
+     *
+     * @return The number of values recorded since construction or the last reset.
+     */
+    std::uint64_t getCount() const;
+
+    /**
+     * @brief Retrieves a percentile of the recorded values.
+     *
+     * @param percentile The percentile to retrieve, between 0 and 100.
+     * @return The highest value that is counted in the same bucket as the percentile, or zero if
+     *         nothing was recorded.
+     */
+    std::uint64_t getPercentile(double percentile) const;
+
+    /**
+     * @brief Retrieves the distribution of the recorded values.
+     *
+     * @return A snapshot of the count, sum, extremes and common percentiles.
+     */
+    HistogramSnapshot getSnapshot() const;
+
+    /**
+     * @brief Discards all recorded values.
+     */
+    void reset();
+
+private:
+    static constexpr std::size_t LinearBucketCount = 32;  //!< Values below this get a bucket each.
+    static constexpr std::size_t SubBucketCount    = 16;  //!< The number of buckets per power of two.
+    static constexpr std::size_t BucketCount       = 976; //!< The number of buckets for 64-bit values.
+
+    using Buckets = std::array<std::uint64_t, BucketCount>;
+
+    /**
+     * @brief Retrieves the bucket a value is counted in.
+     *
+     * @param value The value.
+     * @return The index of the bucket.
+     */
+    static std::size_t getBucketIndex(std::uint64_t value);
+
+    /**
+     * @brief Retrieves the highest value that is counted in a bucket.
+     *
+     * @param index The index of the bucket.
+     * @return The highest value of the bucket.
+     */
+    static std::uint64_t getBucketMaximum(std::size_t index);
+
+    /**
+     * @brief Copies the bucket counts.
+     *
+     * @param buckets The array to copy the counts to.
+     * @return The sum of the copied counts.
+     */
+    std::uint64_t loadBuckets(Buckets& buckets) const;
+
+    /**
+     * @brief Finds a percentile in a copy of the bucket counts.
+     *
+     * @param buckets The bucket counts.
+     * @param count The sum of the bucket counts.
+     * @param percentile The percentile to find, between 0 and 100.
+     * @return The highest value of the bucket the percentile is in, at most the recorded maximum.
+     */
+    std::uint64_t findPercentile(const Buckets& buckets, std::uint64_t count, double percentile) const;
+
+    std::array<std::atomic<std::uint64_t>, BucketCount> m_buckets; //!< The number of values per bucket.
+    std::atomic<std::uint64_t>                          m_sum{0};  //!< The sum of all recorded values.
+    std::atomic<std::uint64_t>                          m_min;     //!< The smallest recorded value.
+    std::atomic<std::uint64_t>                          m_max{0};  //!< The largest recorded value.
+
+}; // class Histogram
+
+/**
+ * @struct MetricsSnapshot
+ * @ingroup core
+ * @brief The values of all registered metrics at one point in time, sorted by name.
+ */
+struct MetricsSnapshot
+{
+    std::map<std::string, std::uint64_t>     counters;   //!< The values of the counters.
+    std::map<std::string, std::int64_t>      gauges;     //!< The values of the gauges.
+    std::map<std::string, HistogramSnapshot> histograms; //!< The distributions of the histograms.
+};
+
+/**
+ * @class Metrics
+ * @ingroup core
+ * @brief A process wide registry of named counters, gauges and histograms.
+ *
+ * Metrics are created the first time they are requested and live until the program exits, so the
+ * returned references can be kept, typically in a static local variable, and updated from any
+ * thread without going through the registry again. Only looking up a metric takes a lock.
+ *
+ * The engine registers the following metrics:
+ * - `objects.alive` (gauge): the number of Object instances.
+ * - `renderer.renderables_drawn` (counter): the number of Renderable objects rendered.
+ * - `renderer.draw_calls` (counter): the number of textures copied to the screen.
+ * - `renderer.texture_switches` (counter): the number of draw calls using a different texture than the previous one.
+ * - `renderer.layer_bakes` (counter): the number of times a static RenderLayer was rendered into its cache.
+ * - `renderer.chunk_bakes` (counter): the number of TileMap chunks rendered into their textures.
+ * - `renderer.frames_skipped` (counter): the number of frames not presented by partial redraw, as nothing changed.
+ * - `events.dispatched` (counter): the number of events handed to the active scene.
+ * - `resources.loaded` (counter): the number of resources added to the ResourceRegistry.
+ * - `resources.bytes_loaded` (counter): the size of the files and memory those resources were loaded from.
+ * - `frame.time_us` (histogram): the time each frame took, in microseconds.
+ * - `frame.events_us`, `frame.update_us`, `frame.draw_us`, `frame.render_us` and `frame.clean_us` (histograms):
+ *   the part of each frame spent in the corresponding phase of the main loop, in microseconds. With a frame rate
+ *   limit the update phase includes the time spent waiting for the next frame.
+ */
+class E2D_CORE_API Metrics final : NonCopyable
+{
+public:
+    /**
+     * @brief Retrieves a counter, creating it if it does not exist.
+     *
+     * @param name The name of the counter.
+     * @return The counter, which remains valid until the program exits.
+     */
+    static Counter& getCounter(const std::string& name);
+
+    /**
+     * @brief Retrieves a gauge, creating it if it does not exist.
+     *
+     * @param name The name of the gauge.
+     * @return The gauge, which remains valid until the program exits.
+     */
+    static Gauge& getGauge(const std::string& name);
+
+    /**
+     * @brief Retrieves a histogram, creating it if it does not exist.
+     *
+     * @param name The name of the histogram.
+     * @return The histogram, which remains valid until the program exits.
+     */
+    static Histogram& getHistogram(const std::string& name);
+
+    /**
+     * @brief Retrieves the values of all registered metrics.
+     *
+     * Each metric is read atomically, but metrics updated while the snapshot is taken may be read
+     * before or after the update.
+     *
+     * @return The values of all metrics, for exporting or for assertions in tests.
+     */
+    static MetricsSnapshot getSnapshot();
+
+    /**
+     * @brief Resets all counters and histograms.
+     *
+     * Gauges keep their values since they describe the current state rather than events, and all
+     * metrics stay registered so references to them remain valid.
+     */
+    static void reset();
+
+private:
+    /**
+     * @brief Constructs the Metrics instance.
+     */
+    Metrics();
+
+    /**
+     * @brief Destructor.
+     */
+    ~Metrics();
+
+    /**
+     * @brief Retrieves the single instance of the Metrics class.
+     *
+     * @return The Metrics instance.
+     */
+    static Metrics& getInstance();
+
+    std::mutex                                        m_mutex;      //!< Mutex for synchronizing registration.
+    std::map<std::string, std::unique_ptr<Counter>>   m_counters;   //!< The registered counters.
+    std::map<std::string, std::unique_ptr<Gauge>>     m_gauges;     //!< The registered gauges.
+    std::map<std::string, std::unique_ptr<Histogram>> m_histograms; //!< The registered histograms.
+
+}; // class Metrics
+
+} // namespace e2d
+
+#endif //E2D_CORE_METRICS_HPP
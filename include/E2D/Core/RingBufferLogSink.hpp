@@ -0,0 +1,141 @@
+/**
+ * @file RingBufferLogSink.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_RING_BUFFER_LOG_SINK_HPP
+#define E2D_CORE_RING_BUFFER_LOG_SINK_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/LogSink.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+
+/**
+ * @class RingBufferLogSink
+ * @ingroup core
+ * @brief Keeps the most recent log messages in memory.
+ *
+ * Once the buffer is full, every new message replaces the oldest one. The buffer costs nothing in
+ * I/O while the program runs and can be dumped when something goes wrong, for example from a crash
+ * handler, to see what led up to the problem. enableCrashDump installs such a handler.
+ */
+class E2D_CORE_API RingBufferLogSink final : public LogSink
+{
+public:
+    /**
+     * @brief Constructs a new RingBufferLogSink object.
+     *
+     * @param capacity The number of messages to keep.
+     */
+    explicit RingBufferLogSink(std::size_t capacity = 1024);
+
+    /**
+     * @brief Destructor.
+     *
+     * Disables the crash dump if it was enabled for this sink.
+     */
+    ~RingBufferLogSink() override;
+
+    /**
+     * @brief Stores a message, replacing the oldest one if the buffer is full.
+     *
+     * @param message The message to store.
+     */
+    void write(const LogMessage& message) override;
+
+    /**
+     * @brief Retrieves the stored messages.
+     *
+     * @return The stored messages as formatted lines, from oldest to newest.
+     */
+    std::vector<std::string> getMessages() const;
+
+    /**
+     * @brief Writes the stored messages to a stream, from oldest to newest.
+     *
+     * @param stream The stream to write to.
+     */
+    void dump(std::ostream& stream) const;
+
+    /**
+     * @brief Writes the stored messages to a file, from oldest to newest.
+     *
+     * @param filepath The path of the file to write.
+     * @return True if the file was written successfully, false otherwise.
+     */
+    bool dumpToFile(const std::string& filepath) const;
+
+    /**
+     * @brief Dumps the stored messages to a file when the program crashes.
+     *
+     * Installs a std::terminate handler and handlers for fatal signals that write the buffer to the
+     * file before the program ends. Writing from a signal handler is best effort. Only one sink can
+     * have the crash dump enabled at a time. Messages still queued in asynchronous mode are not included.
+     *
+     * @param filepath The path of the file to write on a crash.
+     */
+    void enableCrashDump(const std::string& filepath);
+
+private:
+    /**
+     * @brief Writes the stored messages to a file without waiting for the lock.
+     *
+     * Used by the crash handlers, where the crashing thread might be holding the lock.
+     *
+     * @param filepath The path of the file to write.
+     */
+    void dumpOnCrash(const char* filepath) const;
+
+    /**
+     * @brief Handles std::terminate by dumping the buffer of the registered sink.
+     */
+    static void onTerminate();
+
+    /**
+     * @brief Handles fatal signals by dumping the buffer of the registered sink.
+     *
+     * @param signal The signal that was raised.
+     */
+    static void onSignal(int signal);
+
+    mutable std::mutex       m_mutex;             //!< Mutex for synchronizing access to the buffer.
+    std::vector<std::string> m_messages;          //!< The stored messages, used as a ring.
+    std::size_t              m_next{0};           //!< The index the next message is stored at.
+    std::size_t              m_count{0};          //!< The number of stored messages.
+    std::string              m_crashDumpFilepath; //!< The file to dump to on a crash.
+
+}; // class RingBufferLogSink
+
+} // namespace e2d
+
+#endif //E2D_CORE_RING_BUFFER_LOG_SINK_HPP
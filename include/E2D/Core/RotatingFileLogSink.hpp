@@ -0,0 +1,117 @@
+/**
+ * @file RotatingFileLogSink.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_ROTATING_FILE_LOG_SINK_HPP
+#define E2D_CORE_ROTATING_FILE_LOG_SINK_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/LogSink.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+namespace e2d
+{
+
+/**
+ * @class RotatingFileLogSink
+ * @ingroup core
+ * @brief Writes log messages to a text file that is rotated when it grows too large.
+ *
+ * Messages are appended to the file until writing the next one would exceed the size limit. The
+ * file is then renamed to "<filepath>.1", any older files are shifted up by one ("<filepath>.1"
+ * becomes "<filepath>.2" and so on), the oldest file beyond the backup limit is deleted, and a new
+ * empty file is started.
+ */
+class E2D_CORE_API RotatingFileLogSink final : public LogSink
+{
+public:
+    /**
+     * @brief Constructs a new RotatingFileLogSink object.
+     *
+     * Opens the file for appending, creating it if it does not exist.
+     *
+     * @param filepath The path of the log file.
+     * @param maxFileSize The maximum size of the log file in bytes.
+     * @param maxBackupFiles The number of rotated files to keep.
+     */
+    explicit RotatingFileLogSink(std::string filepath,
+                                 std::size_t maxFileSize    = 5 * 1024 * 1024,
+                                 std::size_t maxBackupFiles = 3);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~RotatingFileLogSink() override;
+
+    /**
+     * @brief Writes a message to the log file, rotating it first if necessary.
+     *
+     * @param message The message to write.
+     */
+    void write(const LogMessage& message) override;
+
+    /**
+     * @brief Flushes the log file.
+     */
+    void flush() override;
+
+    /**
+     * @brief Checks whether the log file could be opened.
+     *
+     * @return True if messages are written to the file, false otherwise.
+     */
+    bool isOpen() const;
+
+private:
+    /**
+     * @brief Closes the log file, shifts the backup files and opens a new, empty log file.
+     */
+    void rotate();
+
+    /**
+     * @brief Builds the path of a backup file.
+     *
+     * @param index The number of the backup file, starting at 1.
+     * @return The path of the backup file.
+     */
+    std::string getBackupPath(std::size_t index) const;
+
+    std::string   m_filepath;       //!< The path of the log file.
+    std::size_t   m_maxFileSize;    //!< The maximum size of the log file in bytes.
+    std::size_t   m_maxBackupFiles; //!< The number of rotated files to keep.
+    std::size_t   m_fileSize{0};    //!< The current size of the log file in bytes.
+    std::ofstream m_file;           //!< The open log file.
+
+}; // class RotatingFileLogSink
+
+} // namespace e2d
+
+#endif //E2D_CORE_ROTATING_FILE_LOG_SINK_HPP
@@ -31,24 +31,40 @@
 
 #include <E2D/Engine/Application.hpp>
 #include <E2D/Engine/CoreSystem.hpp>
+#include <E2D/Engine/DebugDraw.hpp>
 #include <E2D/Engine/Event.hpp>
 #include <E2D/Engine/Font.hpp>
 #include <E2D/Engine/FontSystem.hpp>
+#include <E2D/Engine/FrameCapture.hpp>
 #include <E2D/Engine/GraphicsSystem.hpp>
 #include <E2D/Engine/Keyboard.hpp>
 #include <E2D/Engine/Object.hpp>
 #include <E2D/Engine/ObjectRegistry.hpp>
+#include <E2D/Engine/ParticleSystem.hpp>
 #include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderCommandBuffer.hpp>
+#include <E2D/Engine/RenderLayer.hpp>
+#include <E2D/Engine/RenderMode.hpp>
+#include <E2D/Engine/RendererSettings.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
 #include <E2D/Engine/Resource.hpp>
 #include <E2D/Engine/ResourceRegistry.hpp>
+#include <E2D/Engine/ScaleFilter.hpp>
 #include <E2D/Engine/Scene.hpp>
 #include <E2D/Engine/SceneManager.hpp>
+#include <E2D/Engine/ShapeRenderer.hpp>
 #include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/SpriteBatch.hpp>
 #include <E2D/Engine/System.hpp>
 #include <E2D/Engine/SystemManager.hpp>
 #include <E2D/Engine/Text.hpp>
 #include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/TextureAtlas.hpp>
+#include <E2D/Engine/TextureRegion.hpp>
+#include <E2D/Engine/TileMap.hpp>
 #include <E2D/Engine/Transformable.hpp>
+#include <E2D/Engine/Vertex.hpp>
+#include <E2D/Engine/WindowSettings.hpp>
 
 #endif //E2D_ENGINE_HPP
 
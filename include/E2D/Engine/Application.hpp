@@ -32,6 +32,12 @@
 #include <E2D/Core/Color.hpp>
 #include <E2D/Core/NonCopyable.hpp>
 
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/RenderMode.hpp>
+#include <E2D/Engine/RendererSettings.hpp>
+#include <E2D/Engine/ScaleFilter.hpp>
+#include <E2D/Engine/WindowSettings.hpp>
+
 #include <memory>
 #include <string>
 
@@ -41,6 +47,13 @@ class ObjectRegistry;   // Forward declaration of ObjectRegistry
 class ResourceRegistry; // Forward declaration of ResourceRegistry
 class SceneManager;     // Forward declaration of SceneManager
 
+namespace internal
+{
+class InputPlayer;           // Forward declaration of InputPlayer
+class InputRecorder;         // Forward declaration of InputRecorder
+class RenderScaleController; // Forward declaration of RenderScaleController
+} // namespace internal
+
 /**
  * @class Application
  * @ingroup engine
@@ -58,9 +71,31 @@ public:
      *
      * Initializes a new instance of the Application class with the specified window title.
      *
+     * In headless mode nothing is shown on screen: frames are rendered by the software renderer
+     * into an offscreen surface, so the application runs on machines without a display or GPU,
+     * such as build and benchmark servers. Combined with frame capturing this allows end-to-end
+     * rendering tests.
+     *
      * @param windowTitle The title of the window.
+     * @param renderMode Whether to render to a window or offscreen.
      */
-    explicit Application(std::string windowTitle);
+    explicit Application(std::string windowTitle, RenderMode renderMode = RenderMode::Windowed);
+
+    /**
+     * @brief Constructs a new Application with the given window and renderer settings.
+     *
+     * The settings are applied when the application starts running. In headless mode only the
+     * window size is used, and frames are always rendered by the software renderer.
+     *
+     * @param windowTitle The title of the window.
+     * @param windowSettings The size and mode of the window.
+     * @param rendererSettings The driver, vsync and hints of the renderer.
+     * @param renderMode Whether to render to a window or offscreen.
+     */
+    Application(std::string      windowTitle,
+                WindowSettings   windowSettings,
+                RendererSettings rendererSettings = {},
+                RenderMode       renderMode       = RenderMode::Windowed);
 
     /**
      * @brief Pure virtual destructor.
@@ -112,6 +147,195 @@ public:
      */
     void setBackgroundColor(const Color& backgroundColor);
 
+    /**
+     * @brief Retrieves the maximum number of frames per second.
+     *
+     * @return The frame rate limit, or 0 if the frame rate is unlimited.
+     */
+    [[nodiscard]] unsigned int getFrameRateLimit() const;
+
+    /**
+     * @brief Sets the maximum number of frames per second.
+     *
+     * With a limit, the remainder of each frame is spent in variable updates until the frame has
+     * taken its share of a second. Without a limit, frames run back to back with a single variable
+     * update each, which is what stress tests and benchmarks measuring raw frame time want.
+     *
+     * @param frameRateLimit The frame rate limit, or 0 for no limit. Defaults to 60.
+     */
+    void setFrameRateLimit(unsigned int frameRateLimit);
+
+    /**
+     * @brief Sets whether only the parts of the window that changed are redrawn.
+     *
+     * Frames are kept in a back buffer, and only the area drawn differently than in the previous
+     * frame is redrawn. Frames in which nothing changed are not presented at all, which saves power
+     * in scenes that are mostly still, such as menus. Frames still follow the frame rate limit.
+     * Renderables must submit their draws to the renderer instead of calling SDL directly.
+     *
+     * @param enabled True to redraw only what changed, false to redraw the whole window every frame.
+     */
+    void setPartialRedraw(bool enabled);
+
+    /**
+     * @brief Checks whether only the parts of the window that changed are redrawn.
+     *
+     * @return True if partial redraw is enabled, false otherwise.
+     */
+    [[nodiscard]] bool isPartialRedraw() const;
+
+    /**
+     * @brief Sets the fraction of the window size frames are drawn at.
+     *
+     * Below 1, frames are drawn into a texture of that fraction of the window size and stretched onto
+     * the window, drawing fewer pixels at the cost of sharpness. Objects keep drawing in window
+     * coordinates. With a render time budget, the render scale changes on its own from this value on.
+     *
+     * @param renderScale The render scale, clamped between 0.25 and 1.
+     */
+    void setRenderScale(float renderScale);
+
+    /**
+     * @brief Retrieves the fraction of the window size frames are drawn at.
+     *
+     * @return The render scale, as last chosen to keep within the render time budget if there is one.
+     */
+    [[nodiscard]] float getRenderScale() const;
+
+    /**
+     * @brief Sets how frames drawn at a reduced render scale are stretched onto the window.
+     *
+     * @param scaleFilter ScaleFilter::Nearest for sharp, blocky pixels, ScaleFilter::Linear for smooth ones.
+     */
+    void setRenderScaleFilter(ScaleFilter scaleFilter);
+
+    /**
+     * @brief Retrieves how frames drawn at a reduced render scale are stretched onto the window.
+     *
+     * @return The scale filter.
+     */
+    [[nodiscard]] ScaleFilter getRenderScaleFilter() const;
+
+    /**
+     * @brief Sets the time each frame may take, changing the render scale to keep within it.
+     *
+     * The frame time is measured from the start of one iteration of the main loop to the start of the
+     * next, so it covers updates and the wait for the frame rate limit as well as rendering, averaged
+     * over a number of frames. Over budget, the render scale is lowered, down to 0.25. Well within
+     * budget, it is raised again, up to 1, so with a frame rate limit the budget has to leave room
+     * above the limited frame time for the scale to recover. This keeps the frame rate steady on
+     * machines that cannot fill the whole window every frame, such as those falling back to software
+     * rendering.
+     *
+     * @param budget The budget in seconds, or 0 to keep the render scale as set.
+     */
+    void setRenderTimeBudget(double budget);
+
+    /**
+     * @brief Retrieves the time each frame may take.
+     *
+     * @return The budget in seconds, or 0 if the render scale is kept as set.
+     */
+    [[nodiscard]] double getRenderTimeBudget() const;
+
+    /**
+     * @brief Starts recording the input of every frame to a file.
+     *
+     * Each frame stores the events handed to the active scene and the time its variable updates
+     * consumed. Frames run as they do without recording, including the variable updates that fill up
+     * the time of a frame under a frame rate limit. Recording stops when the application quits.
+     *
+     * @param filepath The path of the file to record to. An existing file is overwritten.
+     * @return True if recording started, false if the file could not be opened.
+     */
+    bool startRecording(const std::string& filepath);
+
+    /**
+     * @brief Stops recording input and closes the recording.
+     */
+    void stopRecording();
+
+    /**
+     * @brief Checks whether input is being recorded.
+     *
+     * @return True if input is being recorded, false otherwise.
+     */
+    [[nodiscard]] bool isRecording() const;
+
+    /**
+     * @brief Starts replaying input recorded with startRecording.
+     *
+     * Every frame hands the events of the next recorded frame to the active scene and passes the
+     * recorded time to its variable update, regardless of how long the frame actually took. The time
+     * goes through the same frame rate limit as live frames, but is spent in a single variable update,
+     * and the frame sleeps for the rest of it. Scenes that only depend on their input and the total
+     * time they are given therefore see the recorded frames again. Live input is ignored, except for
+     * closing the window. The application quits once the last recorded frame has been replayed.
+     * Combined with the headless render mode and no frame rate limit, this runs a recorded play
+     * session as fast as possible with the same frames every time.
+     *
+     * @param filepath The path of the recording to replay.
+     * @return True if the replay started, false if the file could not be read or is not a recording.
+     */
+    bool startReplay(const std::string& filepath);
+
+    /**
+     * @brief Stops replaying input and returns to live input.
+     */
+    void stopReplay();
+
+    /**
+     * @brief Checks whether recorded input is being replayed.
+     *
+     * @return True if recorded input is being replayed, false otherwise.
+     */
+    [[nodiscard]] bool isReplaying() const;
+
+    /**
+     * @brief Retrieves the render mode the application was constructed with.
+     *
+     * @return Whether the application renders to a window or offscreen.
+     */
+    [[nodiscard]] RenderMode getRenderMode() const;
+
+    /**
+     * @brief Retrieves the window settings the application was constructed with.
+     *
+     * @return The size and mode of the window.
+     */
+    [[nodiscard]] const WindowSettings& getWindowSettings() const;
+
+    /**
+     * @brief Retrieves the renderer settings the application was constructed with.
+     *
+     * @return The driver, vsync and hints of the renderer.
+     */
+    [[nodiscard]] const RendererSettings& getRendererSettings() const;
+
+    /**
+     * @brief Enables or disables reading every rendered frame back to memory.
+     *
+     * Reading back a frame waits for rendering to finish, so capturing is meant for tests and
+     * tools rather than for regular play.
+     *
+     * @param enabled True to capture every frame, false to stop capturing.
+     */
+    void setFrameCaptureEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether rendered frames are read back to memory.
+     *
+     * @return True if frames are captured, false otherwise.
+     */
+    [[nodiscard]] bool isFrameCaptureEnabled() const;
+
+    /**
+     * @brief Retrieves the last captured frame.
+     *
+     * @return The last frame rendered while capturing was enabled, or an empty capture if there is none.
+     */
+    [[nodiscard]] const FrameCapture& getCapturedFrame() const;
+
 protected:
     /**
      * @brief Gets the SceneManager instance used by the application.
@@ -131,11 +355,21 @@ protected:
     virtual void onRunning();
 
 private:
-    int               m_exitCode = 0;     //!< The exit code of the application.
-    bool              m_running  = false; //!< Flag indicating whether the application is running.
-    const std::string m_windowTitle;      //!< The title of the window.
+    int               m_exitCode          = 0;     //!< The exit code of the application.
+    bool              m_running           = false; //!< Flag indicating whether the application is running.
+    unsigned int      m_frameRateLimit    = 60;    //!< The maximum number of frames per second, or 0 for no limit.
+    bool              m_partialRedraw     = false; //!< Whether only the parts of the window that changed are redrawn.
+    float             m_renderScale       = 1;     //!< The fraction of the window size frames are drawn at.
+    ScaleFilter       m_renderScaleFilter = ScaleFilter::Linear; //!< How frames are stretched onto the window.
+    const std::string m_windowTitle;               //!< The title of the window.
+    const RenderMode  m_renderMode;                //!< Whether the application renders to a window or offscreen.
+    const WindowSettings   m_windowSettings;   //!< The size and mode of the window.
+    const RendererSettings m_rendererSettings; //!< The driver, vsync and hints of the renderer.
     std::unique_ptr<SceneManager> m_sceneManager; //!< Pointer to the SceneManager responsible for handling scenes within the application.
     Color                         m_backgroundColor; //!< The background color of the window.
+    std::unique_ptr<internal::InputRecorder> m_inputRecorder; //!< Records the input, or nullptr if not recording.
+    std::unique_ptr<internal::InputPlayer>   m_inputPlayer;   //!< Replays input, or nullptr if not replaying.
+    std::unique_ptr<internal::RenderScaleController> m_renderScaleController; //!< Keeps rendering within budget.
 
 }; // class Application
 
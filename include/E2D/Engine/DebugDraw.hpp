@@ -0,0 +1,141 @@
+/**
+ * @file DebugDraw.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_DEBUG_DRAW_HPP
+#define E2D_ENGINE_DEBUG_DRAW_HPP
+
+#include <E2D/Config.hpp>
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/ShapeRenderer.hpp>
+
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+
+/**
+ * @class DebugDraw
+ * @ingroup engine
+ * @brief A shape renderer for debug overlays, such as collision shapes and AI paths, that release builds leave out.
+ *
+ * The drawing functions compile to nothing unless E2D_DEBUG_DRAW is 1, which it is by default in debug
+ * builds only, so overlays can stay in the code without costing anything in release builds. The check
+ * happens where the functions are called, so it follows the configuration of the program rather than
+ * the one E2D was built with. For the same reason, the class is defined entirely in its header.
+ *
+ * A debug draw is rendered above everything else by default.
+ */
+class DebugDraw final : public ShapeRenderer
+{
+public:
+    /**
+     * @brief Constructs a new DebugDraw object, rendered at the highest render priority.
+     */
+    DebugDraw();
+
+    /**
+     * @brief Constructs a new DebugDraw object with a specific identifier, rendered at the highest render priority.
+     *
+     * @param identifier A string representing the unique identifier of the debug draw.
+     */
+    explicit DebugDraw(const std::string& identifier);
+
+    /**
+     * @brief Destructor.
+     */
+    ~DebugDraw() final;
+
+    /**
+     * @brief Draws a line, if debug drawing is compiled in.
+     *
+     * @param from The start of the line, in pixels.
+     * @param to The end of the line, in pixels.
+     * @param color The color of the line.
+     */
+    void drawLine(const Vector2f& from, const Vector2f& to, const Color& color);
+
+    /**
+     * @brief Draws the outline of a rectangle, if debug drawing is compiled in.
+     *
+     * @param rectangle The rectangle, in pixels.
+     * @param color The color of the outline.
+     */
+    void drawRect(const FloatRect& rectangle, const Color& color);
+
+    /**
+     * @brief Draws a filled rectangle, if debug drawing is compiled in.
+     *
+     * @param rectangle The rectangle, in pixels.
+     * @param color The color of the rectangle.
+     */
+    void fillRect(const FloatRect& rectangle, const Color& color);
+
+    /**
+     * @brief Draws the outline of a circle, if debug drawing is compiled in.
+     *
+     * @param center The center of the circle, in pixels.
+     * @param radius The radius of the circle, in pixels.
+     * @param color The color of the outline.
+     */
+    void drawCircle(const Vector2f& center, float radius, const Color& color);
+
+    /**
+     * @brief Draws a filled circle, if debug drawing is compiled in.
+     *
+     * @param center The center of the circle, in pixels.
+     * @param radius The radius of the circle, in pixels.
+     * @param color The color of the circle.
+     */
+    void fillCircle(const Vector2f& center, float radius, const Color& color);
+
+    /**
+     * @brief Draws the outline of a polygon, if debug drawing is compiled in.
+     *
+     * @param points The corners of the polygon, in pixels.
+     * @param color The color of the outline.
+     */
+    void drawPolygon(const std::vector<Vector2f>& points, const Color& color);
+
+    /**
+     * @brief Draws a filled convex polygon, if debug drawing is compiled in.
+     *
+     * @param points The corners of the polygon in order around it, in pixels.
+     * @param color The color of the polygon.
+     */
+    void fillPolygon(const std::vector<Vector2f>& points, const Color& color);
+
+}; // class DebugDraw
+
+} // namespace e2d
+
+#include <E2D/Engine/DebugDraw.inl>
+
+#endif //E2D_ENGINE_DEBUG_DRAW_HPP
@@ -0,0 +1,112 @@
+/**
+ * @file DebugDraw.inl
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <limits>
+
+inline e2d::DebugDraw::DebugDraw()
+{
+    log::debug("Constructing DebugDraw");
+    this->setRenderPriority(std::numeric_limits<int>::max());
+}
+
+inline e2d::DebugDraw::DebugDraw(const std::string& identifier) : e2d::ShapeRenderer(identifier)
+{
+    log::debug("Constructing DebugDraw with identifier '{}'", identifier);
+    this->setRenderPriority(std::numeric_limits<int>::max());
+}
+
+inline e2d::DebugDraw::~DebugDraw()
+{
+    log::debug("Destructing DebugDraw");
+}
+
+inline void e2d::DebugDraw::drawLine([[maybe_unused]] const Vector2f& from,
+                                     [[maybe_unused]] const Vector2f& to,
+                                     [[maybe_unused]] const Color&    color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::drawLine(from, to, color);
+    }
+}
+
+inline void e2d::DebugDraw::drawRect([[maybe_unused]] const FloatRect& rectangle,
+                                     [[maybe_unused]] const Color&     color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::drawRect(rectangle, color);
+    }
+}
+
+inline void e2d::DebugDraw::fillRect([[maybe_unused]] const FloatRect& rectangle,
+                                     [[maybe_unused]] const Color&     color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::fillRect(rectangle, color);
+    }
+}
+
+inline void e2d::DebugDraw::drawCircle([[maybe_unused]] const Vector2f& center,
+                                       [[maybe_unused]] float           radius,
+                                       [[maybe_unused]] const Color&    color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::drawCircle(center, radius, color);
+    }
+}
+
+inline void e2d::DebugDraw::fillCircle([[maybe_unused]] const Vector2f& center,
+                                       [[maybe_unused]] float           radius,
+                                       [[maybe_unused]] const Color&    color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::fillCircle(center, radius, color);
+    }
+}
+
+inline void e2d::DebugDraw::drawPolygon([[maybe_unused]] const std::vector<Vector2f>& points,
+                                        [[maybe_unused]] const Color&                 color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::drawPolygon(points, color);
+    }
+}
+
+inline void e2d::DebugDraw::fillPolygon([[maybe_unused]] const std::vector<Vector2f>& points,
+                                        [[maybe_unused]] const Color&                 color)
+{
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        ShapeRenderer::fillPolygon(points, color);
+    }
+}
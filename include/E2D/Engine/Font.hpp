@@ -90,6 +90,27 @@ public:
      */
     bool loadFromMemory(const void* data, std::size_t size) final;
 
+    /**
+     * @brief Reads a font file, deferring the replacement of the font data to the render thread.
+     *
+     * The file is read on the calling thread. The returned function replaces the current font data
+     * and must be invoked on the render thread.
+     *
+     * @param filepath Path to the font file.
+     * @return A function replacing the font data, or an empty function if the file could not be read.
+     */
+    std::function<bool()> prepareFromFile(const std::string& filepath) final;
+
+    /**
+     * @brief Retrieves the revision of the font data.
+     *
+     * The revision is incremented every time the font is (re)loaded, allowing users such as Text
+     * to detect that they need to render their text again.
+     *
+     * @return The revision of the font data.
+     */
+    unsigned int getRevision() const;
+
     /**
      * @brief Retrieves a handle to the native font object.
      *
@@ -101,7 +122,8 @@ public:
     void* getNativeFontHandle(unsigned int fontSize) const;
 
 private:
-    std::unique_ptr<internal::FontImpl> m_fontImpl; //!< Pointer to the font implementation.
+    std::unique_ptr<internal::FontImpl> m_fontImpl;    //!< Pointer to the font implementation.
+    unsigned int                        m_revision{0}; //!< Incremented every time the font is loaded.
 
 }; // Font class
 
@@ -0,0 +1,73 @@
+/**
+ * @file FrameCapture.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_FRAME_CAPTURE_HPP
+#define E2D_ENGINE_FRAME_CAPTURE_HPP
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace e2d
+{
+
+/**
+ * @struct FrameCapture
+ * @ingroup engine
+ * @brief The pixels of a rendered frame, read back to memory.
+ *
+ * Pixels are stored row by row from the top left corner, with four bytes per pixel in red, green,
+ * blue and alpha order. This makes the capture straightforward to compare against a golden image
+ * or to write to an image file.
+ */
+struct FrameCapture
+{
+    /**
+     * @brief Retrieves the color of a single pixel.
+     *
+     * @param x The column of the pixel.
+     * @param y The row of the pixel.
+     * @return The color of the pixel.
+     */
+    Color getPixel(int x, int y) const
+    {
+        const auto index = (static_cast<std::size_t>(y) * static_cast<std::size_t>(this->size.x) +
+                            static_cast<std::size_t>(x)) *
+                           4;
+        return {this->pixels[index], this->pixels[index + 1], this->pixels[index + 2], this->pixels[index + 3]};
+    }
+
+    Vector2i                  size;     //!< The size of the frame in pixels.
+    std::vector<std::uint8_t> pixels;   //!< The RGBA bytes of the frame, row by row.
+    std::uint64_t             frame{0}; //!< The number of the frame, counting from one.
+};
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_FRAME_CAPTURE_HPP
@@ -27,7 +27,12 @@
 #ifndef E2D_ENGINE_GRAPHICS_SYSTEM_HPP
 #define E2D_ENGINE_GRAPHICS_SYSTEM_HPP
 
+#include <E2D/Engine/RenderMode.hpp>
+#include <E2D/Engine/RendererSettings.hpp>
 #include <E2D/Engine/System.hpp>
+#include <E2D/Engine/WindowSettings.hpp>
+
+#include <string>
 
 namespace e2d
 {
@@ -51,8 +56,16 @@ public:
      * Initializes a new instance of the GraphicsSystem class. This constructor
      * sets up the initial state for the graphics system but does not initialize
      * any SDL subsystems.
+     *
+     * @param renderMode Whether to render to a window or offscreen.
+     * @param windowTitle The title of the window.
+     * @param windowSettings The size and mode of the window.
+     * @param rendererSettings The driver, vsync and hints of the renderer.
      */
-    GraphicsSystem();
+    explicit GraphicsSystem(RenderMode       renderMode       = RenderMode::Windowed,
+                            std::string      windowTitle      = "E2D",
+                            WindowSettings   windowSettings   = {},
+                            RendererSettings rendererSettings = {});
 
     /**
      * @brief Destructor.
@@ -69,6 +82,8 @@ public:
      * Initializes the SDL video subsystem, which is required for rendering
      * graphics, and the SDL image subsystem for handling various image formats.
      * Additionally, it initializes the renderer context used for drawing operations.
+     * In headless mode SDL's dummy video driver is selected, unless the `SDL_VIDEODRIVER`
+     * environment variable says otherwise, so that no display is needed.
      *
      * @return True if all subsystems were successfully initialized, false otherwise.
      */
@@ -82,6 +97,12 @@ public:
      */
     void shutdown() final;
 
+private:
+    RenderMode       m_renderMode;       //!< Whether to render to a window or offscreen.
+    std::string      m_windowTitle;      //!< The title of the window.
+    WindowSettings   m_windowSettings;   //!< The size and mode of the window.
+    RendererSettings m_rendererSettings; //!< The driver, vsync and hints of the renderer.
+
 }; // class GraphicsSystem
 
 } // namespace e2d
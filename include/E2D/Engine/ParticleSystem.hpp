@@ -0,0 +1,314 @@
+/**
+ * @file ParticleSystem.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_PARTICLE_SYSTEM_HPP
+#define E2D_ENGINE_PARTICLE_SYSTEM_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/Object.hpp>
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/TextureRegion.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+class Texture; // Forward declaration of Texture
+
+namespace internal
+{
+struct RenderSnapshot; // Forward declaration of RenderSnapshot
+} // namespace internal
+
+/**
+ * @struct ParticleEmitter
+ * @ingroup engine
+ * @brief Describes where new particles appear and how they start out.
+ *
+ * Each new particle picks its values uniformly at random from the given ranges.
+ */
+struct ParticleEmitter
+{
+    Vector2f position;            //!< The center of the area particles appear in, in pixels.
+    Vector2f area;                //!< The size of the area particles appear in, in pixels.
+    float    direction{0};        //!< The direction particles move in, in degrees clockwise from the x axis.
+    float    spread{360};         //!< The range of directions around direction, in degrees.
+    float    minSpeed{50};        //!< The lowest initial speed, in pixels per second.
+    float    maxSpeed{100};       //!< The highest initial speed, in pixels per second.
+    float    minLifetime{1};      //!< The shortest time a particle lives, in seconds.
+    float    maxLifetime{1};      //!< The longest time a particle lives, in seconds.
+    float    minSize{4};          //!< The smallest width and height of a particle, in pixels.
+    float    maxSize{4};          //!< The largest width and height of a particle, in pixels.
+    Color    color{Color::White}; //!< The color of new particles.
+};
+
+/**
+ * @class ParticleSystem
+ * @ingroup engine
+ * @brief Simulates and draws large numbers of short-lived square particles.
+ *
+ * Particles are not objects of their own. The system keeps each of their properties in a separate
+ * array, which the update loops run over with SIMD instructions where the compiler targets them,
+ * and draws all particles with a single geometry draw call. Particles are positioned on the screen
+ * directly; they do not move along with anything once emitted.
+ *
+ * Particles are emitted continuously at the emission rate, and in bursts with burst(). Once the
+ * capacity is reached, no new particles are emitted until others have expired.
+ */
+class E2D_ENGINE_API ParticleSystem : public Object, public Renderable
+{
+public:
+    /**
+     * @brief Constructs a new ParticleSystem object.
+     *
+     * The system has a capacity of 10000 particles and does not emit any until told to.
+     */
+    ParticleSystem();
+
+    /**
+     * @brief Constructs a new ParticleSystem object with a specific identifier.
+     *
+     * @param identifier A string representing the unique identifier of the particle system.
+     */
+    explicit ParticleSystem(const std::string& identifier);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~ParticleSystem() override;
+
+    /**
+     * @brief Sets the texture drawn on each particle.
+     *
+     * Without a texture, particles are drawn as squares of their color.
+     *
+     * @param texture Shared pointer to the texture, or null to draw plain squares.
+     */
+    void setTexture(const std::shared_ptr<const Texture>& texture);
+
+    /**
+     * @brief Sets a region of a texture, typically a TextureAtlas page, as the texture drawn on each particle.
+     *
+     * @param region The texture region to use.
+     */
+    void setTexture(const TextureRegion& region);
+
+    /**
+     * @brief Retrieves the texture drawn on each particle.
+     *
+     * @return Shared pointer to the texture, or null if none is set.
+     */
+    std::shared_ptr<const Texture> getTexture() const;
+
+    /**
+     * @brief Sets how new particles are emitted.
+     *
+     * Particles already emitted are not affected.
+     *
+     * @param emitter The description of new particles.
+     */
+    void setEmitter(const ParticleEmitter& emitter);
+
+    /**
+     * @brief Retrieves how new particles are emitted.
+     *
+     * @return The description of new particles.
+     */
+    const ParticleEmitter& getEmitter() const;
+
+    /**
+     * @brief Sets the number of particles emitted continuously.
+     *
+     * @param particlesPerSecond The number of particles emitted each second, or zero to only emit bursts.
+     */
+    void setEmissionRate(float particlesPerSecond);
+
+    /**
+     * @brief Retrieves the number of particles emitted continuously.
+     *
+     * @return The number of particles emitted each second.
+     */
+    float getEmissionRate() const;
+
+    /**
+     * @brief Sets the acceleration applied to all particles, such as gravity.
+     *
+     * @param acceleration The acceleration, in pixels per second squared.
+     */
+    void setAcceleration(const Vector2f& acceleration);
+
+    /**
+     * @brief Retrieves the acceleration applied to all particles.
+     *
+     * @return The acceleration, in pixels per second squared.
+     */
+    const Vector2f& getAcceleration() const;
+
+    /**
+     * @brief Sets whether particles fade out as they age.
+     *
+     * @param fadeOut True to decrease the opacity of particles linearly to zero over their lifetime.
+     */
+    void setFadeOut(bool fadeOut);
+
+    /**
+     * @brief Checks whether particles fade out as they age.
+     *
+     * @return True if particles fade out, false otherwise.
+     */
+    bool isFadingOut() const;
+
+    /**
+     * @brief Sets the largest number of particles alive at once.
+     *
+     * Lowering the capacity below the number of particles alive removes the most recently emitted ones.
+     *
+     * @param capacity The largest number of particles.
+     */
+    void setCapacity(std::size_t capacity);
+
+    /**
+     * @brief Retrieves the largest number of particles alive at once.
+     *
+     * @return The capacity.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * @brief Seeds the random number generator new particles are picked with.
+     *
+     * Useful to get the same particles again, for example when replaying a recording.
+     *
+     * @param seed The seed.
+     */
+    void setSeed(std::uint32_t seed);
+
+    /**
+     * @brief Emits a number of particles at once.
+     *
+     * @param count The number of particles to emit.
+     * @return The number of particles emitted, which is lower than count if the capacity is reached.
+     */
+    std::size_t burst(std::size_t count);
+
+    /**
+     * @brief Removes all particles.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the number of particles alive.
+     *
+     * @return The number of particles.
+     */
+    std::size_t getCount() const;
+
+    /**
+     * @brief Advances the particles and emits new ones.
+     *
+     * Called by onVariableUpdate(), and can be called directly for a system that is not part of a scene.
+     *
+     * @param deltaTime The time to advance by, in seconds.
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Fixed update method for consistent, time-sensitive updates.
+     */
+    void onFixedUpdate() override;
+
+    /**
+     * @brief Variable update method for frame-dependent updates.
+     *
+     * Advances the particles by the elapsed time.
+     *
+     * @param deltaTime The time elapsed since the last variable update in seconds.
+     */
+    void onVariableUpdate(double deltaTime) override;
+
+    /**
+     * @brief Draws all particles with a single geometry draw call.
+     */
+    void render() const final;
+
+protected:
+    /**
+     * @brief Gets the revision of the texture, so that static layers notice its pixels changing.
+     *
+     * @return The revision of the texture, or 0 if there is none.
+     */
+    unsigned int getContentRevision() const final;
+
+private:
+    /**
+     * @brief Removes expired particles, moving the last particles into their place.
+     */
+    void removeExpired();
+
+    /**
+     * @brief Resizes every particle array.
+     *
+     * @param count The number of particles.
+     */
+    void resize(std::size_t count);
+
+    std::shared_ptr<const Texture>                    m_texture;              //!< The texture drawn on each particle.
+    IntRect                                           m_textureRect;          //!< The area of the texture drawn.
+    bool                                              m_textureRegion{false}; //!< Whether the texture rect is used.
+    ParticleEmitter                                   m_emitter;              //!< How new particles are emitted.
+    float                                             m_emissionRate{0};      //!< The particles emitted each second.
+    float                                             m_emissionDebt{0};      //!< The fraction of a particle due.
+    Vector2f                                          m_acceleration;         //!< The acceleration of all particles.
+    bool                                              m_fadeOut{true};        //!< Whether particles fade out.
+    std::size_t                                       m_capacity{10000};      //!< The largest number of particles.
+    std::minstd_rand                                  m_random;               //!< Picks the values of new particles.
+    std::vector<float>                                m_positionsX;           //!< The horizontal positions.
+    std::vector<float>                                m_positionsY;           //!< The vertical positions.
+    std::vector<float>                                m_velocitiesX;          //!< The horizontal velocities.
+    std::vector<float>                                m_velocitiesY;          //!< The vertical velocities.
+    std::vector<float>                                m_remaining;            //!< The time left to live, in seconds.
+    std::vector<float>                                m_inverseLifetimes;     //!< One over the total lifetimes.
+    std::vector<float>                                m_sizes;                //!< The widths and heights.
+    std::vector<Color>                                m_colors;               //!< The colors.
+    mutable std::unique_ptr<internal::RenderSnapshot> m_geometry;             //!< The vertices of the last frame.
+
+}; // class ParticleSystem
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_PARTICLE_SYSTEM_HPP
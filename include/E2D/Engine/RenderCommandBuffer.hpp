@@ -0,0 +1,161 @@
+/**
+ * @file RenderCommandBuffer.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_RENDER_COMMAND_BUFFER_HPP
+#define E2D_ENGINE_RENDER_COMMAND_BUFFER_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+#include <E2D/Core/Rect.hpp>
+
+#include <E2D/Engine/Vertex.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace e2d
+{
+class Sprite;  // Forward declaration of Sprite
+class Text;    // Forward declaration of Text
+class Texture; // Forward declaration of Texture
+
+namespace internal
+{
+class Renderer;        // Forward declaration of Renderer
+struct RenderSnapshot; // Forward declaration of RenderSnapshot
+} // namespace internal
+
+/**
+ * @class RenderCommandBuffer
+ * @ingroup engine
+ * @brief Records draw commands away from the main thread, to be submitted for rendering later.
+ *
+ * Recording resolves everything a draw needs, such as the transformed destination of a sprite or
+ * the vertices of a shape, without calling into the renderer. Worker threads can therefore each
+ * fill a buffer of their own for a disjoint range of objects in parallel, while the main thread
+ * submits the buffers to the scene once the workers are done.
+ *
+ * A buffer must only be used by one thread at a time, and the objects recorded must not change
+ * while they are being recorded. When a frame is rendered, the commands of all submitted buffers are
+ * merged and stable sorted by render priority, in the order the buffers were submitted, and drawn
+ * after the renderables of the scene with the same priority.
+ */
+class E2D_ENGINE_API RenderCommandBuffer final : NonCopyable
+{
+    friend class internal::Renderer;
+
+public:
+    /**
+     * @brief Constructs a new RenderCommandBuffer object.
+     *
+     * Initializes an empty buffer with no clip rectangle.
+     */
+    RenderCommandBuffer();
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~RenderCommandBuffer();
+
+    /**
+     * @brief Records a sprite, with its current texture, transformations and render priority.
+     *
+     * Nothing is recorded if the sprite has no texture.
+     *
+     * @param sprite The sprite to draw.
+     */
+    void drawSprite(const Sprite& sprite);
+
+    /**
+     * @brief Records a text, with its current texture, transformations and render priority.
+     *
+     * Nothing is recorded if the text has not been rendered to a texture yet.
+     *
+     * @param text The text to draw.
+     */
+    void drawText(const Text& text);
+
+    /**
+     * @brief Records triangles, optionally mapped with a texture.
+     *
+     * Without indices, every three vertices form a triangle. With indices, every three indices into
+     * the vertices form a triangle, so that shared corners are only stored once.
+     *
+     * @param texture The texture to map onto the triangles, or nullptr to only use the vertex colors.
+     * @param vertices The corners of the triangles.
+     * @param indices The indices of the vertices of each triangle, or empty to use the vertices in order.
+     * @param renderPriority The render priority of the triangles.
+     */
+    void drawGeometry(const std::shared_ptr<const Texture>& texture,
+                      const std::vector<Vertex>&            vertices,
+                      const std::vector<int>&               indices        = {},
+                      int                                   renderPriority = 0);
+
+    /**
+     * @brief Limits the commands recorded from now on to an area of the screen.
+     *
+     * @param rectangle The area of the screen to draw to, in pixels.
+     */
+    void setClip(const IntRect& rectangle);
+
+    /**
+     * @brief Lets the commands recorded from now on draw to the whole screen again.
+     */
+    void resetClip();
+
+    /**
+     * @brief Removes all recorded commands and the clip rectangle, keeping the allocated memory.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the number of recorded commands.
+     *
+     * @return The number of draw commands in the buffer.
+     */
+    std::size_t getCommandCount() const;
+
+    /**
+     * @brief Checks whether no commands are recorded.
+     *
+     * @return True if the buffer is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+private:
+    std::unique_ptr<internal::RenderSnapshot> m_commands;       //!< The recorded commands and their geometry.
+    IntRect                                   m_clip;           //!< The clip rectangle of new commands.
+    bool                                      m_clipped{false}; //!< Whether new commands are clipped.
+
+}; // class RenderCommandBuffer
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_RENDER_COMMAND_BUFFER_HPP
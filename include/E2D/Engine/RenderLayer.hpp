@@ -0,0 +1,236 @@
+/**
+ * @file RenderLayer.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_RENDER_LAYER_HPP
+#define E2D_ENGINE_RENDER_LAYER_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+class Transformable; // Forward declaration of Transformable
+
+/**
+ * @class RenderLayer
+ * @ingroup engine
+ * @brief A group of renderables drawn together at the render priority of the layer.
+ *
+ * Layers are created by a scene with Scene::createLayer(). Renderables added to a layer are no longer
+ * drawn on their own, but by the layer, in the order given by the sort mode of the layer, which is
+ * their render priority by default.
+ *
+ * Sorting keeps the order of the previous frame and repairs it with an insertion sort, which takes
+ * close to linear time when only a few renderables change places, as when characters of a top-down
+ * game sorted by their Y position walk past each other. Renderables with equal keys keep their order.
+ *
+ * A static layer is rendered into a render texture covering the screen once, and from then on drawn
+ * as that single texture, without drawing its renderables at all. Rather than finding out what its
+ * renderables would draw every frame, the layer relies on revisions and on being told about changes:
+ * its cache is rendered again when a renderable is added or removed, a transformable renderable is
+ * moved, scaled or rotated, the content revision of a renderable changes, such as when the pixels of
+ * its texture are drawn into or reloaded, or a renderable calls Renderable::invalidateLayer(). The
+ * renderables of the engine do so when their contents, such as their texture, text, tiles or render
+ * priority, are set. Anything else that changes what is drawn, such as a renderable of the game
+ * drawing differently or a custom sort key depending on more than the transform, needs a call to
+ * invalidate().
+ */
+class E2D_ENGINE_API RenderLayer final : public Renderable
+{
+public:
+    /**
+     * @brief The order in which the renderables of a layer are drawn.
+     */
+    enum class SortMode
+    {
+        None,      //!< In the order they were added.
+        Priority,  //!< By ascending render priority.
+        PositionY, //!< By ascending Y position, so that lower renderables are drawn on top.
+        Custom,    //!< By ascending key, as given by the function set with setSortKey().
+    };
+
+    /**
+     * @brief A function giving the key to sort a renderable by.
+     */
+    using SortKey = std::function<float(const Renderable&)>;
+
+    /**
+     * @brief Constructs a new RenderLayer object.
+     *
+     * @param name The name of the layer.
+     */
+    explicit RenderLayer(std::string name);
+
+    /**
+     * @brief Destructor.
+     *
+     * Renderables still in the layer are drawn on their own again.
+     */
+    ~RenderLayer() final;
+
+    /**
+     * @brief Retrieves the name of the layer.
+     *
+     * @return The name of the layer.
+     */
+    const std::string& getName() const;
+
+    /**
+     * @brief Adds a renderable to the layer, taking it out of the layer it was in.
+     *
+     * The renderable must outlive its membership; it leaves the layer automatically when it is destroyed.
+     *
+     * @param renderable The renderable to add.
+     * @return True if the renderable was added, false if it is a layer itself, as layers cannot be nested.
+     */
+    bool add(Renderable& renderable);
+
+    /**
+     * @brief Removes a renderable from the layer, so that it is drawn on its own again.
+     *
+     * @param renderable The renderable to remove.
+     * @return True if the renderable was removed, false if it is not in the layer.
+     */
+    bool remove(Renderable& renderable);
+
+    /**
+     * @brief Checks if a renderable is in the layer.
+     *
+     * @param renderable The renderable to look for.
+     * @return True if the renderable is in the layer, false otherwise.
+     */
+    bool contains(const Renderable& renderable) const;
+
+    /**
+     * @brief Retrieves the number of renderables in the layer.
+     *
+     * @return The number of renderables in the layer.
+     */
+    std::size_t getCount() const;
+
+    /**
+     * @brief Sets the order in which the renderables of the layer are drawn.
+     *
+     * With SortMode::PositionY, renderables that are not transformable sort as if at Y position 0.
+     *
+     * @param sortMode The sort mode.
+     * @throws std::runtime_error If the sort mode is SortMode::Custom and no sort key has been set.
+     */
+    void setSortMode(SortMode sortMode);
+
+    /**
+     * @brief Retrieves the order in which the renderables of the layer are drawn.
+     *
+     * @return The sort mode.
+     */
+    SortMode getSortMode() const;
+
+    /**
+     * @brief Sets the function giving the key to sort each renderable by, and the sort mode to SortMode::Custom.
+     *
+     * The function is called for every renderable of the layer each time the layer is drawn, or for a
+     * static layer, each time its cache is rendered.
+     *
+     * @param sortKey The function giving the sort key of a renderable.
+     * @throws std::runtime_error If the function is empty.
+     */
+    void setSortKey(SortKey sortKey);
+
+    /**
+     * @brief Sets whether the layer is cached in a render texture.
+     *
+     * @param isStatic True to draw the layer from a cache, false to draw its renderables every frame.
+     */
+    void setStatic(bool isStatic);
+
+    /**
+     * @brief Checks whether the layer is cached in a render texture.
+     *
+     * @return True if the layer is static, false otherwise.
+     */
+    bool isStatic() const;
+
+    /**
+     * @brief Makes a static layer render its cache again the next time it is drawn.
+     */
+    void invalidate();
+
+    /**
+     * @brief Draws the renderables of the layer, or the cache of a static layer.
+     */
+    void render() const final;
+
+private:
+    /**
+     * @brief A renderable of the layer.
+     */
+    struct Entry
+    {
+        Renderable*          renderable;    //!< The renderable.
+        const Transformable* transformable; //!< The renderable as a transformable, or null if it is not one.
+        double               key;           //!< The key the renderable was last sorted by.
+        unsigned int         revision;      //!< The transform revision the cache was rendered with.
+        unsigned int         content;       //!< The content revision the cache was rendered with.
+    };
+
+    /**
+     * @brief Brings the renderables into the order of the sort mode.
+     */
+    void sort() const;
+
+    /**
+     * @brief Checks whether a renderable has changed its transform or contents since the cache was rendered.
+     *
+     * @return True if a renderable has been transformed or its contents changed, false otherwise.
+     */
+    bool hasChanged() const;
+
+    /**
+     * @brief Draws the cache, rendering it again first if the contents of the layer have changed.
+     */
+    void renderCached() const;
+
+    std::string                m_name;                         //!< The name of the layer.
+    mutable std::vector<Entry> m_entries;                      //!< The renderables, sorted when drawn.
+    SortMode                   m_sortMode{SortMode::Priority}; //!< The order the renderables are drawn in.
+    SortKey                    m_sortKey;                      //!< The function giving the keys of SortMode::Custom.
+
+    bool                  m_static{false};     //!< Whether the layer is drawn from a cache.
+    mutable RenderTexture m_cache;             //!< The contents of a static layer.
+    mutable bool          m_cacheValid{false}; //!< Whether the cache is up to date.
+
+}; // class RenderLayer
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_RENDER_LAYER_HPP
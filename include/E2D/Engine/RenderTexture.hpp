@@ -0,0 +1,183 @@
+/**
+ * @file RenderTexture.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_RENDER_TEXTURE_HPP
+#define E2D_ENGINE_RENDER_TEXTURE_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/Resource.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace e2d
+{
+class Renderable;          // Forward declaration of Renderable
+class RenderCommandBuffer; // Forward declaration of RenderCommandBuffer
+class Texture;             // Forward declaration of Texture
+
+/**
+ * @class RenderTexture
+ * @ingroup engine
+ * @brief A texture that can be drawn into instead of the screen.
+ *
+ * Drawing into a render texture happens right away rather than with the next frame, so whatever is
+ * drawn once can be shown many times as a single texture, for example by a sprite given getTexture().
+ * The texture handed out stays the same object when the render texture is created again, so sprites
+ * using it pick up the new contents.
+ *
+ * Like textures, render textures can only be created and drawn into on the render thread. Their
+ * contents can be lost when the graphics device is reset, in which case they have to be drawn again.
+ */
+class E2D_ENGINE_API RenderTexture final : public Resource
+{
+public:
+    /**
+     * @brief Constructs a new RenderTexture object.
+     *
+     * Initializes a new instance of the RenderTexture class, without a texture to draw into.
+     */
+    RenderTexture();
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~RenderTexture() final;
+
+    /**
+     * @brief Creates a blank, fully transparent texture to draw into.
+     *
+     * @param size The width and height of the texture in pixels.
+     * @return True if the texture is created successfully, false otherwise.
+     */
+    bool create(const Vector2i& size);
+
+    /**
+     * @brief Creates the texture from an image file.
+     *
+     * The texture gets the size of the image and starts out with its pixels, ready to be drawn on top of.
+     *
+     * @param filepath Path to the image file.
+     * @return True if the texture is created successfully, false otherwise.
+     */
+    bool loadFromFile(const std::string& filepath) final;
+
+    /**
+     * @brief Creates the texture from an image held in memory.
+     *
+     * Behaves like loadFromFile(), but decodes the image from a block of memory.
+     *
+     * @param data Pointer to the memory block containing the image.
+     * @param size Size of the memory block in bytes.
+     * @return True if the texture is created successfully, false otherwise.
+     */
+    bool loadFromMemory(const void* data, std::size_t size) final;
+
+    /**
+     * @brief Checks if the texture is created and can be drawn into.
+     *
+     * @return True if the texture is created, false otherwise.
+     */
+    bool isLoaded() const;
+
+    /**
+     * @brief Destroys the texture, freeing its memory.
+     */
+    void destroy();
+
+    /**
+     * @brief Retrieves the size of the texture.
+     *
+     * @return The width and height of the texture in pixels.
+     */
+    const Vector2i& getSize() const;
+
+    /**
+     * @brief Retrieves the texture, for drawing its contents.
+     *
+     * @return Shared pointer to the texture.
+     */
+    std::shared_ptr<const Texture> getTexture() const;
+
+    /**
+     * @brief Fills the whole texture with a color.
+     *
+     * @param color The color to fill the texture with.
+     * @return True if the texture was filled, false if it is not created or cannot be drawn into.
+     */
+    bool clear(const Color& color = Color::Transparent);
+
+    /**
+     * @brief Draws a renderable into the texture.
+     *
+     * The renderable is drawn at its position on the screen, which becomes the position in the texture.
+     *
+     * @param renderable The renderable to draw.
+     * @return True if the renderable was drawn, false if the texture is not created or cannot be drawn into.
+     */
+    bool draw(const Renderable& renderable);
+
+    /**
+     * @brief Draws the commands recorded into a buffer into the texture.
+     *
+     * The commands are drawn in render priority order, and the buffer can be cleared right away.
+     *
+     * @param buffer The buffer to draw.
+     * @return True if the buffer was drawn, false if the texture is not created or cannot be drawn into.
+     */
+    bool draw(const RenderCommandBuffer& buffer);
+
+private:
+    /**
+     * @brief Creates the texture with the size of an image and copies the image into it.
+     *
+     * @param image The loaded image.
+     * @return True if the texture is created successfully, false otherwise.
+     */
+    bool createFromImage(const Texture& image);
+
+    /**
+     * @brief Draws into the texture, and tells the users of the texture that its pixels changed.
+     *
+     * @param draw The function drawing into the texture.
+     * @return True if the texture was drawn into, false otherwise.
+     */
+    bool drawToTexture(const std::function<void()>& draw);
+
+    std::shared_ptr<Texture> m_texture; //!< The texture drawn into.
+
+}; // class RenderTexture
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_RENDER_TEXTURE_HPP
@@ -33,6 +33,7 @@
 
 namespace e2d
 {
+class RenderLayer; // Forward declaration of RenderLayer
 
 /**
  * @class Renderable
@@ -45,6 +46,8 @@ namespace e2d
  */
 class E2D_ENGINE_API Renderable : NonCopyable
 {
+    friend class RenderLayer;
+
 public:
     /**
      * @brief Pure virtual destructor.
@@ -81,8 +84,37 @@ public:
      */
     virtual void render() const = 0;
 
+    /**
+     * @brief Gets the layer the object is drawn with.
+     *
+     * @return Pointer to the layer, or null if the object is drawn on its own.
+     */
+    RenderLayer* getLayer() const;
+
+protected:
+    /**
+     * @brief Tells the layer of the object that its cached contents are out of date.
+     *
+     * Static layers notice transformable objects moving, and the content revision changing, on their
+     * own, but not anything else they draw changing. Derived classes call this when that happens, for
+     * example when their texture is set.
+     */
+    void invalidateLayer() const;
+
+    /**
+     * @brief Gets a number that changes whenever the pixels the object draws from change.
+     *
+     * Static layers compare it with the revision their cache was rendered with every time they are
+     * drawn, so changed pixels show in the same frame. Derived classes drawing from a texture return
+     * its revision. The default implementation returns 0, for objects that only call invalidateLayer().
+     *
+     * @return The revision of the contents of the object.
+     */
+    virtual unsigned int getContentRevision() const;
+
 private:
-    int m_renderPriority{0}; //!< Indicates the rendering order of the object.
+    int          m_renderPriority{0}; //!< Indicates the rendering order of the object.
+    RenderLayer* m_layer{nullptr};    //!< The layer the object is drawn with, if any.
 
 }; // class Renderable
 
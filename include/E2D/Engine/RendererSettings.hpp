@@ -0,0 +1,58 @@
+/**
+ * @file RendererSettings.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_RENDERER_SETTINGS_HPP
+#define E2D_ENGINE_RENDERER_SETTINGS_HPP
+
+#include <E2D/Engine/ScaleFilter.hpp>
+
+#include <string>
+
+namespace e2d
+{
+
+/**
+ * @struct RendererSettings
+ * @ingroup engine
+ * @brief Decides how the renderer of an Application is created.
+ *
+ * Lets the render path be tuned per deployment target, for example forcing the software renderer on
+ * machines with broken GPU drivers. The driver is one of the SDL render drivers, such as "opengl",
+ * "opengles2" or "software". SDL only batches draw calls by default when no driver is chosen, but the
+ * engine draws through SDL alone, so batching is safe either way. The texture filter applies to textures
+ * created after the renderer. In headless mode the software renderer is always used.
+ */
+struct RendererSettings
+{
+    bool        vsync{false};                        //!< Whether presenting waits for the refresh of the display.
+    std::string driver;                              //!< The SDL render driver, or empty to let SDL choose.
+    bool        batching{true};                      //!< Whether SDL may batch draw calls.
+    ScaleFilter textureFilter{ScaleFilter::Nearest}; //!< How textures are sampled when drawn at another size.
+};
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_RENDERER_SETTINGS_HPP
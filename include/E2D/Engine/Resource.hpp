@@ -31,6 +31,7 @@
 
 #include <E2D/Core/NonCopyable.hpp>
 
+#include <functional>
 #include <string>
 
 namespace e2d
@@ -85,6 +86,26 @@ public:
      */
     virtual bool loadFromMemory(const void* data, std::size_t size) = 0;
 
+    /**
+     * @brief Prepares loading the resource from a file on a background thread.
+     *
+     * Loading is split in two steps so that the expensive part, such as reading and decoding the file,
+     * can run on any thread while the contents of the resource are only replaced on the render thread.
+     * This method performs the first step and returns a function that completes the load when invoked
+     * on the render thread. Until then the resource keeps its current contents, which allows already
+     * loaded resources to be reloaded in place while they are in use. The first step must not call
+     * into the renderer, since it runs on loader threads and on the hot reload watcher thread.
+     *
+     * The default implementation does no work up front and simply calls loadFromFile() when the
+     * returned function is invoked. Derived classes should override it when part of loading is
+     * thread-safe.
+     *
+     * @param filepath The path to the resource file.
+     * @return A function completing the load on the render thread and returning whether it succeeded,
+     *         or an empty function if preparing the load failed.
+     */
+    virtual std::function<bool()> prepareFromFile(const std::string& filepath);
+
 }; // Resource class
 
 } // namespace e2d
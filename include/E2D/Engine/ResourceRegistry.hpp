@@ -33,9 +33,13 @@
 
 #include <E2D/Engine/Resource.hpp>
 
+#include <cstddef>
 #include <functional>
+#include <iosfwd>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -44,6 +48,11 @@
 namespace e2d
 {
 
+namespace internal
+{
+class FileWatcher; // Forward declaration of FileWatcher
+}
+
 /**
  * @class ResourceRegistry
  * @ingroup engine
@@ -52,6 +61,13 @@ namespace e2d
  * This class is responsible for loading resources from files and providing
  * access to them by their identifiers. It ensures that resources are type-safe
  * and properly managed in memory.
+ *
+ * The registry is safe for concurrent use. Lookups (`exists` and `get`) only take a shared
+ * lock and may run in parallel from any number of threads. Loading is performed outside of
+ * the lock, and only the final insertion into the registry is serialized, so a slow load
+ * never blocks readers. Resources that upload data to the GPU, such as Texture, must however
+ * be loaded on the render thread (the thread that initialized the renderer); loading them
+ * from any other thread fails. CPU-only resources, such as Font, may be loaded from any thread.
  */
 class E2D_ENGINE_API ResourceRegistry final : NonCopyable
 {
@@ -101,9 +117,31 @@ private:
          */
         const std::string& getIdentifier() const;
 
+        /**
+         * @brief Gets the path of the file the resource was loaded from.
+         *
+         * @return The path of the file, or an empty string if the resource was loaded from memory.
+         */
+        const std::string& getFilepath() const;
+
+        /**
+         * @brief Sets the path of the file the resource was loaded from.
+         *
+         * @param filepath The path of the file.
+         */
+        void setFilepath(const std::string& filepath);
+
+        /**
+         * @brief Gets the actual resource.
+         *
+         * @return Shared pointer to the resource.
+         */
+        virtual std::shared_ptr<Resource> getResource() const = 0;
+
     private:
         std::string m_type;       //!< The type of the resource.
         std::string m_identifier; //!< The identifier of the resource.
+        std::string m_filepath;   //!< The path of the file the resource was loaded from, if any.
 
     }; // IResource class
 
@@ -136,11 +174,36 @@ private:
          */
         ~TResource() final;
 
+        /**
+         * @brief Gets the actual resource.
+         *
+         * @return Shared pointer to the resource.
+         */
+        std::shared_ptr<Resource> getResource() const final;
+
         std::shared_ptr<T> mValue; //!< The actual resource of type std::shared_ptr<const T>.
 
     }; // TResource class
 
 public:
+    /**
+     * @brief Function receiving the progress of loading a manifest.
+     *
+     * Invoked on the thread loading the manifest every time a resource has been handled, with the
+     * number of resources handled so far and the total number of resources to load.
+     */
+    using ProgressCallback = std::function<void(std::size_t loaded, std::size_t total)>;
+
+    /**
+     * @struct TextureCacheStats
+     * @brief Counts how texture loads were served by the texture cache.
+     */
+    struct TextureCacheStats
+    {
+        std::size_t hits{0};   //!< Loads that read decoded pixels from the cache.
+        std::size_t misses{0}; //!< Loads that had to decode the source image.
+    };
+
     /**
      * @brief Retrieves the singleton instance of the ResourceRegistry.
      *
@@ -172,7 +235,8 @@ public:
      *
      * @tparam T The type of the resource.
      * @param identifier The identifier of the resource.
-     * @return An optional reference to the resource if it exists.
+     * @return A shared pointer to the resource.
+     * @throws std::runtime_error If the resource has not been loaded.
      */
     template <typename T>
     std::shared_ptr<const T> get(const std::string& identifier) const;
@@ -208,6 +272,133 @@ public:
     template <typename T, typename... Args>
     bool loadFromMemory(const std::string& identifier, const void* data, std::size_t size, Args&&... args);
 
+    /**
+     * @brief Registers a resource type for use in manifests.
+     *
+     * Entries of the given type name in a manifest are loaded as resources of type T. The types
+     * "texture" (Texture), "font" (Font) and "atlas" (TextureAtlas) are registered by default.
+     *
+     * @tparam T The type of the resource.
+     * @param type The name of the type as used in manifests.
+     */
+    template <typename T>
+    void registerManifestType(const std::string& type);
+
+    /**
+     * @brief Loads all resources listed in a manifest file as one batch.
+     *
+     * A manifest is a text file listing one resource per line as `<type> <identifier> <path>`, where the
+     * type is a name registered with registerManifestType(). Empty lines and lines starting with `#` are
+     * ignored. Instead of loading the resources one at a time, the batch is de-duplicated, sorted by path
+     * so files are read in a disk friendly order, and prepared (read and decoded) in parallel on worker
+     * threads. Prepared resources are completed and registered on the calling thread as soon as they
+     * become available, which must be the render thread if the manifest contains textures.
+     *
+     * Resources that are already registered are skipped. A resource that fails to load does not stop
+     * the others from loading.
+     *
+     * @param filepath Path to the manifest file.
+     * @param progress Optional function receiving the loading progress, e.g. for a loading screen.
+     * @return True if every resource of the manifest is loaded, false otherwise.
+     */
+    bool loadManifest(const std::string& filepath, const ProgressCallback& progress = {});
+
+    /**
+     * @brief Loads all resources listed in a manifest held in memory as one batch.
+     *
+     * Behaves like loadManifest(), but reads the manifest text from a block of memory.
+     *
+     * @param data Pointer to the memory block containing the manifest.
+     * @param size Size of the memory block in bytes.
+     * @param progress Optional function receiving the loading progress, e.g. for a loading screen.
+     * @return True if every resource of the manifest is loaded, false otherwise.
+     */
+    bool loadManifestFromMemory(const void* data, std::size_t size, const ProgressCallback& progress = {});
+
+    /**
+     * @brief Enables the on-disk cache of decoded textures.
+     *
+     * Decoding compressed images such as PNG files usually dominates the time spent loading
+     * textures. With the cache enabled, every texture loaded from a file is decoded once, converted
+     * to the renderer's native pixel format and stored in the cache directory; later loads, also in
+     * later runs, read the pixels straight back. Entries are keyed by the source path, modification
+     * time and content hash, so modified images are decoded again.
+     *
+     * @param directory Path to the directory to store cache entries in. Created if it does not exist.
+     * @return True if the cache was enabled, false if the directory could not be created.
+     */
+    bool enableTextureCache(const std::string& directory);
+
+    /**
+     * @brief Disables the on-disk cache of decoded textures.
+     *
+     * Existing cache entries are kept on disk and used again once the cache is re-enabled.
+     */
+    void disableTextureCache();
+
+    /**
+     * @brief Checks if the on-disk cache of decoded textures is enabled.
+     *
+     * @return True if the texture cache is enabled, false otherwise.
+     */
+    bool isTextureCacheEnabled() const;
+
+    /**
+     * @brief Retrieves the texture cache hit and miss counts.
+     *
+     * The counts cover all texture loads since the start of the application, or since the last
+     * call to resetTextureCacheStats(), while the cache was enabled.
+     *
+     * @return The texture cache statistics.
+     */
+    TextureCacheStats getTextureCacheStats() const;
+
+    /**
+     * @brief Resets the texture cache hit and miss counts to zero.
+     */
+    void resetTextureCacheStats();
+
+    /**
+     * @brief Enables reloading of resources when their files change.
+     *
+     * Starts watching every file a resource has been loaded from with loadFromFile(), including
+     * resources loaded later on. When a file changes, the resources loaded from it are prepared
+     * again on the watcher thread, e.g. the image is decoded, and the result is queued. Queued
+     * reloads are applied by applyPendingReloads(), which swaps the contents of the existing resource
+     * objects in place, so everything holding on to them sees the new data from then on. Only
+     * resources whose files actually changed are reloaded.
+     *
+     * Hot reloading is meant for development; applications run by Application apply pending reloads
+     * once per frame.
+     *
+     * @return True if hot reloading is enabled, false if file watching could not be started.
+     */
+    bool enableHotReload();
+
+    /**
+     * @brief Disables reloading of resources when their files change.
+     *
+     * Stops watching files and discards all reloads that have not been applied yet.
+     */
+    void disableHotReload();
+
+    /**
+     * @brief Checks if reloading of resources when their files change is enabled.
+     *
+     * @return True if hot reloading is enabled, false otherwise.
+     */
+    bool isHotReloadEnabled() const;
+
+    /**
+     * @brief Applies the reloads of resources whose files have changed.
+     *
+     * Must be called on the render thread, since it may upload textures. A resource whose reload
+     * fails keeps its previous contents.
+     *
+     * @return The number of resources that were reloaded.
+     */
+    std::size_t applyPendingReloads();
+
 private:
     /**
      * @brief Constructs a new ResourceRegistry object.
@@ -223,7 +414,52 @@ private:
      */
     ~ResourceRegistry();
 
-    std::unordered_map<std::string, std::unique_ptr<IResource>> m_resources; //!< Container for storing resources by their identifiers.
+    /**
+     * @brief Inserts a loaded resource into the registry.
+     *
+     * Serializes the insertion by taking an exclusive lock. If another thread registered a
+     * resource with the same identifier while this one was loading, the new resource is discarded.
+     * Inserted resources are counted in the engine metrics, together with the size of their file,
+     * or the given size if they were loaded from memory.
+     *
+     * @param identifier The identifier of the resource.
+     * @param resource The loaded resource to insert.
+     * @param memorySize The size of the data a resource without a file was loaded from.
+     * @return True if the resource was inserted, false if the identifier was already taken.
+     */
+    bool insert(const std::string& identifier, std::unique_ptr<IResource> resource, std::size_t memorySize = 0);
+
+    /**
+     * @brief Prepares the reload of all resources loaded from a changed file.
+     *
+     * Invoked on the watcher thread, so only the files are read and decoded here. Everything that
+     * touches the renderer, such as uploading a texture, is left to applyPendingReloads().
+     *
+     * @param filepath The path of the file that changed.
+     */
+    void prepareReload(const std::string& filepath);
+
+    /**
+     * @brief Loads all resources listed in a manifest.
+     *
+     * @param stream The stream to read the manifest from.
+     * @param source A description of the manifest source, used in log messages.
+     * @param progress Optional function receiving the loading progress.
+     * @return True if every resource of the manifest is loaded, false otherwise.
+     */
+    bool loadManifest(std::istream& stream, const std::string& source, const ProgressCallback& progress);
+
+    /**
+     * @brief Function creating an empty resource of a manifest type.
+     */
+    using ResourceFactory = std::function<std::unique_ptr<IResource>(const std::string& identifier)>;
+
+    std::unordered_map<std::string, std::unique_ptr<IResource>> m_resources;      //!< Container for storing resources by their identifiers.
+    mutable std::shared_mutex                                   m_mutex;          //!< Guards the resources; shared for lookups, exclusive for inserts.
+    std::unique_ptr<internal::FileWatcher>                      m_fileWatcher;    //!< Watches the files of loaded resources, if hot reloading is enabled.
+    std::unordered_map<std::string, std::function<bool()>>      m_pendingReloads; //!< Prepared reloads by resource identifier.
+    std::mutex                                                  m_reloadMutex;    //!< Guards the pending reloads.
+    std::unordered_map<std::string, ResourceFactory>            m_manifestTypes;  //!< Resource factories by manifest type name.
 
 }; // class ResourceRegistry
 
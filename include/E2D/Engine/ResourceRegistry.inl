@@ -43,9 +43,17 @@ e2d::ResourceRegistry::TResource<T>::TResource::~TResource()
     log::debug("Destructing TResource");
 }
 
+template <class T>
+std::shared_ptr<e2d::Resource> e2d::ResourceRegistry::TResource<T>::getResource() const
+{
+    return this->mValue;
+}
+
 template <typename T>
 bool e2d::ResourceRegistry::exists(const std::string& identifier) const
 {
+    const std::shared_lock<std::shared_mutex> lock(this->m_mutex);
+
     auto it = this->m_resources.find(identifier);
     return it != this->m_resources.end() && it->second->getType() == typeid(T).name();
 }
@@ -53,6 +61,8 @@ bool e2d::ResourceRegistry::exists(const std::string& identifier) const
 template <typename T>
 std::shared_ptr<const T> e2d::ResourceRegistry::get(const std::string& identifier) const
 {
+    const std::shared_lock<std::shared_mutex> lock(this->m_mutex);
+
     auto it = this->m_resources.find(identifier);
     if (it != this->m_resources.end() && it->second->getType() == typeid(T).name())
     {
@@ -77,8 +87,8 @@ bool e2d::ResourceRegistry::loadFromFile(const std::string& identifier,
         resource->mValue = std::make_shared<T>();
         if (resource->mValue->loadFromFile(filepath, std::forward<Args>(args)...))
         {
-            this->m_resources.insert(std::make_pair(identifier, std::move(resource)));
-            return true;
+            resource->setFilepath(filepath);
+            return this->insert(identifier, std::move(resource));
         }
         else
         {
@@ -101,8 +111,7 @@ bool e2d::ResourceRegistry::loadFromMemory(const std::string& identifier,
         resource->mValue = std::make_shared<T>();
         if (resource->mValue->loadFromMemory(data, size, std::forward<Args>(args)...))
         {
-            this->m_resources.insert(std::make_pair(identifier, std::move(resource)));
-            return true;
+            return this->insert(identifier, std::move(resource), size);
         }
         else
         {
@@ -112,4 +121,18 @@ bool e2d::ResourceRegistry::loadFromMemory(const std::string& identifier,
     return false;
 }
 
+template <typename T>
+void e2d::ResourceRegistry::registerManifestType(const std::string& type)
+{
+    static_assert(std::is_base_of<Resource, T>::value, "T must be derived from Resource");
+
+    const std::unique_lock<std::shared_mutex> lock(this->m_mutex);
+    this->m_manifestTypes[type] = [](const std::string& identifier) -> std::unique_ptr<IResource>
+    {
+        auto resource    = std::make_unique<TResource<T>>(identifier);
+        resource->mValue = std::make_shared<T>();
+        return resource;
+    };
+}
+
 #endif //E2D_ENGINE_RESOURCE_REGISTRY_INL
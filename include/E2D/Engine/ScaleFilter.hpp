@@ -0,0 +1,46 @@
+/**
+ * @file ScaleFilter.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_SCALE_FILTER_HPP
+#define E2D_ENGINE_SCALE_FILTER_HPP
+
+namespace e2d
+{
+
+/**
+ * @enum ScaleFilter
+ * @ingroup engine
+ * @brief Decides how pixels are sampled when an image is drawn larger or smaller than it is.
+ */
+enum class ScaleFilter
+{
+    Nearest, //!< Take the nearest pixel, keeping edges sharp and blocky.
+    Linear,  //!< Blend the nearest pixels, smoothing edges.
+};
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_SCALE_FILTER_HPP
@@ -38,11 +38,14 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace e2d
 {
-struct Event;       // Forward declaration of Event
-class SceneManager; // Forward declaration of SceneManager
+struct Event;              // Forward declaration of Event
+class RenderCommandBuffer; // Forward declaration of RenderCommandBuffer
+class RenderLayer;         // Forward declaration of RenderLayer
+class SceneManager;        // Forward declaration of SceneManager
 
 /**
  * @class Scene
@@ -94,6 +97,65 @@ public:
     template <typename T, typename... Args>
     T& createObject(Args&&... args);
 
+    /**
+     * @brief Removes an object from the scene.
+     *
+     * The object is unloaded immediately but only destroyed when the scene is cleaned at the end
+     * of the frame, so it is safe for an object to remove itself or others during an update.
+     *
+     * @param identifier The unique identifier of the object to remove.
+     * @return True if the object was removed, false if no such object exists.
+     */
+    bool removeObject(const std::string& identifier);
+
+    /**
+     * @brief Submits the commands recorded into a buffer to be drawn with the current frame.
+     *
+     * Must be called from the main thread, once the buffer is no longer being recorded, during an
+     * update of the frame. The commands are copied, so the buffer can be reused right away.
+     *
+     * @param buffer The buffer to draw.
+     */
+    void submit(const RenderCommandBuffer& buffer) const;
+
+    /**
+     * @brief Creates a layer to draw renderables of the scene with.
+     *
+     * Renderables added to the layer are drawn by it at the render priority of the layer, instead
+     * of on their own.
+     *
+     * @param name The unique name of the layer.
+     * @param renderPriority The render priority of the layer.
+     * @return A reference to the created layer.
+     * @throws std::runtime_error If a layer with the name already exists.
+     */
+    RenderLayer& createLayer(const std::string& name, int renderPriority = 0);
+
+    /**
+     * @brief Checks if a layer with the specified name exists.
+     *
+     * @param name The name of the layer.
+     * @return True if the scene has a layer with the name, false otherwise.
+     */
+    bool hasLayer(const std::string& name) const;
+
+    /**
+     * @brief Retrieves a layer by name.
+     *
+     * @param name The name of the layer.
+     * @return A reference to the layer.
+     * @throws std::runtime_error If no layer with the name exists.
+     */
+    RenderLayer& getLayer(const std::string& name) const;
+
+    /**
+     * @brief Removes a layer, so that its renderables are drawn on their own again.
+     *
+     * @param name The name of the layer.
+     * @return True if the layer was removed, false if no such layer exists.
+     */
+    bool removeLayer(const std::string& name);
+
     /**
      * @brief Checks if the scene is currently loaded.
      *
@@ -275,8 +337,9 @@ private:
     const std::string m_identifier;    //!< The unique identifier for this scene instance.
     bool              m_loaded{false}; //!< Flag indicating whether the scene is currently loaded.
     bool              m_paused{true};  //!< Flag indicating whether the scene is currently paused.
-    std::unique_ptr<ObjectRegistry> m_objectRegistry;        //!< Manages the lifecycle of objects within the scene.
-    SceneManager*                   m_sceneManager{nullptr}; //!< Pointer to the SceneManager instance.
+    std::unique_ptr<ObjectRegistry>           m_objectRegistry;        //!< Manages the lifecycle of objects within the scene.
+    SceneManager*                             m_sceneManager{nullptr}; //!< Pointer to the SceneManager instance.
+    std::vector<std::unique_ptr<RenderLayer>> m_layers;                //!< The layers of the scene, in order of creation.
 
 }; // Scene class
 
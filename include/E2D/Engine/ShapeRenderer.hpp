@@ -0,0 +1,219 @@
+/**
+ * @file ShapeRenderer.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_SHAPE_RENDERER_HPP
+#define E2D_ENGINE_SHAPE_RENDERER_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/Object.hpp>
+#include <E2D/Engine/Renderable.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+namespace internal
+{
+struct RenderSnapshot; // Forward declaration of RenderSnapshot
+} // namespace internal
+
+/**
+ * @class ShapeRenderer
+ * @ingroup engine
+ * @brief Draws lines, rectangles, circles and polygons, all with a single draw call.
+ *
+ * Shapes are drawn in immediate mode: every shape drawn since the renderer was last rendered is
+ * drawn once, at the render priority of the renderer, and then discarded. Shapes are typically drawn
+ * again every frame, from the updates of the objects they visualize. In a static layer, the shapes
+ * stay in the cache of the layer until shapes are drawn or cleared again.
+ *
+ * Outlines are drawn as quads of the line thickness, so all shapes are triangles in one geometry draw.
+ */
+class E2D_ENGINE_API ShapeRenderer : public Object, public Renderable
+{
+public:
+    /**
+     * @brief Constructs a new ShapeRenderer object.
+     */
+    ShapeRenderer();
+
+    /**
+     * @brief Constructs a new ShapeRenderer object with a specific identifier.
+     *
+     * @param identifier A string representing the unique identifier of the shape renderer.
+     */
+    explicit ShapeRenderer(const std::string& identifier);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~ShapeRenderer() override;
+
+    /**
+     * @brief Sets the thickness of lines and outlines drawn from now on.
+     *
+     * @param thickness The thickness, in pixels.
+     */
+    void setLineThickness(float thickness);
+
+    /**
+     * @brief Retrieves the thickness of lines and outlines.
+     *
+     * @return The thickness, in pixels.
+     */
+    float getLineThickness() const;
+
+    /**
+     * @brief Draws a line.
+     *
+     * @param from The start of the line, in pixels.
+     * @param to The end of the line, in pixels.
+     * @param color The color of the line.
+     */
+    void drawLine(const Vector2f& from, const Vector2f& to, const Color& color);
+
+    /**
+     * @brief Draws the outline of a rectangle.
+     *
+     * @param rectangle The rectangle, in pixels.
+     * @param color The color of the outline.
+     */
+    void drawRect(const FloatRect& rectangle, const Color& color);
+
+    /**
+     * @brief Draws a filled rectangle.
+     *
+     * @param rectangle The rectangle, in pixels.
+     * @param color The color of the rectangle.
+     */
+    void fillRect(const FloatRect& rectangle, const Color& color);
+
+    /**
+     * @brief Draws the outline of a circle.
+     *
+     * @param center The center of the circle, in pixels.
+     * @param radius The radius of the circle, in pixels.
+     * @param color The color of the outline.
+     */
+    void drawCircle(const Vector2f& center, float radius, const Color& color);
+
+    /**
+     * @brief Draws a filled circle.
+     *
+     * @param center The center of the circle, in pixels.
+     * @param radius The radius of the circle, in pixels.
+     * @param color The color of the circle.
+     */
+    void fillCircle(const Vector2f& center, float radius, const Color& color);
+
+    /**
+     * @brief Draws the outline of a polygon, closing it from the last point back to the first.
+     *
+     * @param points The corners of the polygon, in pixels.
+     * @param color The color of the outline.
+     */
+    void drawPolygon(const std::vector<Vector2f>& points, const Color& color);
+
+    /**
+     * @brief Draws a filled convex polygon.
+     *
+     * @param points The corners of the polygon in order around it, in pixels.
+     * @param color The color of the polygon.
+     */
+    void fillPolygon(const std::vector<Vector2f>& points, const Color& color);
+
+    /**
+     * @brief Discards the shapes drawn since the renderer was last rendered.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether any shapes are waiting to be rendered.
+     *
+     * @return True if no shapes were drawn since the renderer was last rendered, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Fixed update method for consistent, time-sensitive updates.
+     */
+    void onFixedUpdate() override;
+
+    /**
+     * @brief Variable update method for frame-dependent updates.
+     *
+     * @param deltaTime The time elapsed since the last variable update in seconds.
+     */
+    void onVariableUpdate(double deltaTime) override;
+
+    /**
+     * @brief Draws the shapes with a single geometry draw call and discards them.
+     */
+    void render() const final;
+
+private:
+    /**
+     * @brief Appends a closed outline through the given points.
+     *
+     * @param points The corners of the outline.
+     * @param color The color of the outline.
+     */
+    void appendOutline(const std::vector<Vector2f>& points, const Color& color);
+
+    /**
+     * @brief Appends a filled convex polygon as a fan of triangles.
+     *
+     * @param points The corners of the polygon, in order around it.
+     * @param color The color of the polygon.
+     */
+    void appendFan(const std::vector<Vector2f>& points, const Color& color);
+
+    /**
+     * @brief Computes the corners of a circle.
+     *
+     * @param center The center of the circle.
+     * @param radius The radius of the circle.
+     * @return The corners, with more of them the larger the circle.
+     */
+    static std::vector<Vector2f> makeCircle(const Vector2f& center, float radius);
+
+    float                                             m_lineThickness{1}; //!< The thickness of lines and outlines.
+    mutable std::unique_ptr<internal::RenderSnapshot> m_geometry;         //!< The triangles of the shapes drawn.
+
+}; // class ShapeRenderer
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_SHAPE_RENDERER_HPP
@@ -35,6 +35,7 @@
 
 #include <E2D/Engine/Object.hpp>
 #include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/TextureRegion.hpp>
 #include <E2D/Engine/Transformable.hpp>
 
 #include <memory>
@@ -43,6 +44,11 @@ namespace e2d
 {
 class Texture; // Forward declaration of Texture
 
+namespace internal
+{
+struct RenderCommand; // Forward declaration of RenderCommand
+} // namespace internal
+
 /**
  * @class Sprite
  * @ingroup engine
@@ -54,6 +60,8 @@ class Texture; // Forward declaration of Texture
  */
 class E2D_ENGINE_API Sprite : public Object, public Transformable, public Renderable
 {
+    friend class RenderCommandBuffer;
+
 public:
     /**
      * @brief Constructs a new Sprite object.
@@ -99,6 +107,17 @@ public:
      */
     void setTexture(const std::shared_ptr<const Texture>& texture);
 
+    /**
+     * @brief Sets a region of a texture as the texture of the sprite.
+     *
+     * The sprite renders from the texture the region is located on, typically a TextureAtlas page,
+     * and behaves as if the region was a texture of its own: the texture rectangle is reset to cover
+     * the whole region and is interpreted relative to it from then on.
+     *
+     * @param region The texture region to use.
+     */
+    void setTexture(const TextureRegion& region);
+
     /**
      * @brief Retrieves the texture rectangle of the sprite.
      *
@@ -113,7 +132,8 @@ public:
      * @brief Sets the texture rectangle of the sprite.
      *
      * This rectangle defines the portion of the texture to be used for rendering.
-     * Useful for spritesheets where multiple sprites are on a single texture.
+     * Useful for spritesheets where multiple sprites are on a single texture. If the texture
+     * was set from a TextureRegion, the rectangle is relative to the top left corner of the region.
      *
      * @param rectangle The IntRect object representing the new texture rectangle.
      */
@@ -161,9 +181,28 @@ public:
      */
     void render() const final;
 
+protected:
+    /**
+     * @brief Gets the revision of the texture, so that static layers notice its pixels changing.
+     *
+     * @return The revision of the texture, or 0 if there is none.
+     */
+    unsigned int getContentRevision() const final;
+
 private:
+    /**
+     * @brief Describes how the sprite is drawn in its current state.
+     *
+     * Does not call into the renderer, so it can be used to record the sprite from any thread.
+     *
+     * @param command The command to fill in.
+     * @return True if the command was filled in, false if the sprite has no texture.
+     */
+    bool makeRenderCommand(internal::RenderCommand& command) const;
+
     std::shared_ptr<const Texture> m_texture; //!< Pointer to the sprite's texture. Used for rendering the sprite.
     IntRect m_textureRect; //!< The texture rectangle defining the area of the texture to be rendered.
+    Vector2i m_textureOffset; //!< The position of the texture region the texture rectangle is relative to.
 
 }; // class Sprite
 
@@ -0,0 +1,222 @@
+/**
+ * @file SpriteBatch.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_SPRITE_BATCH_HPP
+#define E2D_ENGINE_SPRITE_BATCH_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/Object.hpp>
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/TextureRegion.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+class Texture; // Forward declaration of Texture
+
+namespace internal
+{
+struct RenderSnapshot; // Forward declaration of RenderSnapshot
+} // namespace internal
+
+/**
+ * @struct SpriteInstance
+ * @ingroup engine
+ * @brief A sprite drawn by a SpriteBatch, transformed the same way as a Sprite.
+ */
+struct SpriteInstance
+{
+    Vector2f position;            //!< The position of the origin on the screen, in pixels.
+    Vector2f origin;              //!< The point the instance is positioned, scaled and rotated by, in pixels.
+    Vector2f scale{1, 1};         //!< The scale, mirroring the instance on an axis where it is negative.
+    float    rotation{0};         //!< The rotation, in degrees clockwise.
+    IntRect  textureRect;         //!< The part of the texture drawn, in pixels.
+    Color    color{Color::White}; //!< The color the texture is multiplied with.
+};
+
+/**
+ * @class SpriteBatch
+ * @ingroup engine
+ * @brief Draws large numbers of sprites sharing a texture with a single draw call.
+ *
+ * The batch stores its instances contiguously, as plain structures without identifiers or virtual
+ * functions, so thousands of bullets, crowd members or plants cost little more than their pixels.
+ * Instances are addressed by their index, which stays the same until an instance before the last one
+ * is removed. Instances entirely outside the screen, or the render texture drawn into, are skipped when drawing.
+ */
+class E2D_ENGINE_API SpriteBatch : public Object, public Renderable
+{
+public:
+    /**
+     * @brief Constructs a new SpriteBatch object.
+     */
+    SpriteBatch();
+
+    /**
+     * @brief Constructs a new SpriteBatch object with a specific identifier.
+     *
+     * @param identifier A string representing the unique identifier of the sprite batch.
+     */
+    explicit SpriteBatch(const std::string& identifier);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~SpriteBatch() override;
+
+    /**
+     * @brief Sets the texture shared by all instances.
+     *
+     * @param texture Shared pointer to the texture.
+     */
+    void setTexture(const std::shared_ptr<const Texture>& texture);
+
+    /**
+     * @brief Sets a region of a texture, typically a TextureAtlas page, as the texture shared by all instances.
+     *
+     * The texture rectangles of the instances are relative to the top left corner of the region.
+     *
+     * @param region The texture region to use.
+     */
+    void setTexture(const TextureRegion& region);
+
+    /**
+     * @brief Retrieves the texture shared by all instances.
+     *
+     * @return Shared pointer to the texture, or null if none is set.
+     */
+    std::shared_ptr<const Texture> getTexture() const;
+
+    /**
+     * @brief Adds an instance to the end of the batch.
+     *
+     * @param instance The instance to add.
+     * @return The index of the instance.
+     */
+    std::size_t add(const SpriteInstance& instance);
+
+    /**
+     * @brief Removes an instance, moving the last instance into its place.
+     *
+     * @param index The index of the instance to remove.
+     *
+     * @throws std::runtime_error If there is no instance at the index.
+     */
+    void remove(std::size_t index);
+
+    /**
+     * @brief Removes all instances.
+     */
+    void clear();
+
+    /**
+     * @brief Reserves storage, so that adding up to a number of instances does not reallocate.
+     *
+     * @param capacity The number of instances to reserve storage for.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Replaces an instance, such as to move it.
+     *
+     * @param index The index of the instance.
+     * @param instance The new values of the instance.
+     *
+     * @throws std::runtime_error If there is no instance at the index.
+     */
+    void setInstance(std::size_t index, const SpriteInstance& instance);
+
+    /**
+     * @brief Retrieves an instance to read it.
+     *
+     * @param index The index of the instance.
+     * @return The instance.
+     *
+     * @throws std::runtime_error If there is no instance at the index.
+     */
+    const SpriteInstance& getInstance(std::size_t index) const;
+
+    /**
+     * @brief Retrieves all instances, in order of their index.
+     *
+     * @return The instances.
+     */
+    const std::vector<SpriteInstance>& getInstances() const;
+
+    /**
+     * @brief Retrieves the number of instances.
+     *
+     * @return The number of instances.
+     */
+    std::size_t getCount() const;
+
+    /**
+     * @brief Fixed update method for consistent, time-sensitive updates.
+     */
+    void onFixedUpdate() override;
+
+    /**
+     * @brief Variable update method for frame-dependent updates.
+     *
+     * @param deltaTime The time elapsed since the last variable update in seconds.
+     */
+    void onVariableUpdate(double deltaTime) override;
+
+    /**
+     * @brief Draws the instances on the screen with a single geometry draw call, in order of their index.
+     */
+    void render() const final;
+
+protected:
+    /**
+     * @brief Gets the revision of the texture, so that static layers notice its pixels changing.
+     *
+     * @return The revision of the texture, or 0 if there is none.
+     */
+    unsigned int getContentRevision() const final;
+
+private:
+    std::shared_ptr<const Texture>                    m_texture;       //!< The texture shared by all instances.
+    Vector2i                                          m_textureOffset; //!< The position of the texture region.
+    std::vector<SpriteInstance>                       m_instances;     //!< The instances, in order of their index.
+    mutable std::unique_ptr<internal::RenderSnapshot> m_geometry;      //!< The vertices of the last frame.
+
+}; // class SpriteBatch
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_SPRITE_BATCH_HPP
@@ -71,11 +71,13 @@ public:
      * that dependencies between systems are respected.
      *
      * @tparam T The type of the subsystem to initialize. `T` must be derived from `System`.
+     * @tparam Args The types of the arguments to construct the subsystem with.
      *
+     * @param args The arguments to construct the subsystem with.
      * @return True if the subsystem was successfully initialized, false otherwise.
      */
-    template <typename T>
-    bool initialize();
+    template <typename T, typename... Args>
+    bool initialize(Args&&... args);
 
     /**
      * @brief Shuts down all initialized subsystems.
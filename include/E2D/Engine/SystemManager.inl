@@ -26,11 +26,11 @@
 
 #include <utility>
 
-template <typename T>
-bool e2d::SystemManager::initialize()
+template <typename T, typename... Args>
+bool e2d::SystemManager::initialize(Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
 {
     static_assert(std::is_base_of<System, T>::value, "T must be derived from System");
-    auto system = std::make_unique<T>();
+    auto system = std::make_unique<T>(std::forward<Args>(args)...);
     if (!system->initialize())
     {
         return false;
@@ -45,7 +45,8 @@ class Font; // Forward declaration of Font
 
 namespace internal
 {
-class TextImpl; // Forward declaration of TextImpl
+struct RenderCommand; // Forward declaration of RenderCommand
+class TextImpl;       // Forward declaration of TextImpl
 } // namespace internal
 
 /**
@@ -59,6 +60,8 @@ class TextImpl; // Forward declaration of TextImpl
  */
 class E2D_ENGINE_API Text : public Object, public Transformable, public Renderable
 {
+    friend class RenderCommandBuffer;
+
 public:
     /**
      * @brief Constructs a new Text object.
@@ -153,6 +156,8 @@ public:
      * and is used for updates where consistent timing is crucial. This is ideal
      * for physics updates, collision detection, and other time-sensitive operations
      * where a fixed time step is necessary to maintain consistent behavior.
+     *
+     * The text is rendered again if its font has been reloaded since it was last rendered.
      */
     void onFixedUpdate() override;
 
@@ -176,6 +181,14 @@ public:
      */
     void render() const final;
 
+protected:
+    /**
+     * @brief Gets the revision of the texture the text is drawn from, so that static layers notice it changing.
+     *
+     * @return The revision of the texture.
+     */
+    unsigned int getContentRevision() const final;
+
 private:
     /**
      * @brief Updates the native texture of the text.
@@ -185,10 +198,21 @@ private:
      */
     void updateNativeTexture();
 
-    std::string                         m_string;       //!< The string of text to render.
-    unsigned int                        m_fontSize{16}; //!< The size of the font.
-    std::shared_ptr<const Font>         m_font;         //!< Pointer to the font used for rendering the text.
-    std::unique_ptr<internal::TextImpl> m_textImpl;     //!< Pointer to the text implementation.
+    /**
+     * @brief Describes how the text is drawn in its current state.
+     *
+     * Does not call into the renderer, so it can be used to record the text from any thread.
+     *
+     * @param command The command to fill in.
+     * @return True if the command was filled in, false if the text has no texture to draw.
+     */
+    bool makeRenderCommand(internal::RenderCommand& command) const;
+
+    std::string                         m_string;          //!< The string of text to render.
+    unsigned int                        m_fontSize{16};    //!< The size of the font.
+    std::shared_ptr<const Font>         m_font;            //!< Pointer to the font used for rendering the text.
+    unsigned int                        m_fontRevision{0}; //!< The revision of the font the text was rendered with.
+    std::unique_ptr<internal::TextImpl> m_textImpl;        //!< Pointer to the text implementation.
 
 }; // Text class
 
@@ -40,6 +40,8 @@
 
 namespace e2d
 {
+class RenderTexture; // Forward declaration of RenderTexture
+class TextureAtlas;  // Forward declaration of TextureAtlas
 
 namespace internal
 {
@@ -56,6 +58,9 @@ class TextureImpl; // Forward declaration of TextureImpl
  */
 class E2D_ENGINE_API Texture final : public Resource
 {
+    friend class RenderTexture;
+    friend class TextureAtlas;
+
 public:
     /**
      * @brief Constructs a new Texture object.
@@ -93,6 +98,19 @@ public:
      */
     bool loadFromMemory(const void* data, std::size_t size) final;
 
+    /**
+     * @brief Decodes a texture file, deferring the upload to the render thread.
+     *
+     * The image is decoded, or read from the texture cache if enabled, on the calling thread, which
+     * may be a loader or the hot reload watcher thread. The renderer is not queried there, the pixels
+     * are converted to the format it reported when it was created. The returned function uploads the
+     * decoded pixels and replaces the current texture, if any, and must be invoked on the render thread.
+     *
+     * @param filepath Path to the texture file.
+     * @return A function uploading the texture, or an empty function if the file could not be decoded.
+     */
+    std::function<bool()> prepareFromFile(const std::string& filepath) final;
+
     /**
      * @brief Checks if the texture is loaded and valid.
      *
@@ -120,6 +138,16 @@ public:
      */
     const Vector2i& getSize() const;
 
+    /**
+     * @brief Retrieves the revision of the texture pixels.
+     *
+     * The revision is incremented every time the texture is (re)loaded, destroyed or drawn into as
+     * a render texture, allowing users such as Sprite to detect that they need to be drawn again.
+     *
+     * @return The revision of the texture pixels.
+     */
+    unsigned int getRevision() const;
+
     /**
      * @brief Retrieves a handle to the native texture object.
      *
@@ -131,6 +159,7 @@ public:
 
 private:
     std::unique_ptr<internal::TextureImpl> m_textureImpl; //!< Pointer to the texture implementation.
+    unsigned int                           m_revision{0}; //!< Incremented every time the pixels change.
 
 }; // class Texture
 
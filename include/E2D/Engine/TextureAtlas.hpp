@@ -0,0 +1,256 @@
+/**
+ * @file TextureAtlas.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_TEXTURE_ATLAS_HPP
+#define E2D_ENGINE_TEXTURE_ATLAS_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/Resource.hpp>
+#include <E2D/Engine/TextureRegion.hpp>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace e2d
+{
+class Texture; // Forward declaration of Texture
+
+/**
+ * @class TextureAtlas
+ * @ingroup engine
+ * @brief Packs many small images into a few large textures.
+ *
+ * Every Texture is a texture object of its own, so drawing many distinct small sprites forces the
+ * renderer to switch textures constantly. A TextureAtlas takes a set of named images, packs them onto
+ * as few pages as possible using a skyline packer and hands out a TextureRegion for each of them,
+ * which Sprite::setTexture accepts in place of a texture.
+ *
+ * Packing only has to happen once: the resulting layout can be written with saveLayout() and loaded
+ * on later runs through loadFromFile(), which places the images at their stored positions without
+ * packing them again. Like textures, atlases can only be built on the render thread.
+ */
+class E2D_ENGINE_API TextureAtlas final : public Resource
+{
+public:
+    /**
+     * @brief Constructs a new TextureAtlas object.
+     *
+     * Initializes a new, empty instance of the TextureAtlas class.
+     */
+    TextureAtlas();
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~TextureAtlas() final;
+
+    /**
+     * @brief Loads the atlas from a previously saved layout file.
+     *
+     * Reads the layout written by saveLayout(), loads every image it references and places it at
+     * its stored position. Loading fails if an image is missing or its size no longer matches the
+     * layout, in which case the atlas should be packed again.
+     *
+     * @param filepath Path to the layout file.
+     * @return True if the atlas is loaded successfully, false otherwise.
+     */
+    bool loadFromFile(const std::string& filepath) final;
+
+    /**
+     * @brief Loads the atlas from a layout held in memory.
+     *
+     * Behaves like loadFromFile(), but reads the layout text from a block of memory.
+     *
+     * @param data Pointer to the memory block containing the layout.
+     * @param size Size of the memory block in bytes.
+     * @return True if the atlas is loaded successfully, false otherwise.
+     */
+    bool loadFromMemory(const void* data, std::size_t size) final;
+
+    /**
+     * @brief Adds an image to be packed into the atlas.
+     *
+     * The image is not read until pack() is called. Names must be unique within the atlas
+     * and may not contain whitespace.
+     *
+     * @param name The name the region of the image is retrieved by.
+     * @param filepath Path to the image file.
+     * @return True if the image was added, false if the name is invalid or already in use.
+     */
+    bool add(const std::string& name, const std::string& filepath);
+
+    /**
+     * @brief Packs all added images onto atlas pages and uploads them.
+     *
+     * Images are sorted by height and placed with the skyline bottom-left heuristic, starting a
+     * new page whenever the current pages are full. Any previously built pages are replaced.
+     *
+     * @return True if all images were packed and uploaded successfully, false otherwise.
+     */
+    bool pack();
+
+    /**
+     * @brief Writes the current layout to a file.
+     *
+     * The layout records the size of every page as well as the name, source file and position of
+     * every region, allowing loadFromFile() to rebuild the atlas without packing it again.
+     *
+     * @param filepath Path to the layout file to write.
+     * @return True if the layout was written successfully, false otherwise.
+     */
+    bool saveLayout(const std::string& filepath) const;
+
+    /**
+     * @brief Checks if the atlas has been built and is ready for use.
+     *
+     * @return True if the atlas pages are loaded, false otherwise.
+     */
+    bool isLoaded() const;
+
+    /**
+     * @brief Destroys the atlas, freeing its pages and forgetting all images.
+     *
+     * Sprites that still use regions of the atlas keep their page alive until they release it.
+     */
+    void destroy();
+
+    /**
+     * @brief Checks if a region with the specified name exists.
+     *
+     * @param name The name of the region.
+     * @return True if the atlas contains a packed region with the name, false otherwise.
+     */
+    bool hasRegion(const std::string& name) const;
+
+    /**
+     * @brief Retrieves a region of the atlas by name.
+     *
+     * @param name The name of the region.
+     * @return The texture region of the image.
+     * @throws std::runtime_error If no packed region with the name exists.
+     */
+    const TextureRegion& getRegion(const std::string& name) const;
+
+    /**
+     * @brief Retrieves the number of pages the atlas consists of.
+     *
+     * @return The number of pages.
+     */
+    std::size_t getPageCount() const;
+
+    /**
+     * @brief Retrieves a page of the atlas.
+     *
+     * @param index The index of the page.
+     * @return Shared pointer to the page texture, or null if the index is out of range.
+     */
+    std::shared_ptr<const Texture> getPage(std::size_t index) const;
+
+    /**
+     * @brief Sets the maximum size of a single page.
+     *
+     * Takes effect the next time the atlas is packed. Pages are cropped to the area actually used,
+     * so only the last page of an atlas usually ends up smaller than this. Defaults to 2048x2048.
+     *
+     * @param size The maximum width and height of a page.
+     */
+    void setMaxPageSize(const Vector2i& size);
+
+    /**
+     * @brief Retrieves the maximum size of a single page.
+     *
+     * @return The maximum width and height of a page.
+     */
+    const Vector2i& getMaxPageSize() const;
+
+    /**
+     * @brief Sets the number of empty pixels kept between neighbouring images.
+     *
+     * Padding prevents neighbouring images from bleeding into each other when sprites are scaled
+     * with linear filtering. Takes effect the next time the atlas is packed. Defaults to 1.
+     *
+     * @param padding The padding in pixels.
+     */
+    void setPadding(int padding);
+
+    /**
+     * @brief Retrieves the number of empty pixels kept between neighbouring images.
+     *
+     * @return The padding in pixels.
+     */
+    int getPadding() const;
+
+private:
+    /**
+     * @struct Entry
+     * @brief An image of the atlas and where it is placed.
+     */
+    struct Entry
+    {
+        std::string name;     //!< The name of the region.
+        std::string filepath; //!< Path to the source image file.
+        std::size_t page{0};  //!< The index of the page the image is placed on.
+        IntRect     rect;     //!< The area of the page covered by the image.
+    };
+
+    /**
+     * @brief Parses a layout and builds the atlas from it.
+     *
+     * @param stream The stream to read the layout from.
+     * @param source A description of the layout source, used in log messages.
+     * @return True if the atlas is built successfully, false otherwise.
+     */
+    bool loadLayout(std::istream& stream, const std::string& source);
+
+    /**
+     * @brief Loads the images of all entries, composes the pages and uploads them.
+     *
+     * @param repack Whether to pack the images anew, or to place them at the positions stored in the entries.
+     * @return True if the atlas is built successfully, false otherwise.
+     */
+    bool build(bool repack);
+
+    std::vector<Entry>                             m_entries;                 //!< Images of the atlas, as added.
+    std::vector<Vector2i>                          m_pageSizes;               //!< The size of each page.
+    std::vector<std::shared_ptr<Texture>>          m_pages;                   //!< The uploaded page textures.
+    std::unordered_map<std::string, TextureRegion> m_regions;                 //!< Regions of packed images by name.
+    Vector2i                                       m_maxPageSize{2048, 2048}; //!< The maximum size of a page.
+    int                                            m_padding{1};              //!< Empty pixels between images.
+
+}; // class TextureAtlas
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_TEXTURE_ATLAS_HPP
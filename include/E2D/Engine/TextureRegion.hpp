@@ -0,0 +1,55 @@
+/**
+ * @file TextureRegion.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_TEXTURE_REGION_HPP
+#define E2D_ENGINE_TEXTURE_REGION_HPP
+
+#include <E2D/Core/Rect.hpp>
+
+#include <memory>
+
+namespace e2d
+{
+class Texture; // Forward declaration of Texture
+
+/**
+ * @struct TextureRegion
+ * @ingroup engine
+ * @brief A rectangular area of a texture that can be used as if it was a texture of its own.
+ *
+ * Texture regions are handed out by TextureAtlas for each packed image. A sprite given a region
+ * renders from the shared atlas page, while its texture rectangle stays relative to the region,
+ * so code written against a standalone texture works unchanged on an atlas.
+ */
+struct TextureRegion
+{
+    std::shared_ptr<const Texture> texture; //!< The texture the region is located on.
+    IntRect                        rect;    //!< The area of the texture covered by the region, in pixels.
+};
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_TEXTURE_REGION_HPP
@@ -0,0 +1,285 @@
+/**
+ * @file TileMap.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_TILE_MAP_HPP
+#define E2D_ENGINE_TILE_MAP_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <E2D/Engine/Object.hpp>
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/TextureRegion.hpp>
+#include <E2D/Engine/Transformable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace e2d
+{
+class Texture; // Forward declaration of Texture
+
+/**
+ * @class TileMap
+ * @ingroup engine
+ * @brief A grid of tiles taken from a tileset, drawn with a few draw calls regardless of its size.
+ *
+ * The map stores one tile number per cell and layer. Tile numbers count the tiles of the tileset
+ * from one, left to right and top to bottom, and zero, EmptyTile, leaves the cell empty. The layers
+ * are drawn on top of each other in order.
+ *
+ * The map is divided into chunks of ChunkSize by ChunkSize tiles. The first time a chunk is visible,
+ * all its layers are rendered into a render texture of its own, and from then on the chunk is drawn
+ * as that single texture. Changing a tile only renders its chunk again, and chunks outside the screen,
+ * or the render texture drawn into, are neither drawn nor rendered. A tileset whose pixels were
+ * replaced is noticed the next time the map is drawn. Other changes that do not show in the tile
+ * numbers need a call to invalidate().
+ *
+ * Tile maps are positioned, scaled and mirrored like sprites, but are not rotated. Chunks keep their
+ * texture once they have been visible, so a map that is scrolled through entirely uses as much
+ * texture memory as an image of the whole map.
+ */
+class E2D_ENGINE_API TileMap : public Object, public Transformable, public Renderable
+{
+public:
+    static constexpr std::uint16_t EmptyTile = 0;  //!< The tile number of an empty cell.
+    static constexpr int           ChunkSize = 16; //!< The width and height of a chunk, in tiles.
+
+    /**
+     * @brief Constructs a new TileMap object.
+     *
+     * The map is empty until it is created with create() and given a tileset with setTileset().
+     */
+    TileMap();
+
+    /**
+     * @brief Constructs a new TileMap object with a specific identifier.
+     *
+     * @param identifier A string representing the unique identifier of the tile map.
+     */
+    explicit TileMap(const std::string& identifier);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~TileMap() override;
+
+    /**
+     * @brief Sets the texture the tiles are taken from.
+     *
+     * The texture is divided into tiles of the given size; a partial tile at the right or bottom edge is not used.
+     *
+     * @param texture Shared pointer to the tileset texture.
+     * @param tileSize The size of a tile, in pixels.
+     */
+    void setTileset(const std::shared_ptr<const Texture>& texture, const Vector2i& tileSize);
+
+    /**
+     * @brief Sets a region of a texture, typically a TextureAtlas page, as the tileset.
+     *
+     * @param region The texture region the tiles are taken from.
+     * @param tileSize The size of a tile, in pixels.
+     */
+    void setTileset(const TextureRegion& region, const Vector2i& tileSize);
+
+    /**
+     * @brief Retrieves the tileset texture.
+     *
+     * @return Shared pointer to the tileset texture, or null if none is set.
+     */
+    std::shared_ptr<const Texture> getTileset() const;
+
+    /**
+     * @brief Retrieves the size of a tile.
+     *
+     * @return The size of a tile, in pixels.
+     */
+    const Vector2i& getTileSize() const;
+
+    /**
+     * @brief Creates the map, leaving all its cells empty.
+     *
+     * Tiles of a previously created map are discarded.
+     *
+     * @param size The number of columns and rows of the map.
+     * @param layerCount The number of layers of the map.
+     * @return True if the map was created, false if the size or the number of layers is not positive.
+     */
+    bool create(const Vector2i& size, std::size_t layerCount = 1);
+
+    /**
+     * @brief Retrieves the number of columns and rows of the map.
+     *
+     * @return The size of the map, in tiles.
+     */
+    const Vector2i& getMapSize() const;
+
+    /**
+     * @brief Retrieves the number of layers of the map.
+     *
+     * @return The number of layers.
+     */
+    std::size_t getLayerCount() const;
+
+    /**
+     * @brief Sets the tile of a cell.
+     *
+     * @param layer The layer of the cell.
+     * @param position The column and row of the cell.
+     * @param tile The tile number, or EmptyTile to leave the cell empty.
+     *
+     * @throws std::runtime_error If the cell is outside the map.
+     */
+    void setTile(std::size_t layer, const Vector2i& position, std::uint16_t tile);
+
+    /**
+     * @brief Retrieves the tile of a cell.
+     *
+     * @param layer The layer of the cell.
+     * @param position The column and row of the cell.
+     * @return The tile number, or EmptyTile if the cell is empty.
+     *
+     * @throws std::runtime_error If the cell is outside the map.
+     */
+    std::uint16_t getTile(std::size_t layer, const Vector2i& position) const;
+
+    /**
+     * @brief Sets the tiles of a whole layer at once.
+     *
+     * @param layer The layer to set.
+     * @param tiles The tile numbers, row by row, one per cell of the map.
+     *
+     * @throws std::runtime_error If the layer does not exist or the number of tiles does not match the map.
+     */
+    void setTiles(std::size_t layer, const std::vector<std::uint16_t>& tiles);
+
+    /**
+     * @brief Makes every chunk render its texture again the next time it is drawn, as well as the layer of the map.
+     */
+    void invalidate();
+
+    /**
+     * @brief Gets the size of the tile map.
+     *
+     * @return The size of the map, in pixels.
+     */
+    Vector2f getSize() const final;
+
+    /**
+     * @brief Fixed update method for consistent, time-sensitive updates.
+     */
+    void onFixedUpdate() override;
+
+    /**
+     * @brief Variable update method for frame-dependent updates.
+     *
+     * @param deltaTime The time elapsed since the last variable update in seconds.
+     */
+    void onVariableUpdate(double deltaTime) override;
+
+    /**
+     * @brief Draws the chunks of the map that are on the screen, rendering those that changed first.
+     */
+    void render() const final;
+
+protected:
+    /**
+     * @brief Gets the revision of the tileset, so that static layers notice its pixels changing.
+     *
+     * @return The revision of the tileset, or 0 if there is none.
+     */
+    unsigned int getContentRevision() const final;
+
+private:
+    /**
+     * @struct Chunk
+     * @brief The texture a part of the map is drawn from.
+     */
+    struct Chunk
+    {
+        std::unique_ptr<RenderTexture> texture;     //!< The tiles of all layers, or null until first rendered.
+        bool                           dirty{true}; //!< Whether the tiles changed since the texture was rendered.
+        bool                           empty{true}; //!< Whether all cells of the chunk are empty.
+    };
+
+    /**
+     * @brief Renders the tiles of a chunk into its texture.
+     *
+     * @param chunkPosition The column and row of the chunk.
+     * @return True if the texture is up to date, false if it could not be rendered.
+     */
+    bool bake(const Vector2i& chunkPosition) const;
+
+    /**
+     * @brief Calls a function with the source and destination of each tile of a chunk, layer by layer.
+     *
+     * @param chunkPosition The column and row of the chunk.
+     * @param function The function to call, with the destination relative to the top left corner of the chunk.
+     */
+    void forEachTile(const Vector2i&                                            chunkPosition,
+                     const std::function<void(const IntRect&, const IntRect&)>& function) const;
+
+    /**
+     * @brief Retrieves the size of a chunk, which is smaller than ChunkSize at the right and bottom edges.
+     *
+     * @param chunkPosition The column and row of the chunk.
+     * @return The size of the chunk, in pixels.
+     */
+    Vector2i getChunkSize(const Vector2i& chunkPosition) const;
+
+    /**
+     * @brief Retrieves the index of a cell in the tiles of its layer, checking that it exists.
+     *
+     * @param layer The layer of the cell.
+     * @param position The column and row of the cell.
+     * @return The index of the cell.
+     */
+    std::size_t getCellIndex(std::size_t layer, const Vector2i& position) const;
+
+    std::shared_ptr<const Texture>          m_tileset;               //!< The texture the tiles are taken from.
+    IntRect                                 m_tilesetRect;           //!< The area of the texture tiles are taken from.
+    Vector2i                                m_tileSize;              //!< The size of a tile, in pixels.
+    Vector2i                                m_mapSize;               //!< The number of columns and rows.
+    Vector2i                                m_chunkCount;            //!< The number of chunk columns and rows.
+    std::vector<std::vector<std::uint16_t>> m_layers;                //!< The tile numbers of each layer, row by row.
+    mutable std::vector<Chunk>              m_chunks;                //!< The chunks, row by row.
+    mutable void*                           m_bakedTileset{nullptr}; //!< The tileset the chunks were rendered from.
+    mutable unsigned int                    m_bakedRevision{0};      //!< The revision of that tileset.
+
+}; // class TileMap
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_TILE_MAP_HPP
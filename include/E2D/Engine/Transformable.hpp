@@ -128,6 +128,16 @@ public:
      */
     void setRotation(double angle);
 
+    /**
+     * @brief Retrieves the revision of the transform.
+     *
+     * The revision is incremented every time the position, origin, scale or rotation is set, allowing
+     * users such as RenderLayer to detect that the object has to be drawn again.
+     *
+     * @return The revision of the transform.
+     */
+    unsigned int getTransformRevision() const;
+
     /**
      * @brief Gets the size of the object.
      *
@@ -156,10 +166,11 @@ public:
     FloatRect getGlobalBounds() const;
 
 private:
-    Vector2f m_position;    //!< The position of the object in the world or screen space.
-    Vector2f m_origin;      //!< The origin point of the object, used as a pivot for transformations.
-    Vector2f m_scale{1, 1}; //!< The scaling factors of the object in the x and y directions.
-    double   m_rotation{0}; //!< The rotation angle of the object in degrees.
+    Vector2f     m_position;    //!< The position of the object in the world or screen space.
+    Vector2f     m_origin;      //!< The origin point of the object, used as a pivot for transformations.
+    Vector2f     m_scale{1, 1}; //!< The scaling factors of the object in the x and y directions.
+    double       m_rotation{0}; //!< The rotation angle of the object in degrees.
+    unsigned int m_revision{0}; //!< Incremented every time the transform is set.
 
 }; // Transformable class
 
@@ -0,0 +1,53 @@
+/**
+ * @file Vertex.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_VERTEX_HPP
+#define E2D_ENGINE_VERTEX_HPP
+
+#include <E2D/Core/Color.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+namespace e2d
+{
+
+/**
+ * @struct Vertex
+ * @ingroup engine
+ * @brief A corner of a triangle drawn as geometry.
+ *
+ * Vertices are drawn in groups of three, each forming a triangle. The color is multiplied with the
+ * texture, or used as is when the geometry has no texture.
+ */
+struct Vertex
+{
+    Vector2f position;            //!< The position on the screen, in pixels.
+    Color    color{Color::White}; //!< The color of the vertex, blended across the triangle.
+    Vector2f textureCoordinates;  //!< The point of the texture at the vertex, from 0 to 1 on both axes.
+};
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_VERTEX_HPP
@@ -0,0 +1,51 @@
+/**
+ * @file WindowSettings.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_WINDOW_SETTINGS_HPP
+#define E2D_ENGINE_WINDOW_SETTINGS_HPP
+
+#include <E2D/Core/Vector2.hpp>
+
+namespace e2d
+{
+
+/**
+ * @struct WindowSettings
+ * @ingroup engine
+ * @brief Decides how the window of an Application is created.
+ *
+ * In headless mode there is no window, and only the size is used, as that of the offscreen surface.
+ */
+struct WindowSettings
+{
+    Vector2i size{800, 600};    //!< The size of the window in pixels.
+    bool     fullscreen{false}; //!< Whether the window takes over the display, changing its resolution to the size.
+    bool     borderless{false}; //!< Whether the window has no decorations, or covers the desktop if also fullscreen.
+};
+
+} // namespace e2d
+
+#endif //E2D_ENGINE_WINDOW_SETTINGS_HPP
@@ -0,0 +1,254 @@
+/**
+ * @file BinaryLogSink.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/BinaryLogSink.hpp>
+#include <E2D/Core/LogArguments.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace
+{
+constexpr std::array<char, 8> fileMagic   = {'E', '2', 'D', 'B', 'L', 'O', 'G', '\0'};
+constexpr std::uint32_t       fileVersion = 1;
+
+// Entries start with a tag byte. Tags 0 to 3 are messages with the corresponding log level:
+// format id, time difference and argument length as variable length integers, then the arguments.
+// A format tag defines the next format string id: length as a variable length integer, then the characters.
+constexpr std::uint8_t formatTag = 'F';
+
+std::uint64_t hashFormat(std::string_view format)
+{
+    // 64-bit FNV-1a
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char character : format)
+    {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::int64_t toMicroseconds(std::chrono::system_clock::time_point time)
+{
+    return static_cast<std::int64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count());
+}
+
+std::uint64_t zigzagEncode(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t zigzagDecode(std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, T value)
+{
+    std::array<char, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    stream.write(bytes.data(), bytes.size());
+}
+
+template <typename T>
+bool readValue(std::istream& stream, T& value)
+{
+    std::array<char, sizeof(T)> bytes{};
+    if (!stream.read(bytes.data(), bytes.size()))
+    {
+        return false;
+    }
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    return true;
+}
+
+bool readVarint(std::istream& stream, std::uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        char byte = 0;
+        if (!stream.get(byte))
+        {
+            return false;
+        }
+        value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(byte) & 0x7F) << shift;
+        if ((static_cast<std::uint8_t>(byte) & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool readString(std::istream& stream, std::string& text)
+{
+    std::uint64_t length = 0;
+    if (!readVarint(stream, length))
+    {
+        return false;
+    }
+    text.resize(static_cast<std::size_t>(length));
+    return length == 0 || static_cast<bool>(stream.read(text.data(), static_cast<std::streamsize>(length)));
+}
+} // namespace
+
+e2d::BinaryLogSink::BinaryLogSink(const std::string& filepath)
+    : m_file(filepath, std::ios::binary | std::ios::trunc)
+    , m_lastTime(toMicroseconds(std::chrono::system_clock::now()))
+{
+    if (this->m_file.is_open())
+    {
+        this->m_file.write(fileMagic.data(), fileMagic.size());
+        writeValue(this->m_file, fileVersion);
+        writeValue(this->m_file, this->m_lastTime);
+    }
+}
+
+e2d::BinaryLogSink::~BinaryLogSink() = default;
+
+void e2d::BinaryLogSink::write(const LogMessage& message)
+{
+    if (!this->m_file.is_open())
+    {
+        return;
+    }
+
+    const std::uint32_t formatId = this->getFormatId(message.format);
+    const std::int64_t  time     = toMicroseconds(message.time);
+
+    // Messages from different threads may arrive slightly out of order, so the difference can be negative
+    FormatBuffer header;
+    header.append(static_cast<char>(message.level));
+    LogArguments::encodeVarint(header, formatId);
+    LogArguments::encodeVarint(header, zigzagEncode(time - this->m_lastTime));
+    LogArguments::encodeVarint(header, message.arguments.size());
+    this->m_lastTime = time;
+
+    this->m_file.write(header.getData(), static_cast<std::streamsize>(header.getSize()));
+    this->m_file.write(message.arguments.data(), static_cast<std::streamsize>(message.arguments.size()));
+}
+
+void e2d::BinaryLogSink::flush()
+{
+    this->m_file.flush();
+}
+
+bool e2d::BinaryLogSink::isOpen() const
+{
+    return this->m_file.is_open();
+}
+
+bool e2d::BinaryLogSink::decode(std::istream& input, std::ostream& output)
+{
+    std::array<char, fileMagic.size()> magic{};
+    std::uint32_t                      version = 0;
+    std::int64_t                       time    = 0;
+    if (!input.read(magic.data(), magic.size()) || magic != fileMagic || !readValue(input, version) ||
+        version != fileVersion || !readValue(input, time))
+    {
+        return false;
+    }
+
+    std::vector<std::string> formats;
+    std::string              arguments;
+    FormatBuffer             text;
+    FormatBuffer             line;
+    char                     tag = 0;
+    while (input.get(tag))
+    {
+        if (static_cast<std::uint8_t>(tag) == formatTag)
+        {
+            std::string format;
+            if (!readString(input, format))
+            {
+                return false;
+            }
+            formats.push_back(std::move(format));
+            continue;
+        }
+
+        std::uint64_t formatId  = 0;
+        std::uint64_t timeDelta = 0;
+        if (static_cast<std::uint8_t>(tag) > E2D_LOG_LEVEL_ERROR || !readVarint(input, formatId) ||
+            formatId >= formats.size() || !readVarint(input, timeDelta) || !readString(input, arguments))
+        {
+            return false;
+        }
+        time += zigzagDecode(timeDelta);
+
+        const std::string& format = formats[static_cast<std::size_t>(formatId)];
+        text.clear();
+        if (!LogArguments::format(text, format, arguments))
+        {
+            return false;
+        }
+
+        const auto       timePoint = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(time)));
+        const LogMessage message{static_cast<LogLevel>(tag), timePoint, format, arguments, text.getView()};
+        line.clear();
+        formatLine(line, message, false);
+        output.write(line.getData(), static_cast<std::streamsize>(line.getSize()));
+    }
+    return input.eof();
+}
+
+bool e2d::BinaryLogSink::decodeFile(const std::string& inputFilepath, const std::string& outputFilepath)
+{
+    std::ifstream input(inputFilepath, std::ios::binary);
+    std::ofstream output(outputFilepath, std::ios::binary | std::ios::trunc);
+    if (!input || !output)
+    {
+        return false;
+    }
+    return decode(input, output) && output.good();
+}
+
+std::uint32_t e2d::BinaryLogSink::getFormatId(std::string_view format)
+{
+    const std::uint64_t hash = hashFormat(format);
+    const auto          it   = this->m_formatIds.find(hash);
+    if (it != this->m_formatIds.end() && this->m_formats[it->second] == format)
+    {
+        return it->second;
+    }
+
+    // New format string, or a hash collision which is resolved by defining the string again under a new id
+    const auto id = static_cast<std::uint32_t>(this->m_formats.size());
+    this->m_formats.emplace_back(format);
+    this->m_formatIds[hash] = id;
+
+    FormatBuffer definition;
+    definition.append(static_cast<char>(formatTag));
+    LogArguments::encodeVarint(definition, format.size());
+    this->m_file.write(definition.getData(), static_cast<std::streamsize>(definition.getSize()));
+    this->m_file.write(format.data(), static_cast<std::streamsize>(format.size()));
+    return id;
+}
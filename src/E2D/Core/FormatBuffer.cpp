@@ -0,0 +1,121 @@
+/**
+ * @file FormatBuffer.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/FormatBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+e2d::FormatBuffer::FormatBuffer()
+    : m_data(m_inline.data())
+    , m_capacity(InlineCapacity)
+    , m_fixed(false)
+{
+}
+
+e2d::FormatBuffer::FormatBuffer(char* buffer, std::size_t capacity)
+    : m_data(buffer)
+    , m_capacity(capacity)
+    , m_fixed(true)
+{
+    if (this->m_capacity == 0)
+    {
+        // Without room for a terminator, fall back to an empty inline string that is never written to
+        this->m_data     = this->m_inline.data();
+        this->m_capacity = 1;
+    }
+    this->m_data[0] = '\0';
+}
+
+e2d::FormatBuffer::~FormatBuffer() = default;
+
+void e2d::FormatBuffer::append(std::string_view text)
+{
+    const std::size_t available = this->reserve(this->m_size + text.size()) - this->m_size;
+    const std::size_t count     = std::min(available, text.size());
+    std::memcpy(this->m_data + this->m_size, text.data(), count);
+    this->m_size += count;
+    this->m_data[this->m_size] = '\0';
+}
+
+void e2d::FormatBuffer::append(char character)
+{
+    this->append(std::string_view(&character, 1));
+}
+
+void e2d::FormatBuffer::clear()
+{
+    this->m_size      = 0;
+    this->m_truncated = false;
+    this->m_data[0]   = '\0';
+}
+
+const char* e2d::FormatBuffer::getData() const
+{
+    return this->m_data;
+}
+
+std::size_t e2d::FormatBuffer::getSize() const
+{
+    return this->m_size;
+}
+
+std::string_view e2d::FormatBuffer::getView() const
+{
+    return {this->m_data, this->m_size};
+}
+
+std::string e2d::FormatBuffer::toString() const
+{
+    return {this->m_data, this->m_size};
+}
+
+bool e2d::FormatBuffer::isTruncated() const
+{
+    return this->m_truncated;
+}
+
+std::size_t e2d::FormatBuffer::reserve(std::size_t size)
+{
+    if (size < this->m_capacity)
+    {
+        return size;
+    }
+
+    if (this->m_fixed)
+    {
+        this->m_truncated = true;
+        return this->m_capacity - 1;
+    }
+
+    const std::size_t capacity = std::max(this->m_capacity * 2, size + 1);
+    auto              heap     = std::make_unique<char[]>(capacity);
+    std::memcpy(heap.get(), this->m_data, this->m_size + 1);
+    this->m_heap     = std::move(heap);
+    this->m_data     = this->m_heap.get();
+    this->m_capacity = capacity;
+    return size;
+}
@@ -26,6 +26,45 @@
 
 #include <E2D/Core/Formatter.hpp>
 
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <streambuf>
+
+namespace
+{
+/**
+ * @brief A stream buffer that appends everything written to it to a FormatBuffer.
+ */
+class FormatStreamBuffer final : public std::streambuf
+{
+public:
+    explicit FormatStreamBuffer(e2d::FormatBuffer& buffer)
+        : m_buffer(buffer)
+    {
+    }
+
+protected:
+    int_type overflow(int_type character) override
+    {
+        if (!traits_type::eq_int_type(character, traits_type::eof()))
+        {
+            this->m_buffer.append(traits_type::to_char_type(character));
+        }
+        return traits_type::not_eof(character);
+    }
+
+    std::streamsize xsputn(const char_type* text, std::streamsize count) override
+    {
+        this->m_buffer.append(std::string_view(text, static_cast<std::size_t>(count)));
+        return count;
+    }
+
+private:
+    e2d::FormatBuffer& m_buffer;
+};
+} // namespace
+
 void e2d::Formatter::formatImpl(std::ostringstream& oss, const std::string& text, size_t pos)
 {
     oss << text.substr(pos);
@@ -54,3 +93,70 @@ std::string e2d::Formatter::handleEscapedBraces(const std::string& text)
     }
     return result;
 }
+
+std::size_t e2d::Formatter::appendLiteral(FormatBuffer& buffer, std::string_view text, std::size_t pos)
+{
+    std::size_t start = pos;
+    while (pos + 1 < text.size())
+    {
+        const char current = text[pos];
+        const char next    = text[pos + 1];
+        if (current == '{' && next == '}')
+        {
+            buffer.append(text.substr(start, pos - start));
+            return pos + 2;
+        }
+        if ((current == '{' && next == '{') || (current == '}' && next == '}'))
+        {
+            // Write the text so far including one of the braces and skip the other
+            buffer.append(text.substr(start, pos + 1 - start));
+            pos += 2;
+            start = pos;
+            continue;
+        }
+        ++pos;
+    }
+    buffer.append(text.substr(start));
+    return text.size();
+}
+
+void e2d::Formatter::writeInteger(FormatBuffer& buffer, long long value)
+{
+    std::array<char, 24> digits{};
+    const auto           result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    buffer.append(std::string_view(digits.data(), static_cast<std::size_t>(result.ptr - digits.data())));
+}
+
+void e2d::Formatter::writeInteger(FormatBuffer& buffer, unsigned long long value)
+{
+    std::array<char, 24> digits{};
+    const auto           result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    buffer.append(std::string_view(digits.data(), static_cast<std::size_t>(result.ptr - digits.data())));
+}
+
+void e2d::Formatter::writeFloat(FormatBuffer& buffer, double value)
+{
+    std::array<char, 32> digits{};
+#if defined(__cpp_lib_to_chars)
+    const auto result = std::to_chars(digits.data(),
+                                      digits.data() + digits.size(),
+                                      value,
+                                      std::chars_format::general,
+                                      6);
+    buffer.append(std::string_view(digits.data(), static_cast<std::size_t>(result.ptr - digits.data())));
+#else
+    // Floating point std::to_chars is missing from some standard libraries, snprintf produces the same output
+    const int length = std::snprintf(digits.data(), digits.size(), "%g", value);
+    if (length > 0)
+    {
+        buffer.append(std::string_view(digits.data(), static_cast<std::size_t>(length)));
+    }
+#endif
+}
+
+void e2d::Formatter::writeStream(FormatBuffer& buffer, const void* value, void (*write)(std::ostream&, const void*))
+{
+    FormatStreamBuffer streamBuffer(buffer);
+    std::ostream       stream(&streamBuffer);
+    write(stream, value);
+}
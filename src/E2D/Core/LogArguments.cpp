@@ -0,0 +1,180 @@
+/**
+ * @file LogArguments.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/LogArguments.hpp>
+
+#include <array>
+
+namespace
+{
+template <typename T>
+bool readValue(std::string_view arguments, std::size_t& pos, T& value)
+{
+    if (arguments.size() - pos < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&value, arguments.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+} // namespace
+
+bool e2d::LogArguments::format(FormatBuffer& buffer, std::string_view format, std::string_view arguments)
+{
+    std::size_t formatPos   = 0;
+    std::size_t argumentPos = 0;
+    while (argumentPos < arguments.size())
+    {
+        formatPos = Formatter::appendLiteral(buffer, format, formatPos);
+        if (!formatArgument(buffer, arguments, argumentPos))
+        {
+            return false;
+        }
+    }
+    Formatter::appendLiteral(buffer, format, formatPos);
+    return true;
+}
+
+void e2d::LogArguments::encodeVarint(FormatBuffer& buffer, std::uint64_t value)
+{
+    std::array<char, 10> bytes{};
+    std::size_t          count = 0;
+    while (value >= 0x80)
+    {
+        bytes[count++] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    bytes[count++] = static_cast<char>(value);
+    buffer.append(std::string_view(bytes.data(), count));
+}
+
+bool e2d::LogArguments::decodeVarint(std::string_view data, std::size_t& pos, std::uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64 && pos < data.size(); shift += 7)
+    {
+        const auto byte = static_cast<std::uint8_t>(data[pos++]);
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void e2d::LogArguments::encodeInteger(FormatBuffer& buffer, std::int64_t value)
+{
+    // Zigzag encoding maps small negative numbers to small unsigned numbers as well
+    const auto zigzag = (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    buffer.append(static_cast<char>(Type::Int));
+    encodeVarint(buffer, zigzag);
+}
+
+void e2d::LogArguments::encodeInteger(FormatBuffer& buffer, std::uint64_t value)
+{
+    buffer.append(static_cast<char>(Type::UInt));
+    encodeVarint(buffer, value);
+}
+
+void e2d::LogArguments::encodeString(FormatBuffer& buffer, std::string_view text)
+{
+    buffer.append(static_cast<char>(Type::String));
+    encodeVarint(buffer, text.size());
+    buffer.append(text);
+}
+
+bool e2d::LogArguments::formatArgument(FormatBuffer& buffer, std::string_view arguments, std::size_t& pos)
+{
+    auto type = static_cast<Type>(arguments[pos++]);
+    switch (type)
+    {
+        case Type::Int:
+        {
+            std::uint64_t zigzag = 0;
+            if (!decodeVarint(arguments, pos, zigzag))
+            {
+                return false;
+            }
+            const auto value = static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+            Formatter::writeInteger(buffer, static_cast<long long>(value));
+            return true;
+        }
+        case Type::UInt:
+        {
+            std::uint64_t value = 0;
+            if (!decodeVarint(arguments, pos, value))
+            {
+                return false;
+            }
+            Formatter::writeInteger(buffer, static_cast<unsigned long long>(value));
+            return true;
+        }
+        case Type::Float:
+        {
+            double value = 0.0;
+            if (!readValue(arguments, pos, value))
+            {
+                return false;
+            }
+            Formatter::writeFloat(buffer, value);
+            return true;
+        }
+        case Type::Bool:
+        {
+            std::uint8_t value = 0;
+            if (!readValue(arguments, pos, value))
+            {
+                return false;
+            }
+            buffer.append(value != 0 ? '1' : '0');
+            return true;
+        }
+        case Type::Char:
+        {
+            char value = 0;
+            if (!readValue(arguments, pos, value))
+            {
+                return false;
+            }
+            buffer.append(value);
+            return true;
+        }
+        case Type::String:
+        {
+            std::uint64_t length = 0;
+            if (!decodeVarint(arguments, pos, length) || arguments.size() - pos < length)
+            {
+                return false;
+            }
+            buffer.append(arguments.substr(pos, static_cast<std::size_t>(length)));
+            pos += static_cast<std::size_t>(length);
+            return true;
+        }
+    }
+    return false;
+}
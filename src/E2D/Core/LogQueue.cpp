@@ -0,0 +1,121 @@
+/**
+ * @file LogQueue.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "LogQueue.hpp"
+
+namespace
+{
+std::size_t roundUpToPowerOfTwo(std::size_t value)
+{
+    std::size_t result = 2;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+} // namespace
+
+e2d::internal::LogQueue::LogQueue(std::size_t capacity)
+    : m_cells(roundUpToPowerOfTwo(capacity))
+    , m_mask(m_cells.size() - 1)
+{
+    for (std::size_t i = 0; i < this->m_cells.size(); ++i)
+    {
+        this->m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+e2d::internal::LogQueue::~LogQueue() = default;
+
+bool e2d::internal::LogQueue::tryPush(LogLevel                              level,
+                                      std::chrono::system_clock::time_point time,
+                                      std::string_view                      format,
+                                      std::string_view                      arguments)
+{
+    Cell*       cell     = nullptr;
+    std::size_t position = this->m_enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        cell                       = &this->m_cells[position & this->m_mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto        diff     = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (diff == 0)
+        {
+            // The cell is free for this lap, try to claim it
+            if (this->m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The cell still holds a record from the previous lap, the queue is full
+            return false;
+        }
+        else
+        {
+            // Another producer claimed this position first
+            position = this->m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->record.level = level;
+    cell->record.time  = time;
+    cell->record.format.assign(format);
+    cell->record.arguments.assign(arguments);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool e2d::internal::LogQueue::tryPop(LogRecord& record)
+{
+    const std::size_t position = this->m_dequeuePos.load(std::memory_order_relaxed);
+    Cell&             cell     = this->m_cells[position & this->m_mask];
+    const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (sequence != position + 1)
+    {
+        return false;
+    }
+
+    record.level = cell.record.level;
+    record.time  = cell.record.time;
+    record.format.swap(cell.record.format);
+    record.arguments.swap(cell.record.arguments);
+    this->m_dequeuePos.store(position + 1, std::memory_order_relaxed);
+    cell.sequence.store(position + this->m_mask + 1, std::memory_order_release);
+    return true;
+}
+
+std::size_t e2d::internal::LogQueue::getCapacity() const
+{
+    return this->m_cells.size();
+}
+
+std::size_t e2d::internal::LogQueue::getEnqueuePosition() const
+{
+    return this->m_enqueuePos.load();
+}
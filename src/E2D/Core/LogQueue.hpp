@@ -0,0 +1,167 @@
+/**
+ * @file LogQueue.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_CORE_LOG_QUEUE_HPP
+#define E2D_CORE_LOG_QUEUE_HPP
+
+#include <E2D/Core/Export.hpp>
+
+#include <E2D/Core/Logger.hpp>
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace e2d::internal
+{
+
+/**
+ * @struct LogRecord
+ * @ingroup core
+ * @brief @internal A single log message waiting to be written.
+ *
+ * The record holds the raw material of the message: the format string, the encoded arguments and
+ * the time it was logged. Turning that into text is left to the thread that writes the record.
+ * The format string is copied too, since the caller may have built it in a buffer that is gone by
+ * the time the record is written.
+ */
+struct LogRecord
+{
+    /**
+     * @brief Retrieves the format string of the message.
+     *
+     * @return The copy of the format string.
+     */
+    std::string_view getFormat() const
+    {
+        return this->format;
+    }
+
+    LogLevel                              level{E2D_LOG_LEVEL_INFO}; //!< The log level of the message.
+    std::chrono::system_clock::time_point time;                      //!< The time the message was logged.
+    std::string                           format;                    //!< A copy of the format string.
+    std::string                           arguments;                 //!< The arguments, encoded by LogArguments.
+};
+
+/**
+ * @class LogQueue
+ * @ingroup core
+ * @brief @internal A bounded lock-free queue of log records.
+ *
+ * Any number of threads may push records concurrently while a single thread pops them. The queue
+ * is a fixed ring of cells, each carrying a sequence number that tells producers and the consumer
+ * whether the cell is free or holds a record, so neither side ever takes a lock. Pushing to a full
+ * queue fails immediately and leaves it up to the caller to drop the record or try again.
+ *
+ * Format strings and arguments are copied into strings owned by the cells, which keep their capacity
+ * from lap to lap, so once the queue has warmed up pushing and popping does not allocate memory.
+ */
+class E2D_CORE_API LogQueue final : NonCopyable
+{
+public:
+    /**
+     * @brief Constructs a new LogQueue object.
+     *
+     * The capacity is rounded up to the next power of two.
+     *
+     * @param capacity The minimum number of records the queue can hold.
+     */
+    explicit LogQueue(std::size_t capacity);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~LogQueue();
+
+    /**
+     * @brief Attempts to add a record to the queue.
+     *
+     * Safe to call from any number of threads at once.
+     *
+     * @param level The log level of the message.
+     * @param time The time the message was logged.
+     * @param format The format string of the message.
+     * @param arguments The arguments of the message, encoded by LogArguments.
+     * @return True if the record was added, false if the queue was full.
+     */
+    bool tryPush(LogLevel                              level,
+                 std::chrono::system_clock::time_point time,
+                 std::string_view                      format,
+                 std::string_view                      arguments);
+
+    /**
+     * @brief Attempts to remove the oldest record from the queue.
+     *
+     * Must only be called from a single thread at a time. The strings of the record passed
+     * in is handed to the queue in exchange, so reusing the same record avoids allocations.
+     *
+     * @param record Receives the removed record.
+     * @return True if a record was removed, false if the queue was empty.
+     */
+    bool tryPop(LogRecord& record);
+
+    /**
+     * @brief Retrieves the number of records the queue can hold.
+     *
+     * @return The capacity of the queue.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * @brief Retrieves the number of records pushed since the queue was created.
+     *
+     * This includes records whose push is still in progress on another thread.
+     *
+     * @return The position the next record will be pushed to.
+     */
+    std::size_t getEnqueuePosition() const;
+
+private:
+    /**
+     * @struct Cell
+     * @brief A slot in the ring together with its sequence number.
+     */
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence{0}; //!< Tells whether the slot is free or holds a record, and for which lap.
+        LogRecord                record;      //!< The record stored in the slot.
+    };
+
+    std::vector<Cell>        m_cells;         //!< The slots of the ring.
+    std::size_t              m_mask;          //!< The capacity minus one, used to wrap positions.
+    std::atomic<std::size_t> m_enqueuePos{0}; //!< The position the next record is pushed to.
+    std::atomic<std::size_t> m_dequeuePos{0}; //!< The position the next record is popped from.
+
+}; // class LogQueue
+
+} // namespace e2d::internal
+
+#endif //E2D_CORE_LOG_QUEUE_HPP
@@ -0,0 +1,119 @@
+/**
+ * @file LogSink.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/LogSink.hpp>
+
+#include <array>
+#include <ctime>
+
+// ANSI color codes
+#define RESET_COLOR  "\033[0m"
+#define BLUE_COLOR   "\033[34m"
+#define GREEN_COLOR  "\033[32m"
+#define ORANGE_COLOR "\033[33m"
+#define RED_COLOR    "\033[31m"
+
+namespace
+{
+const char* getColorForLogLevel(e2d::LogLevel level)
+{
+    switch (level)
+    {
+        case e2d::E2D_LOG_LEVEL_DEBUG:
+            return BLUE_COLOR;
+        case e2d::E2D_LOG_LEVEL_INFO:
+            return GREEN_COLOR;
+        case e2d::E2D_LOG_LEVEL_WARN:
+            return ORANGE_COLOR;
+        case e2d::E2D_LOG_LEVEL_ERROR:
+            return RED_COLOR;
+    }
+    return RESET_COLOR;
+}
+} // namespace
+
+e2d::LogSink::~LogSink() = default;
+
+void e2d::LogSink::flush()
+{
+}
+
+void e2d::LogSink::formatLine(FormatBuffer& buffer, const LogMessage& message, bool colored)
+{
+    // Sinks are never called concurrently, so the shared buffer of localtime is safe to use
+    const auto    sinceEpoch = message.time.time_since_epoch();
+    const auto    ms         = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch) % 1000;
+    const auto    timeC      = std::chrono::system_clock::to_time_t(message.time);
+    const std::tm localTime  = *std::localtime(&timeC);
+
+    std::array<char, 32> dateTime{};
+    const std::size_t    length = std::strftime(dateTime.data(), dateTime.size(), "%Y-%m-%d %X", &localTime);
+
+    // Pad the log level to the length of the longest one
+    constexpr std::size_t  maxLength = 5;
+    const std::string_view levelName = logLevelToString(message.level);
+
+    buffer.append('[');
+    buffer.append(std::string_view(dateTime.data(), length));
+    buffer.append('.');
+    const auto milliseconds = static_cast<int>(ms.count());
+    buffer.append(static_cast<char>('0' + milliseconds / 100));
+    buffer.append(static_cast<char>('0' + milliseconds / 10 % 10));
+    buffer.append(static_cast<char>('0' + milliseconds % 10));
+    buffer.append("] ");
+    if (colored)
+    {
+        buffer.append(getColorForLogLevel(message.level));
+    }
+    buffer.append(levelName);
+    for (std::size_t i = levelName.size(); i < maxLength; ++i)
+    {
+        buffer.append(' ');
+    }
+    buffer.append(' ');
+    if (colored)
+    {
+        buffer.append(RESET_COLOR);
+    }
+    buffer.append(message.text);
+    buffer.append('\n');
+}
+
+std::string_view e2d::LogSink::logLevelToString(LogLevel level)
+{
+    switch (level)
+    {
+        case E2D_LOG_LEVEL_DEBUG:
+            return "DEBUG";
+        case E2D_LOG_LEVEL_INFO:
+            return "INFO";
+        case E2D_LOG_LEVEL_WARN:
+            return "WARN";
+        case E2D_LOG_LEVEL_ERROR:
+            return "ERROR";
+    }
+    return "UNKNOWN";
+}
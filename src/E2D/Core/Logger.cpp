@@ -24,44 +24,23 @@
  * THE SOFTWARE.
  */
 
+#include "LogQueue.hpp"
+
+#include <E2D/Core/ConsoleLogSink.hpp>
+#include <E2D/Core/LogSink.hpp>
 #include <E2D/Core/Logger.hpp>
 
+#include <algorithm>
 #include <chrono>
-#include <ctime>
-
-#include <iomanip>
-#include <iostream>
-#include <sstream>
-
-#ifdef _WIN32
-#include <windows.h>
-#endif
-
-// ANSI color codes
-#define RESET_COLOR  "\033[0m"
-#define BLUE_COLOR   "\033[34m"
-#define GREEN_COLOR  "\033[32m"
-#define ORANGE_COLOR "\033[33m"
-#define RED_COLOR    "\033[31m"
 
 namespace
 {
-void enableVirtualTerminalProcessing()
-{
-#ifdef _WIN32
-    // Enable VT100 on Windows 10 and later
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (hOut == INVALID_HANDLE_VALUE)
-        return;
-
-    DWORD dwMode = 0;
-    if (!GetConsoleMode(hOut, &dwMode))
-        return;
+// How long the writer thread sleeps when the queue is empty. Producers only wake it explicitly when
+// it is idle, so this also bounds the latency of a wake-up that raced with the writer going to sleep.
+constexpr std::chrono::milliseconds writerIdleInterval{10};
 
-    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-    SetConsoleMode(hOut, dwMode);
-#endif
-}
+// Maximum number of records written while holding the output mutex
+constexpr std::size_t writerBatchSize = 256;
 } // namespace
 
 e2d::Logger::Logger()
@@ -69,81 +48,260 @@ e2d::Logger::Logger()
 #ifdef E2D_DEBUG
     this->m_currentLevel = E2D_LOG_LEVEL_DEBUG;
 #endif
-    enableVirtualTerminalProcessing();
+    this->m_sinks.push_back(std::make_shared<ConsoleLogSink>());
 }
 
+e2d::Logger::~Logger()
+{
+    const std::lock_guard<std::mutex> lock(this->m_controlMutex);
+    this->stopWriter();
+
+    const std::lock_guard<std::mutex> outputLock(this->m_mutex);
+    for (const auto& sink : this->m_sinks)
+    {
+        sink->flush();
+    }
+}
 e2d::Logger& e2d::Logger::getInstance()
 {
     static Logger instance;
     return instance;
 }
 
-void e2d::Logger::logImpl(LogLevel level, const std::string& message)
+void e2d::Logger::setLevel(LogLevel level)
+{
+    getInstance().m_currentLevel.store(level, std::memory_order_relaxed);
+}
+
+e2d::LogLevel e2d::Logger::getLevel()
+{
+    return getInstance().m_currentLevel.load(std::memory_order_relaxed);
+}
+
+bool e2d::Logger::isEnabled(LogLevel level)
+{
+    return static_cast<int>(level) >= E2D_LOG_MIN_LEVEL &&
+           level >= getInstance().m_currentLevel.load(std::memory_order_relaxed);
+}
+
+void e2d::Logger::enableAsync(std::size_t capacity, OverflowPolicy policy)
+{
+    Logger&                           logger = getInstance();
+    const std::lock_guard<std::mutex> lock(logger.m_controlMutex);
+    logger.stopWriter();
+    logger.startWriter(capacity, policy);
+}
+
+void e2d::Logger::disableAsync()
+{
+    Logger&                           logger = getInstance();
+    const std::lock_guard<std::mutex> lock(logger.m_controlMutex);
+    logger.stopWriter();
+}
+
+bool e2d::Logger::isAsyncEnabled()
+{
+    return getInstance().m_async.load();
+}
+
+void e2d::Logger::flush()
+{
+    Logger&                           logger = getInstance();
+    const std::lock_guard<std::mutex> lock(logger.m_controlMutex);
+    if (!logger.m_queue)
+    {
+        const std::lock_guard<std::mutex> outputLock(logger.m_mutex);
+        for (const auto& sink : logger.m_sinks)
+        {
+            sink->flush();
+        }
+        return;
+    }
+
+    // Every record pushed before this point has claimed a position below the enqueue position,
+    // and the writer counts records in queue order, so waiting for it to catch up is sufficient
+    const std::size_t target = logger.m_queue->getEnqueuePosition();
+    logger.wakeWriter();
+
+    std::unique_lock<std::mutex> wakeLock(logger.m_wakeMutex);
+    logger.m_flushCondition.wait(wakeLock, [&logger, target] { return logger.m_written.load() >= target; });
+}
+
+std::size_t e2d::Logger::getDroppedCount()
+{
+    return getInstance().m_dropped.load();
+}
+
+void e2d::Logger::addSink(std::shared_ptr<LogSink> sink)
 {
-    if (level < this->m_currentLevel)
+    if (!sink)
     {
         return;
     }
 
-    std::ostringstream logStream;
-    logStream << "[" << currentDateTime() << "] " << getColorForLogLevel(level) << padLogLevel(logLevelToString(level))
-              << " " << RESET_COLOR << message << "\n";
+    Logger&                           logger = getInstance();
+    const std::lock_guard<std::mutex> lock(logger.m_mutex);
+    logger.m_sinks.push_back(std::move(sink));
+}
+
+void e2d::Logger::removeSink(const std::shared_ptr<LogSink>& sink)
+{
+    Logger&                           logger = getInstance();
+    const std::lock_guard<std::mutex> lock(logger.m_mutex);
+    logger.m_sinks.erase(std::remove(logger.m_sinks.begin(), logger.m_sinks.end(), sink), logger.m_sinks.end());
+}
+
+void e2d::Logger::clearSinks()
+{
+    Logger&                           logger = getInstance();
+    const std::lock_guard<std::mutex> lock(logger.m_mutex);
+    logger.m_sinks.clear();
+}
 
+void e2d::Logger::logImpl(LogLevel level, std::string_view format, std::string_view arguments)
+{
+    const auto time = std::chrono::system_clock::now();
+
+    // The producer count keeps the queue alive while it is being pushed to, see stopWriter
+    this->m_activeProducers.fetch_add(1);
+    if (this->m_async.load())
+    {
+        this->enqueue(level, time, format, arguments);
+        this->m_activeProducers.fetch_sub(1);
+        return;
+    }
+    this->m_activeProducers.fetch_sub(1);
+
+    FormatBuffer                      text;
     const std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->writeToSinks(level, time, format, arguments, text);
+}
 
-    std::cout << logStream.str();
+void e2d::Logger::startWriter(std::size_t capacity, OverflowPolicy policy)
+{
+    this->m_queue          = std::make_unique<internal::LogQueue>(capacity);
+    this->m_overflowPolicy = policy;
+    this->m_written.store(0);
+    this->m_dropped.store(0);
+    this->m_running.store(true);
+    this->m_writerThread = std::thread(&Logger::writerLoop, this);
+    this->m_async.store(true);
 }
 
-std::string e2d::Logger::currentDateTime()
+void e2d::Logger::stopWriter()
 {
-    auto       now       = std::chrono::system_clock::now();
-    auto       ms        = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-    const auto nowC      = std::chrono::system_clock::to_time_t(now);
-    const auto localTime = *std::localtime(&nowC);
+    if (!this->m_queue)
+    {
+        return;
+    }
+
+    // Route new messages to the console directly, then wait for threads that already
+    // decided to use the queue to finish pushing before the writer drains it
+    this->m_async.store(false);
+    while (this->m_activeProducers.load() > 0)
+    {
+        std::this_thread::yield();
+    }
+
+    this->m_running.store(false);
+    this->wakeWriter();
+    this->m_writerThread.join();
+    this->m_queue.reset();
+}
+
+void e2d::Logger::enqueue(LogLevel                              level,
+                          std::chrono::system_clock::time_point time,
+                          std::string_view                      format,
+                          std::string_view                      arguments)
+{
+    while (!this->m_queue->tryPush(level, time, format, arguments))
+    {
+        if (this->m_overflowPolicy == OverflowPolicy::Drop)
+        {
+            this->m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        this->wakeWriter();
+        std::this_thread::yield();
+    }
 
-    std::ostringstream oss;
-    oss << std::put_time(&localTime, "%Y-%m-%d %X") << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    return oss.str();
+    if (this->m_writerSleeping.load())
+    {
+        this->wakeWriter();
+    }
 }
 
-std::string e2d::Logger::logLevelToString(LogLevel level)
+void e2d::Logger::wakeWriter()
 {
-    switch (level)
     {
-        case E2D_LOG_LEVEL_DEBUG:
-            return "DEBUG";
-        case E2D_LOG_LEVEL_INFO:
-            return "INFO";
-        case E2D_LOG_LEVEL_WARN:
-            return "WARN";
-        case E2D_LOG_LEVEL_ERROR:
-            return "ERROR";
+        const std::lock_guard<std::mutex> lock(this->m_wakeMutex);
     }
-    return "UNKNOWN";
+    this->m_wakeCondition.notify_one();
 }
 
-std::string e2d::Logger::padLogLevel(const std::string& logLevel)
+void e2d::Logger::writerLoop()
 {
-    const size_t maxLength = 5; // Maximum length of log levels
-    if (logLevel.length() < maxLength)
+    internal::LogRecord record;
+    FormatBuffer        text;
+    while (true)
     {
-        return logLevel + std::string(maxLength - logLevel.length(), ' ');
+        std::size_t written = 0;
+        {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+            while (written < writerBatchSize && this->m_queue->tryPop(record))
+            {
+                this->writeToSinks(record.level, record.time, record.getFormat(), record.arguments, text);
+                ++written;
+            }
+            if (written > 0)
+            {
+                for (const auto& sink : this->m_sinks)
+                {
+                    sink->flush();
+                }
+            }
+        }
+
+        if (written > 0)
+        {
+            {
+                const std::lock_guard<std::mutex> lock(this->m_wakeMutex);
+                this->m_written.fetch_add(written);
+            }
+            this->m_flushCondition.notify_all();
+            continue;
+        }
+
+        // The queue is empty. Once stopWriter has cleared the running flag no more records can arrive.
+        if (!this->m_running.load())
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(this->m_wakeMutex);
+        this->m_writerSleeping.store(true);
+        this->m_wakeCondition.wait_for(lock, writerIdleInterval);
+        this->m_writerSleeping.store(false);
     }
-    return logLevel;
 }
 
-const char* e2d::Logger::getColorForLogLevel(LogLevel level)
+void e2d::Logger::writeToSinks(LogLevel                              level,
+                               std::chrono::system_clock::time_point time,
+                               std::string_view                      format,
+                               std::string_view                      arguments,
+                               FormatBuffer&                         text)
 {
-    switch (level)
+    if (this->m_sinks.empty())
+    {
+        return;
+    }
+
+    text.clear();
+    LogArguments::format(text, format, arguments);
+
+    const LogMessage message{level, time, format, arguments, text.getView()};
+    for (const auto& sink : this->m_sinks)
     {
-        case E2D_LOG_LEVEL_DEBUG:
-            return BLUE_COLOR;
-        case E2D_LOG_LEVEL_INFO:
-            return GREEN_COLOR;
-        case E2D_LOG_LEVEL_WARN:
-            return ORANGE_COLOR;
-        case E2D_LOG_LEVEL_ERROR:
-            return RED_COLOR;
+        sink->write(message);
     }
-    return RESET_COLOR;
 }
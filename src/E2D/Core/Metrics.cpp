@@ -0,0 +1,334 @@
+/**
+ * @file Metrics.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+/**
+ * @brief Finds the most significant set bit of a value.
+ *
+ * @param value The value, which must not be zero.
+ * @return The index of the highest set bit, counting from the least significant bit.
+ */
+std::size_t findHighestBit(std::uint64_t value)
+{
+    std::size_t bit = 0;
+    for (std::size_t shift = 32; shift > 0; shift /= 2)
+    {
+        if (value >> shift)
+        {
+            value >>= shift;
+            bit += shift;
+        }
+    }
+    return bit;
+}
+
+/**
+ * @brief Lowers an atomic value to the given value if that is smaller.
+ *
+ * @param target The atomic value to update.
+ * @param value The candidate value.
+ */
+void storeMinimum(std::atomic<std::uint64_t>& target, std::uint64_t value)
+{
+    std::uint64_t current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Raises an atomic value to the given value if that is larger.
+ *
+ * @param target The atomic value to update.
+ * @param value The candidate value.
+ */
+void storeMaximum(std::atomic<std::uint64_t>& target, std::uint64_t value)
+{
+    std::uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+} // namespace
+
+e2d::Counter::Counter() = default;
+
+void e2d::Counter::increment(std::uint64_t amount)
+{
+    this->m_shards[getShardIndex()].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+std::uint64_t e2d::Counter::getValue() const
+{
+    std::uint64_t value = 0;
+    for (const auto& shard : this->m_shards)
+    {
+        value += shard.value.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+void e2d::Counter::reset()
+{
+    for (auto& shard : this->m_shards)
+    {
+        shard.value.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t e2d::Counter::getShardIndex()
+{
+    static std::atomic<std::size_t> nextShard{0};
+    thread_local const std::size_t  shard = nextShard.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return shard;
+}
+
+e2d::Gauge::Gauge() = default;
+
+void e2d::Gauge::set(std::int64_t value)
+{
+    this->m_value.store(value, std::memory_order_relaxed);
+}
+
+void e2d::Gauge::add(std::int64_t delta)
+{
+    this->m_value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+std::int64_t e2d::Gauge::getValue() const
+{
+    return this->m_value.load(std::memory_order_relaxed);
+}
+
+e2d::Histogram::Histogram()
+{
+    this->reset();
+}
+
+void e2d::Histogram::record(std::uint64_t value)
+{
+    this->m_buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    this->m_sum.fetch_add(value, std::memory_order_relaxed);
+    storeMinimum(this->m_min, value);
+    storeMaximum(this->m_max, value);
+}
+
+std::uint64_t e2d::Histogram::getCount() const
+{
+    Buckets buckets{};
+    return this->loadBuckets(buckets);
+}
+
+std::uint64_t e2d::Histogram::getPercentile(double percentile) const
+{
+    Buckets             buckets{};
+    const std::uint64_t count = this->loadBuckets(buckets);
+    return this->findPercentile(buckets, count, percentile);
+}
+
+e2d::HistogramSnapshot e2d::Histogram::getSnapshot() const
+{
+    Buckets           buckets{};
+    HistogramSnapshot snapshot;
+    snapshot.count = this->loadBuckets(buckets);
+    if (snapshot.count == 0)
+    {
+        return snapshot;
+    }
+
+    snapshot.sum  = this->m_sum.load(std::memory_order_relaxed);
+    snapshot.min  = this->m_min.load(std::memory_order_relaxed);
+    snapshot.max  = this->m_max.load(std::memory_order_relaxed);
+    snapshot.p50  = this->findPercentile(buckets, snapshot.count, 50.0);
+    snapshot.p90  = this->findPercentile(buckets, snapshot.count, 90.0);
+    snapshot.p99  = this->findPercentile(buckets, snapshot.count, 99.0);
+    snapshot.p999 = this->findPercentile(buckets, snapshot.count, 99.9);
+    return snapshot;
+}
+
+void e2d::Histogram::reset()
+{
+    for (auto& bucket : this->m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    this->m_sum.store(0, std::memory_order_relaxed);
+    this->m_min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    this->m_max.store(0, std::memory_order_relaxed);
+}
+
+std::size_t e2d::Histogram::getBucketIndex(std::uint64_t value)
+{
+    if (value < LinearBucketCount)
+    {
+        return static_cast<std::size_t>(value);
+    }
+
+    // The top five bits of the value select the bucket within its power of two
+    const std::size_t highestBit = findHighestBit(value);
+    const std::size_t shift      = highestBit - 4;
+    const auto        subBucket  = static_cast<std::size_t>(value >> shift) - SubBucketCount;
+    return LinearBucketCount + (highestBit - 5) * SubBucketCount + subBucket;
+}
+
+std::uint64_t e2d::Histogram::getBucketMaximum(std::size_t index)
+{
+    if (index < LinearBucketCount)
+    {
+        return index;
+    }
+
+    const std::size_t   highestBit = (index - LinearBucketCount) / SubBucketCount + 5;
+    const std::size_t   shift      = highestBit - 4;
+    const std::uint64_t subBucket  = (index - LinearBucketCount) % SubBucketCount + SubBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+std::uint64_t e2d::Histogram::loadBuckets(Buckets& buckets) const
+{
+    std::uint64_t count = 0;
+    for (std::size_t index = 0; index < BucketCount; ++index)
+    {
+        buckets[index] = this->m_buckets[index].load(std::memory_order_relaxed);
+        count += buckets[index];
+    }
+    return count;
+}
+
+std::uint64_t e2d::Histogram::findPercentile(const Buckets& buckets, std::uint64_t count, double percentile) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // The rank of the percentile value among the recorded values, starting at one
+    const double  fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+    const auto    ceiling  = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(count)));
+    const auto    rank     = std::max<std::uint64_t>(ceiling, 1);
+    std::uint64_t seen     = 0;
+    for (std::size_t index = 0; index < BucketCount; ++index)
+    {
+        seen += buckets[index];
+        if (seen >= rank)
+        {
+            return std::min(getBucketMaximum(index), this->m_max.load(std::memory_order_relaxed));
+        }
+    }
+    return this->m_max.load(std::memory_order_relaxed);
+}
+
+e2d::Metrics::Metrics() = default;
+
+e2d::Metrics::~Metrics() = default;
+
+e2d::Metrics& e2d::Metrics::getInstance()
+{
+    static Metrics instance;
+    return instance;
+}
+
+e2d::Counter& e2d::Metrics::getCounter(const std::string& name)
+{
+    auto&                             instance = getInstance();
+    const std::lock_guard<std::mutex> lock(instance.m_mutex);
+
+    auto& counter = instance.m_counters[name];
+    if (!counter)
+    {
+        counter = std::make_unique<Counter>();
+    }
+    return *counter;
+}
+
+e2d::Gauge& e2d::Metrics::getGauge(const std::string& name)
+{
+    auto&                             instance = getInstance();
+    const std::lock_guard<std::mutex> lock(instance.m_mutex);
+
+    auto& gauge = instance.m_gauges[name];
+    if (!gauge)
+    {
+        gauge = std::make_unique<Gauge>();
+    }
+    return *gauge;
+}
+
+e2d::Histogram& e2d::Metrics::getHistogram(const std::string& name)
+{
+    auto&                             instance = getInstance();
+    const std::lock_guard<std::mutex> lock(instance.m_mutex);
+
+    auto& histogram = instance.m_histograms[name];
+    if (!histogram)
+    {
+        histogram = std::make_unique<Histogram>();
+    }
+    return *histogram;
+}
+
+e2d::MetricsSnapshot e2d::Metrics::getSnapshot()
+{
+    auto&                             instance = getInstance();
+    const std::lock_guard<std::mutex> lock(instance.m_mutex);
+
+    MetricsSnapshot snapshot;
+    for (const auto& [name, counter] : instance.m_counters)
+    {
+        snapshot.counters.emplace(name, counter->getValue());
+    }
+    for (const auto& [name, gauge] : instance.m_gauges)
+    {
+        snapshot.gauges.emplace(name, gauge->getValue());
+    }
+    for (const auto& [name, histogram] : instance.m_histograms)
+    {
+        snapshot.histograms.emplace(name, histogram->getSnapshot());
+    }
+    return snapshot;
+}
+
+void e2d::Metrics::reset()
+{
+    auto&                             instance = getInstance();
+    const std::lock_guard<std::mutex> lock(instance.m_mutex);
+
+    for (const auto& counter : instance.m_counters)
+    {
+        counter.second->reset();
+    }
+    for (const auto& histogram : instance.m_histograms)
+    {
+        histogram.second->reset();
+    }
+}
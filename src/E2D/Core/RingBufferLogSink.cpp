@@ -0,0 +1,163 @@
+/**
+ * @file RingBufferLogSink.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/RingBufferLogSink.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+
+namespace
+{
+std::atomic<const e2d::RingBufferLogSink*> crashDumpSink{nullptr};
+std::terminate_handler                     previousTerminateHandler = nullptr;
+
+constexpr std::array<int, 4> crashSignals = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+} // namespace
+
+e2d::RingBufferLogSink::RingBufferLogSink(std::size_t capacity)
+    : m_messages(capacity > 0 ? capacity : 1)
+{
+}
+
+e2d::RingBufferLogSink::~RingBufferLogSink()
+{
+    const RingBufferLogSink* expected = this;
+    crashDumpSink.compare_exchange_strong(expected, nullptr);
+}
+
+void e2d::RingBufferLogSink::write(const LogMessage& message)
+{
+    FormatBuffer line;
+    formatLine(line, message, false);
+
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    // Assigning keeps the capacity of the replaced string, so a full ring stops allocating
+    this->m_messages[this->m_next].assign(line.getView());
+    this->m_next  = (this->m_next + 1) % this->m_messages.size();
+    this->m_count = std::min(this->m_count + 1, this->m_messages.size());
+}
+
+std::vector<std::string> e2d::RingBufferLogSink::getMessages() const
+{
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    std::vector<std::string> messages;
+    messages.reserve(this->m_count);
+    const std::size_t first = (this->m_next + this->m_messages.size() - this->m_count) % this->m_messages.size();
+    for (std::size_t i = 0; i < this->m_count; ++i)
+    {
+        messages.push_back(this->m_messages[(first + i) % this->m_messages.size()]);
+    }
+    return messages;
+}
+
+void e2d::RingBufferLogSink::dump(std::ostream& stream) const
+{
+    for (const auto& message : this->getMessages())
+    {
+        stream << message;
+    }
+    stream.flush();
+}
+
+bool e2d::RingBufferLogSink::dumpToFile(const std::string& filepath) const
+{
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+    this->dump(file);
+    return file.good();
+}
+
+void e2d::RingBufferLogSink::enableCrashDump(const std::string& filepath)
+{
+    {
+        const std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_crashDumpFilepath = filepath;
+    }
+
+    if (crashDumpSink.exchange(this) == nullptr)
+    {
+        previousTerminateHandler = std::set_terminate(&RingBufferLogSink::onTerminate);
+        for (const int signal : crashSignals)
+        {
+            std::signal(signal, &RingBufferLogSink::onSignal);
+        }
+    }
+}
+
+void e2d::RingBufferLogSink::dumpOnCrash(const char* filepath) const
+{
+    // The crashing thread may hold the lock, in which case the buffer is dumped as it is
+    const std::unique_lock<std::mutex> lock(this->m_mutex, std::try_to_lock);
+
+    std::FILE* file = std::fopen(filepath, "wb");
+    if (file == nullptr)
+    {
+        return;
+    }
+    const std::size_t first = (this->m_next + this->m_messages.size() - this->m_count) % this->m_messages.size();
+    for (std::size_t i = 0; i < this->m_count; ++i)
+    {
+        const std::string& message = this->m_messages[(first + i) % this->m_messages.size()];
+        std::fwrite(message.data(), 1, message.size(), file);
+    }
+    std::fclose(file);
+}
+
+void e2d::RingBufferLogSink::onTerminate()
+{
+    if (const RingBufferLogSink* sink = crashDumpSink.exchange(nullptr))
+    {
+        sink->dumpOnCrash(sink->m_crashDumpFilepath.c_str());
+    }
+
+    if (previousTerminateHandler != nullptr)
+    {
+        previousTerminateHandler();
+    }
+    std::abort();
+}
+
+void e2d::RingBufferLogSink::onSignal(int signal)
+{
+    if (const RingBufferLogSink* sink = crashDumpSink.exchange(nullptr))
+    {
+        sink->dumpOnCrash(sink->m_crashDumpFilepath.c_str());
+    }
+
+    // Let the default handler end the program
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
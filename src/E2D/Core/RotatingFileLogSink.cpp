@@ -0,0 +1,98 @@
+/**
+ * @file RotatingFileLogSink.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/RotatingFileLogSink.hpp>
+
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+e2d::RotatingFileLogSink::RotatingFileLogSink(std::string filepath, std::size_t maxFileSize, std::size_t maxBackupFiles)
+    : m_filepath(std::move(filepath))
+    , m_maxFileSize(maxFileSize)
+    , m_maxBackupFiles(maxBackupFiles)
+{
+    std::error_code error;
+    const auto      size = std::filesystem::file_size(this->m_filepath, error);
+    this->m_fileSize     = error ? 0 : static_cast<std::size_t>(size);
+    this->m_file.open(this->m_filepath, std::ios::binary | std::ios::app);
+}
+
+e2d::RotatingFileLogSink::~RotatingFileLogSink() = default;
+
+void e2d::RotatingFileLogSink::write(const LogMessage& message)
+{
+    if (!this->m_file.is_open())
+    {
+        return;
+    }
+
+    FormatBuffer line;
+    formatLine(line, message, false);
+
+    if (this->m_fileSize > 0 && this->m_fileSize + line.getSize() > this->m_maxFileSize)
+    {
+        this->rotate();
+    }
+
+    this->m_file.write(line.getData(), static_cast<std::streamsize>(line.getSize()));
+    this->m_fileSize += line.getSize();
+}
+
+void e2d::RotatingFileLogSink::flush()
+{
+    this->m_file.flush();
+}
+
+bool e2d::RotatingFileLogSink::isOpen() const
+{
+    return this->m_file.is_open();
+}
+
+void e2d::RotatingFileLogSink::rotate()
+{
+    this->m_file.close();
+
+    // Errors are ignored, a file that cannot be moved is simply overwritten or left behind
+    std::error_code error;
+    if (this->m_maxBackupFiles > 0)
+    {
+        std::filesystem::remove(this->getBackupPath(this->m_maxBackupFiles), error);
+        for (std::size_t index = this->m_maxBackupFiles - 1; index > 0; --index)
+        {
+            std::filesystem::rename(this->getBackupPath(index), this->getBackupPath(index + 1), error);
+        }
+        std::filesystem::rename(this->m_filepath, this->getBackupPath(1), error);
+    }
+
+    this->m_file.open(this->m_filepath, std::ios::binary | std::ios::trunc);
+    this->m_fileSize = 0;
+}
+
+std::string e2d::RotatingFileLogSink::getBackupPath(std::size_t index) const
+{
+    return this->m_filepath + "." + std::to_string(index);
+}
@@ -29,23 +29,47 @@
 
 #include <E2D/Engine/Application.hpp>
 #include <E2D/Engine/CoreSystem.hpp>
+#include <E2D/Engine/EngineMetrics.hpp>
 #include <E2D/Engine/Event.hpp>
 #include <E2D/Engine/FontSystem.hpp>
 #include <E2D/Engine/GraphicsSystem.hpp>
+#include <E2D/Engine/InputRecording.hpp>
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderScaleController.hpp>
+#include <E2D/Engine/ResourceRegistry.hpp>
 #include <E2D/Engine/Scene.hpp>
 #include <E2D/Engine/SceneManager.hpp>
 #include <E2D/Engine/SystemManager.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
 #include <utility>
 
-e2d::Application::Application(std::string windowTitle) :
+e2d::Application::Application(std::string windowTitle, RenderMode renderMode) :
+Application(std::move(windowTitle), WindowSettings{}, RendererSettings{}, renderMode)
+{
+}
+
+e2d::Application::Application(std::string      windowTitle,
+                              WindowSettings   windowSettings,
+                              RendererSettings rendererSettings,
+                              RenderMode       renderMode) :
 m_windowTitle(std::move(windowTitle)),
+m_renderMode(renderMode),
+m_windowSettings(windowSettings),
+m_rendererSettings(std::move(rendererSettings)),
 m_sceneManager(std::make_unique<SceneManager>()),
-m_backgroundColor(Color::Black)
+m_backgroundColor(Color::Black),
+m_renderScaleController(std::make_unique<internal::RenderScaleController>())
 {
     log::debug("Constructing Application");
+
+    // Register the engine metrics up front so that they are part of every snapshot
+    internal::EngineMetrics::getInstance();
 }
 
 e2d::Application::~Application()
@@ -63,7 +87,10 @@ int e2d::Application::run()
         log::error("Failed to initialize core system. Aborting application startup.");
         return -1;
     }
-    if (!systemManager.initialize<GraphicsSystem>())
+    if (!systemManager.initialize<GraphicsSystem>(this->m_renderMode,
+                                                  this->m_windowTitle,
+                                                  this->m_windowSettings,
+                                                  this->m_rendererSettings))
     {
         log::error("Failed to initialize graphics system. Aborting application startup.");
         return -1;
@@ -75,14 +102,21 @@ int e2d::Application::run()
     }
 
     auto& rendererContext = internal::RendererContext::getInstance();
-    rendererContext.initialize();
+    rendererContext.getRenderer().setPartialRedraw(this->m_partialRedraw);
+    rendererContext.getRenderer().setRenderScale(this->m_renderScale);
+    rendererContext.getRenderer().setScaleFilter(this->m_renderScaleFilter);
 
-    Timer        targetFrameTimer;
-    double const targetFrameTime = 1.0 / 60.0;
+    Timer targetFrameTimer;
 
     double elapsedTime = 0.0;
     double remainder   = 0.0;
 
+    const auto&            metrics = internal::EngineMetrics::getInstance();
+    internal::RecordedFrame inputFrame;
+    std::uint64_t          previousFrameTime = 0;
+
+    std::optional<std::chrono::steady_clock::time_point> previousFrameStart;
+
     this->m_running = true;
     this->onRunning();
 
@@ -94,52 +128,170 @@ int e2d::Application::run()
         }
         else
         {
-            const auto& scene = this->m_sceneManager->getActiveScene();
+            // Holds on to the scene, since it may pop itself from the scene manager during the frame
+            const auto scene = this->m_sceneManager->getActiveScene();
+
+            const auto frameStart = std::chrono::steady_clock::now();
+            auto       phaseStart = frameStart;
+            const auto endPhase   = [&phaseStart](Histogram& histogram)
+            {
+                const auto phaseEnd = std::chrono::steady_clock::now();
+                histogram.record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(phaseEnd - phaseStart).count()));
+                phaseStart = phaseEnd;
+            };
+
+            // The whole previous frame counts against the budget, from its start to the start of this one,
+            // including the updates and the wait for the frame rate limit
+            if (previousFrameStart && this->m_renderScaleController->getBudget() > 0)
+            {
+                const std::chrono::duration<double> frameTime   = frameStart - *previousFrameStart;
+                const float                         renderScale = this->m_renderScaleController->update(
+                    frameTime.count(), this->m_renderScale);
+                if (renderScale != this->m_renderScale)
+                {
+                    log::debug("Changing render scale from {} to {}", this->m_renderScale, renderScale);
+                    this->m_renderScale = renderScale;
+                    rendererContext.getRenderer().setRenderScale(renderScale);
+                }
+            }
+            previousFrameStart = frameStart;
 
             targetFrameTimer.start();
             double elapsedFrameTimeAsSeconds = targetFrameTimer.getElapsedTimeAsSeconds();
 
-            while (const std::optional<Event> event = pollEvent())
+            const bool replaying = this->isReplaying();
+            if (replaying)
             {
-                if (event->is<Event::Closed>())
+                // Live input is ignored during a replay, except for closing the application
+                while (const std::optional<Event> event = pollEvent())
+                {
+                    if (event->is<Event::Closed>())
+                    {
+                        this->quit();
+                    }
+                }
+
+                if (!this->m_inputPlayer->next(inputFrame))
                 {
+                    log::info("Replay finished after {} frames", this->m_inputPlayer->getFrameCount());
+                    this->stopReplay();
                     this->quit();
+                    continue;
                 }
-                else if (event.has_value())
+
+                for (const auto& event : inputFrame.events)
+                {
+                    scene->handleEvent(event);
+                }
+            }
+            else
+            {
+                inputFrame.events.clear();
+
+                while (const std::optional<Event> event = pollEvent())
                 {
-                    scene->handleEvent(event.value());
+                    if (event->is<Event::Closed>())
+                    {
+                        this->quit();
+                    }
+                    else if (event.has_value())
+                    {
+                        scene->handleEvent(event.value());
+                        if (this->isRecording())
+                        {
+                            inputFrame.events.push_back(event.value());
+                        }
+                    }
                 }
             }
+            endPhase(metrics.eventsTime);
 
             if (!scene->isPaused())
             {
                 scene->fixedUpdate();
             }
 
-            while (elapsedFrameTimeAsSeconds < targetFrameTime - remainder)
+            // A replayed frame consumes the time its recorded frame consumed, rather than what the clock says
+            const double recordedTime = static_cast<double>(inputFrame.deltaTime) / 1e9;
+            if (this->m_frameRateLimit == 0)
             {
-                const auto currentTime    = targetFrameTimer.getElapsedTimeAsSeconds();
-                const auto deltaTime      = currentTime - elapsedFrameTimeAsSeconds;
-                elapsedFrameTimeAsSeconds = currentTime;
-
+                // Without a limit every frame gets a single variable update covering the previous frame
+                const double deltaTime    = replaying ? recordedTime : static_cast<double>(previousFrameTime) / 1e9;
+                elapsedFrameTimeAsSeconds = deltaTime;
                 if (!scene->isPaused())
                 {
                     scene->variableUpdate(deltaTime);
                 }
             }
+            else
+            {
+                if (replaying)
+                {
+                    elapsedFrameTimeAsSeconds = 0.0;
+                }
+
+                const double targetFrameTime = 1.0 / static_cast<double>(this->m_frameRateLimit);
+                while (elapsedFrameTimeAsSeconds < targetFrameTime - remainder)
+                {
+                    const auto currentTime    = replaying ? recordedTime : targetFrameTimer.getElapsedTimeAsSeconds();
+                    const auto frameDeltaTime = currentTime - elapsedFrameTimeAsSeconds;
+                    elapsedFrameTimeAsSeconds = currentTime;
+
+                    if (!scene->isPaused())
+                    {
+                        scene->variableUpdate(frameDeltaTime);
+                    }
+
+                    if (replaying)
+                    {
+                        // The recorded time is all the frame gets, so it is spent in one update
+                        break;
+                    }
+                }
+
+                if (replaying)
+                {
+                    // Keeps the pace of the recording instead of waiting in variable updates
+                    std::this_thread::sleep_until(frameStart + std::chrono::nanoseconds(inputFrame.deltaTime));
+                }
+
+                remainder = elapsedFrameTimeAsSeconds - (targetFrameTime - remainder);
+                if (remainder >= targetFrameTime)
+                {
+                    remainder = 0.0;
+                }
+            }
 
-            remainder = elapsedFrameTimeAsSeconds - (targetFrameTime - remainder);
-            if (remainder >= targetFrameTime)
+            if (this->isRecording())
             {
-                remainder = 0.0;
+                inputFrame.deltaTime = static_cast<std::uint64_t>(elapsedFrameTimeAsSeconds * 1e9);
+                if (!this->m_inputRecorder->record(inputFrame))
+                {
+                    log::error("Failed to record frame, stopping recording");
+                    this->stopRecording();
+                }
             }
+            endPhase(metrics.updateTime);
+
+            ResourceRegistry::getInstance().applyPendingReloads();
 
             scene->draw();
+            endPhase(metrics.drawTime);
 
             rendererContext.getRenderer().render(this->m_backgroundColor);
+            endPhase(metrics.renderTime);
 
             scene->clean();
             this->m_sceneManager->clean();
+            endPhase(metrics.cleanTime);
+
+            const auto frameTime = std::chrono::steady_clock::now() - frameStart;
+            metrics.frameTime.record(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(frameTime).count()));
+
+            previousFrameTime = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(frameTime).count());
 
             elapsedTime += elapsedFrameTimeAsSeconds;
             if (elapsedTime >= 1.0)
@@ -149,6 +301,9 @@ int e2d::Application::run()
         }
     }
 
+    this->stopRecording();
+    this->stopReplay();
+
     systemManager.shutdown();
 
     return this->m_exitCode;
@@ -165,6 +320,16 @@ void e2d::Application::quit(int exitCode)
     this->m_running  = false;
 }
 
+unsigned int e2d::Application::getFrameRateLimit() const
+{
+    return this->m_frameRateLimit;
+}
+
+void e2d::Application::setFrameRateLimit(unsigned int frameRateLimit)
+{
+    this->m_frameRateLimit = frameRateLimit;
+}
+
 const e2d::Color& e2d::Application::getBackgroundColor() const
 {
     return this->m_backgroundColor;
@@ -175,6 +340,140 @@ void e2d::Application::setBackgroundColor(const e2d::Color& backgroundColor)
     this->m_backgroundColor = backgroundColor;
 }
 
+void e2d::Application::setPartialRedraw(bool enabled)
+{
+    this->m_partialRedraw = enabled;
+    if (this->m_running)
+    {
+        internal::RendererContext::getInstance().getRenderer().setPartialRedraw(enabled);
+    }
+}
+
+bool e2d::Application::isPartialRedraw() const
+{
+    return this->m_partialRedraw;
+}
+
+void e2d::Application::setRenderScale(float renderScale)
+{
+    this->m_renderScale = std::clamp(renderScale, internal::Renderer::MinRenderScale, 1.f);
+    if (this->m_running)
+    {
+        internal::RendererContext::getInstance().getRenderer().setRenderScale(this->m_renderScale);
+    }
+}
+
+float e2d::Application::getRenderScale() const
+{
+    return this->m_renderScale;
+}
+
+void e2d::Application::setRenderScaleFilter(e2d::ScaleFilter scaleFilter)
+{
+    this->m_renderScaleFilter = scaleFilter;
+    if (this->m_running)
+    {
+        internal::RendererContext::getInstance().getRenderer().setScaleFilter(scaleFilter);
+    }
+}
+
+e2d::ScaleFilter e2d::Application::getRenderScaleFilter() const
+{
+    return this->m_renderScaleFilter;
+}
+
+void e2d::Application::setRenderTimeBudget(double budget)
+{
+    this->m_renderScaleController->setBudget(budget);
+}
+
+double e2d::Application::getRenderTimeBudget() const
+{
+    return this->m_renderScaleController->getBudget();
+}
+
+bool e2d::Application::startRecording(const std::string& filepath)
+{
+    auto recorder = std::make_unique<internal::InputRecorder>();
+    if (!recorder->open(filepath))
+    {
+        log::error("Failed to start recording input to '{}'", filepath);
+        return false;
+    }
+
+    log::info("Recording input to '{}'", filepath);
+    this->m_inputRecorder = std::move(recorder);
+    return true;
+}
+
+void e2d::Application::stopRecording()
+{
+    if (this->m_inputRecorder)
+    {
+        log::info("Recorded {} frames of input", this->m_inputRecorder->getFrameCount());
+        this->m_inputRecorder.reset();
+    }
+}
+
+bool e2d::Application::isRecording() const
+{
+    return this->m_inputRecorder != nullptr;
+}
+
+bool e2d::Application::startReplay(const std::string& filepath)
+{
+    auto player = std::make_unique<internal::InputPlayer>();
+    if (!player->open(filepath))
+    {
+        log::error("Failed to start replaying input from '{}'", filepath);
+        return false;
+    }
+
+    log::info("Replaying input from '{}'", filepath);
+    this->m_inputPlayer = std::move(player);
+    return true;
+}
+
+void e2d::Application::stopReplay()
+{
+    this->m_inputPlayer.reset();
+}
+
+bool e2d::Application::isReplaying() const
+{
+    return this->m_inputPlayer != nullptr;
+}
+
+e2d::RenderMode e2d::Application::getRenderMode() const
+{
+    return this->m_renderMode;
+}
+
+const e2d::WindowSettings& e2d::Application::getWindowSettings() const
+{
+    return this->m_windowSettings;
+}
+
+const e2d::RendererSettings& e2d::Application::getRendererSettings() const
+{
+    return this->m_rendererSettings;
+}
+
+void e2d::Application::setFrameCaptureEnabled(bool enabled)
+{
+    internal::RendererContext::getInstance().getRenderer().setCaptureEnabled(enabled);
+}
+
+bool e2d::Application::isFrameCaptureEnabled() const
+{
+    return internal::RendererContext::getInstance().getRenderer().isCaptureEnabled();
+}
+
+const e2d::FrameCapture& e2d::Application::getCapturedFrame() const
+{
+    return internal::RendererContext::getInstance().getRenderer().getCapturedFrame();
+}
+
 e2d::SceneManager& e2d::Application::getSceneManager() const
 {
     return *this->m_sceneManager;
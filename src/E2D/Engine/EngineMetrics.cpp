@@ -0,0 +1,48 @@
+/**
+ * @file EngineMetrics.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/EngineMetrics.hpp>
+
+const e2d::internal::EngineMetrics& e2d::internal::EngineMetrics::getInstance()
+{
+    static const EngineMetrics instance{Metrics::getGauge("objects.alive"),
+                                        Metrics::getCounter("renderer.renderables_drawn"),
+                                        Metrics::getCounter("renderer.draw_calls"),
+                                        Metrics::getCounter("renderer.texture_switches"),
+                                        Metrics::getCounter("renderer.layer_bakes"),
+                                        Metrics::getCounter("renderer.chunk_bakes"),
+                                        Metrics::getCounter("renderer.frames_skipped"),
+                                        Metrics::getCounter("events.dispatched"),
+                                        Metrics::getCounter("resources.loaded"),
+                                        Metrics::getCounter("resources.bytes_loaded"),
+                                        Metrics::getHistogram("frame.time_us"),
+                                        Metrics::getHistogram("frame.events_us"),
+                                        Metrics::getHistogram("frame.update_us"),
+                                        Metrics::getHistogram("frame.draw_us"),
+                                        Metrics::getHistogram("frame.render_us"),
+                                        Metrics::getHistogram("frame.clean_us")};
+    return instance;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file EngineMetrics.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_ENGINE_METRICS_HPP
+#define E2D_ENGINE_ENGINE_METRICS_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/Metrics.hpp>
+
+namespace e2d::internal
+{
+
+/**
+ * @struct EngineMetrics
+ * @ingroup engine
+ * @brief @internal The metrics the engine itself records.
+ *
+ * Looking up a metric by name takes a lock, so the engine looks its metrics up once and keeps the
+ * references here. The metrics are registered as soon as the instance is first retrieved, which
+ * the Application does on construction, so they show up in snapshots even before they change.
+ * See Metrics for the names they are registered under.
+ */
+struct E2D_ENGINE_API EngineMetrics
+{
+    /**
+     * @brief Retrieves the engine metrics, registering them on first use.
+     *
+     * @return The engine metrics.
+     */
+    static const EngineMetrics& getInstance();
+
+    Gauge&     objectsAlive;     //!< The number of Object instances.
+    Counter&   renderablesDrawn; //!< The number of Renderable objects rendered.
+    Counter&   drawCalls;        //!< The number of textures copied to the screen.
+    Counter&   textureSwitches;  //!< The number of draw calls with a different texture than the previous one.
+    Counter&   layerBakes;       //!< The number of times a static layer was rendered into its cache.
+    Counter&   chunkBakes;       //!< The number of tile map chunks rendered into their textures.
+    Counter&   framesSkipped;    //!< The number of frames not presented because nothing changed.
+    Counter&   eventsDispatched; //!< The number of events handed to the active scene.
+    Counter&   resourcesLoaded;  //!< The number of resources added to the ResourceRegistry.
+    Counter&   bytesLoaded;      //!< The size of the data those resources were loaded from.
+    Histogram& frameTime;        //!< The time each frame took, in microseconds.
+    Histogram& eventsTime;       //!< The time spent polling and dispatching events each frame, in microseconds.
+    Histogram& updateTime;       //!< The time spent in fixed and variable updates each frame, in microseconds.
+    Histogram& drawTime;         //!< The time spent queueing renderables each frame, in microseconds.
+    Histogram& renderTime;       //!< The time spent rendering and presenting each frame, in microseconds.
+    Histogram& cleanTime;        //!< The time spent destroying removed objects and scenes each frame, in microseconds.
+};
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_ENGINE_METRICS_HPP
@@ -0,0 +1,272 @@
+/**
+ * @file FileWatcher.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Config.hpp>
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/FileWatcher.hpp>
+
+#if defined(E2D_SYSTEM_LINUX)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <system_error>
+#include <unordered_set>
+
+namespace
+{
+constexpr int pollIntervalMs = 100; //!< How long to wait for events before dispatching collected changes.
+constexpr int scanIntervalMs = 500; //!< How often modification times are polled without inotify.
+
+std::string toCanonicalPath(const std::string& filepath)
+{
+    std::error_code error;
+    const auto      canonical = std::filesystem::weakly_canonical(filepath, error);
+    return error ? filepath : canonical.string();
+}
+
+std::filesystem::file_time_type lastWriteTime(const std::string& filepath)
+{
+    std::error_code error;
+    const auto      time = std::filesystem::last_write_time(filepath, error);
+    return error ? std::filesystem::file_time_type::min() : time;
+}
+} // namespace
+
+e2d::internal::FileWatcher::FileWatcher(Callback callback) : m_callback(std::move(callback))
+{
+    log::debug("Constructing FileWatcher");
+}
+
+e2d::internal::FileWatcher::~FileWatcher()
+{
+    log::debug("Destructing FileWatcher");
+    this->stop();
+}
+
+bool e2d::internal::FileWatcher::start()
+{
+    if (this->m_running)
+    {
+        return true;
+    }
+
+#if defined(E2D_SYSTEM_LINUX)
+    {
+        const std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (this->m_inotify < 0)
+        {
+            log::warn("Failed to initialize inotify, falling back to polling for file changes");
+        }
+
+        // Files watched before starting could not be registered with inotify yet
+        this->m_directories.clear();
+        for (const auto& entry : this->m_files)
+        {
+            this->watchDirectory(std::filesystem::path(entry.first).parent_path());
+        }
+    }
+#endif
+
+    this->m_running = true;
+    this->m_thread  = std::thread(&FileWatcher::run, this);
+    return true;
+}
+
+void e2d::internal::FileWatcher::stop()
+{
+    this->m_running = false;
+    if (this->m_thread.joinable())
+    {
+        this->m_thread.join();
+    }
+
+#if defined(E2D_SYSTEM_LINUX)
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+    if (this->m_inotify >= 0)
+    {
+        close(this->m_inotify);
+        this->m_inotify = -1;
+    }
+#endif
+}
+
+bool e2d::internal::FileWatcher::isRunning() const
+{
+    return this->m_running;
+}
+
+void e2d::internal::FileWatcher::watch(const std::string& filepath)
+{
+    const auto canonicalPath = toCanonicalPath(filepath);
+
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    auto& file = this->m_files[canonicalPath];
+    if (file.filepaths.empty())
+    {
+        file.lastModified = lastWriteTime(canonicalPath);
+        this->watchDirectory(std::filesystem::path(canonicalPath).parent_path());
+    }
+    if (std::find(file.filepaths.begin(), file.filepaths.end(), filepath) == file.filepaths.end())
+    {
+        file.filepaths.push_back(filepath);
+    }
+}
+
+void e2d::internal::FileWatcher::run()
+{
+    log::debug("File watcher thread started");
+
+    std::vector<std::string> candidates;
+    auto                     lastScan = std::chrono::steady_clock::now();
+
+    while (this->m_running)
+    {
+#if defined(E2D_SYSTEM_LINUX)
+        if (this->m_inotify >= 0)
+        {
+            pollfd descriptor{this->m_inotify, POLLIN, 0};
+            if (poll(&descriptor, 1, pollIntervalMs) > 0 && (descriptor.revents & POLLIN) != 0)
+            {
+                alignas(inotify_event) char buffer[4096];
+
+                ssize_t length = 0;
+                while ((length = read(this->m_inotify, buffer, sizeof(buffer))) > 0)
+                {
+                    const std::lock_guard<std::mutex> lock(this->m_mutex);
+                    for (ssize_t offset = 0; offset < length;)
+                    {
+                        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                        const auto directory = this->m_directories.find(event->wd);
+                        if (event->len == 0 || directory == this->m_directories.end())
+                        {
+                            continue;
+                        }
+
+                        auto path = (std::filesystem::path(directory->second) / event->name).string();
+                        if (this->m_files.count(path) != 0)
+                        {
+                            candidates.push_back(std::move(path));
+                        }
+                    }
+                }
+
+                // Keep collecting until the files have been quiet for a full interval
+                continue;
+            }
+
+            if (!candidates.empty())
+            {
+                this->dispatch(candidates);
+                candidates.clear();
+            }
+            continue;
+        }
+#endif
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(pollIntervalMs));
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastScan >= std::chrono::milliseconds(scanIntervalMs))
+        {
+            lastScan = now;
+            this->dispatch({});
+        }
+    }
+
+    log::debug("File watcher thread stopped");
+}
+
+void e2d::internal::FileWatcher::watchDirectory(const std::filesystem::path& directory)
+{
+#if defined(E2D_SYSTEM_LINUX)
+    if (this->m_inotify < 0)
+    {
+        return;
+    }
+
+    const auto descriptor = inotify_add_watch(this->m_inotify,
+                                              directory.c_str(),
+                                              IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (descriptor < 0)
+    {
+        log::warn("Failed to watch directory '{}' for changes", directory.string());
+        return;
+    }
+    this->m_directories[descriptor] = directory.string();
+#else
+    (void)directory;
+#endif
+}
+
+void e2d::internal::FileWatcher::dispatch(const std::vector<std::string>& candidates)
+{
+    std::vector<std::string> modified;
+    {
+        const std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        const auto checkFile = [&modified](const std::string& path, WatchedFile& file)
+        {
+            const auto lastModified = lastWriteTime(path);
+            if (lastModified != file.lastModified && lastModified != std::filesystem::file_time_type::min())
+            {
+                file.lastModified = lastModified;
+                modified.insert(modified.end(), file.filepaths.begin(), file.filepaths.end());
+            }
+        };
+
+        if (candidates.empty())
+        {
+            for (auto& [path, file] : this->m_files)
+            {
+                checkFile(path, file);
+            }
+        }
+        else
+        {
+            const std::unordered_set<std::string> unique(candidates.begin(), candidates.end());
+            for (const auto& path : unique)
+            {
+                checkFile(path, this->m_files.at(path));
+            }
+        }
+    }
+
+    // Invoke the callback without holding the lock, it may watch further files
+    for (const auto& filepath : modified)
+    {
+        log::info("Detected modification of '{}'", filepath);
+        this->m_callback(filepath);
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ * @file FileWatcher.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_FILE_WATCHER_HPP
+#define E2D_ENGINE_FILE_WATCHER_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace e2d::internal
+{
+
+/**
+ * @class FileWatcher
+ * @ingroup engine
+ * @brief @internal Watches files for modifications on a background thread.
+ *
+ * On Linux the watcher uses inotify on the directories containing the watched files, which keeps
+ * working when editors save by replacing a file instead of writing it in place. On other systems
+ * the modification times of the watched files are polled twice per second. In both cases a file is
+ * only reported once its modification time actually changed and no further events arrived for a
+ * short moment, so a file that is still being written is not reported half-way.
+ */
+class E2D_ENGINE_API FileWatcher final : NonCopyable
+{
+public:
+    /**
+     * @brief Function invoked on the watcher thread with the path of a modified file.
+     *
+     * The path is passed exactly as it was given to watch().
+     */
+    using Callback = std::function<void(const std::string& filepath)>;
+
+    /**
+     * @brief Constructs a new FileWatcher object.
+     *
+     * @param callback The function to invoke for every modified file.
+     */
+    explicit FileWatcher(Callback callback);
+
+    /**
+     * @brief Destructor.
+     *
+     * Stops the watcher thread if it is still running.
+     */
+    ~FileWatcher();
+
+    /**
+     * @brief Starts watching on a background thread.
+     *
+     * @return True if the watcher is running, false if it could not be started.
+     */
+    bool start();
+
+    /**
+     * @brief Stops watching and joins the background thread.
+     */
+    void stop();
+
+    /**
+     * @brief Checks if the watcher thread is running.
+     *
+     * @return True if the watcher is running, false otherwise.
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Adds a file to the set of watched files.
+     *
+     * Watching the same file more than once has no effect. Files may be added from any thread,
+     * before or after the watcher was started.
+     *
+     * @param filepath Path to the file to watch.
+     */
+    void watch(const std::string& filepath);
+
+private:
+    /**
+     * @struct WatchedFile
+     * @brief A watched file and the paths it was registered under.
+     */
+    struct WatchedFile
+    {
+        std::vector<std::string>        filepaths;    //!< The paths the file was passed to watch() as.
+        std::filesystem::file_time_type lastModified; //!< The last known modification time.
+    };
+
+    /**
+     * @brief The body of the watcher thread.
+     */
+    void run();
+
+    /**
+     * @brief Starts watching the directory containing a file, if not already watched.
+     *
+     * @param directory The directory to watch.
+     */
+    void watchDirectory(const std::filesystem::path& directory);
+
+    /**
+     * @brief Reports the candidate files whose modification time changed.
+     *
+     * @param candidates The files that may have been modified, or all watched files if empty and polling.
+     */
+    void dispatch(const std::vector<std::string>& candidates);
+
+    Callback                                     m_callback;       //!< Invoked for every modified file.
+    std::thread                                  m_thread;         //!< The watcher thread.
+    std::atomic<bool>                            m_running{false}; //!< Whether the watcher thread should keep running.
+    mutable std::mutex                           m_mutex;          //!< Guards the watched files and directories.
+    std::unordered_map<std::string, WatchedFile> m_files;          //!< The watched files, by canonical path.
+    std::unordered_map<int, std::string>         m_directories;    //!< The watched directories, by watch descriptor.
+    int                                          m_inotify{-1};    //!< The inotify instance, if supported.
+
+}; // class FileWatcher
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_FILE_WATCHER_HPP
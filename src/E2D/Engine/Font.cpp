@@ -29,6 +29,9 @@
 #include <E2D/Engine/Font.hpp>
 #include <E2D/Engine/FontImpl.hpp>
 
+#include <memory>
+#include <vector>
+
 e2d::Font::Font() : m_fontImpl(std::make_unique<internal::FontImpl>())
 {
     log::debug("Constructing Font");
@@ -41,12 +44,37 @@ e2d::Font::~Font()
 
 bool e2d::Font::loadFromFile(const std::string& filepath)
 {
-    return this->m_fontImpl->loadFromFile(filepath);
+    if (!this->m_fontImpl->loadFromFile(filepath))
+    {
+        return false;
+    }
+    ++this->m_revision;
+    return true;
 }
 
 bool e2d::Font::loadFromMemory(const void* data, std::size_t size)
 {
-    return this->m_fontImpl->loadFromMemory(data, size);
+    if (!this->m_fontImpl->loadFromMemory(data, size))
+    {
+        return false;
+    }
+    ++this->m_revision;
+    return true;
+}
+
+std::function<bool()> e2d::Font::prepareFromFile(const std::string& filepath)
+{
+    auto data = std::make_shared<std::vector<uint8_t>>();
+    if (!internal::FontImpl::readFile(filepath, *data))
+    {
+        return {};
+    }
+    return [this, data]() { return this->loadFromMemory(data->data(), data->size()); };
+}
+
+unsigned int e2d::Font::getRevision() const
+{
+    return this->m_revision;
 }
 
 void* e2d::Font::getNativeFontHandle(unsigned int fontSize) const
@@ -45,6 +45,18 @@ e2d::internal::FontImpl::~FontImpl()
 }
 
 bool e2d::internal::FontImpl::loadFromFile(const std::string& filepath)
+{
+    std::vector<uint8_t> data;
+    if (!readFile(filepath, data))
+    {
+        return false;
+    }
+
+    this->m_fontData = std::move(data);
+    return true;
+}
+
+bool e2d::internal::FontImpl::readFile(const std::string& filepath, std::vector<uint8_t>& data)
 {
     std::ifstream file(filepath, std::ios::binary | std::ios::ate);
     if (!file)
@@ -56,15 +68,15 @@ bool e2d::internal::FontImpl::loadFromFile(const std::string& filepath)
     const auto size = file.tellg();
     file.seekg(0, std::ios::beg);
 
-    this->m_fontData.resize(static_cast<size_t>(size));
-    if (!file.read(reinterpret_cast<char*>(this->m_fontData.data()), size))
+    data.resize(static_cast<size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(data.data()), size))
     {
         log::error("Failed to read font file '{}'", filepath);
-        this->m_fontData.clear();
+        data.clear();
         return false;
     }
 
-    return this->loadFromMemory(this->m_fontData.data(), this->m_fontData.size());
+    return true;
 }
 
 bool e2d::internal::FontImpl::loadFromMemory(const void* data, std::size_t size)
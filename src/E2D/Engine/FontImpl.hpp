@@ -87,6 +87,17 @@ public:
      */
     bool loadFromMemory(const void* data, std::size_t size);
 
+    /**
+     * @brief Reads the content of a font file.
+     *
+     * Only reads the file without touching any font state, and may therefore be performed on any thread.
+     *
+     * @param filepath Path to the font file.
+     * @param data Buffer receiving the content of the file.
+     * @return True if the file was read successfully, false otherwise.
+     */
+    static bool readFile(const std::string& filepath, std::vector<uint8_t>& data);
+
     /**
      * @brief Retrieves the native TTF font object.
      *
@@ -32,7 +32,16 @@
 #include <SDL.h>
 #include <SDL_image.h>
 
-e2d::GraphicsSystem::GraphicsSystem()
+#include <utility>
+
+e2d::GraphicsSystem::GraphicsSystem(RenderMode       renderMode,
+                                    std::string      windowTitle,
+                                    WindowSettings   windowSettings,
+                                    RendererSettings rendererSettings) :
+m_renderMode(renderMode),
+m_windowTitle(std::move(windowTitle)),
+m_windowSettings(windowSettings),
+m_rendererSettings(std::move(rendererSettings))
 {
     log::debug("Constructing GraphicsSystem");
 }
@@ -44,6 +53,13 @@ e2d::GraphicsSystem::~GraphicsSystem()
 
 bool e2d::GraphicsSystem::initialize()
 {
+    if (this->m_renderMode == RenderMode::Headless)
+    {
+        // The environment variable takes precedence over the hint, so other drivers such as offscreen can be chosen
+        log::debug("Selecting SDL dummy video driver for headless rendering");
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+    }
+
     log::debug("Initializing SDL video subsystem");
     if (SDL_InitSubSystem(SDL_INIT_VIDEO) != 0)
     {
@@ -59,7 +75,10 @@ bool e2d::GraphicsSystem::initialize()
     }
 
     log::debug("Initializing renderer context");
-    if (!internal::RendererContext::getInstance().initialize())
+    if (!internal::RendererContext::getInstance().initialize(this->m_renderMode,
+                                                           this->m_windowTitle,
+                                                           this->m_windowSettings,
+                                                           this->m_rendererSettings))
     {
         log::error("Failed to initialize renderer context");
         return false;
@@ -78,4 +97,9 @@ void e2d::GraphicsSystem::shutdown()
 
     log::debug("Shutting down SDL video subsystem");
     SDL_QuitSubSystem(SDL_INIT_VIDEO);
+
+    if (this->m_renderMode == RenderMode::Headless)
+    {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, nullptr);
+    }
 }
@@ -0,0 +1,273 @@
+/**
+ * @file InputRecording.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/InputRecording.hpp>
+
+#include <iterator>
+
+namespace
+{
+constexpr char          magic[4] = {'E', '2', 'D', 'I'};
+constexpr std::uint8_t version   = 1;
+
+void writeVarint(std::string& buffer, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+bool readVarint(const std::string& data, std::size_t& pos, std::uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64 && pos < data.size(); shift += 7)
+    {
+        const auto byte = static_cast<std::uint8_t>(data[pos++]);
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Key codes and scancodes start at -1 for unknown keys, which zigzag encoding keeps at one byte
+void writeSigned(std::string& buffer, int value)
+{
+    writeVarint(buffer, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 31));
+}
+
+bool readSigned(const std::string& data, std::size_t& pos, int& value)
+{
+    std::uint64_t encoded = 0;
+    if (!readVarint(data, pos, encoded))
+    {
+        return false;
+    }
+    value = static_cast<int>(static_cast<std::int64_t>(encoded >> 1) ^ -static_cast<std::int64_t>(encoded & 1));
+    return true;
+}
+
+bool readUnsigned(const std::string& data, std::size_t& pos, unsigned int& value)
+{
+    std::uint64_t encoded = 0;
+    if (!readVarint(data, pos, encoded))
+    {
+        return false;
+    }
+    value = static_cast<unsigned int>(encoded);
+    return true;
+}
+} // namespace
+
+e2d::internal::InputRecorder::InputRecorder()
+{
+    log::debug("Constructing InputRecorder");
+}
+
+e2d::internal::InputRecorder::~InputRecorder()
+{
+    log::debug("Destructing InputRecorder");
+}
+
+bool e2d::internal::InputRecorder::open(const std::string& filepath)
+{
+    this->m_file.open(filepath, std::ios::binary | std::ios::trunc);
+    if (!this->m_file)
+    {
+        log::error("Failed to create recording '{}'", filepath);
+        return false;
+    }
+
+    this->m_file.write(magic, sizeof(magic));
+    this->m_file.put(static_cast<char>(version));
+    this->m_frameCount = 0;
+    return static_cast<bool>(this->m_file);
+}
+
+bool e2d::internal::InputRecorder::record(const RecordedFrame& frame)
+{
+    this->m_buffer.clear();
+    encodeFrame(this->m_buffer, frame);
+    this->m_file.write(this->m_buffer.data(), static_cast<std::streamsize>(this->m_buffer.size()));
+    if (!this->m_file)
+    {
+        return false;
+    }
+
+    ++this->m_frameCount;
+    return true;
+}
+
+std::uint64_t e2d::internal::InputRecorder::getFrameCount() const
+{
+    return this->m_frameCount;
+}
+
+void e2d::internal::InputRecorder::encodeFrame(std::string& buffer, const RecordedFrame& frame)
+{
+    writeVarint(buffer, frame.deltaTime);
+    writeVarint(buffer, frame.events.size());
+    for (const auto& event : frame.events)
+    {
+        buffer.push_back(static_cast<char>(event.type));
+        if (event.is<Event::KeyPressed>() || event.is<Event::KeyReleased>())
+        {
+            writeSigned(buffer, static_cast<int>(event.key.code));
+            writeSigned(buffer, static_cast<int>(event.key.scancode));
+            buffer.push_back(static_cast<char>((event.key.alt ? 1 : 0) | (event.key.control ? 2 : 0) |
+                                               (event.key.shift ? 4 : 0) | (event.key.system ? 8 : 0)));
+        }
+        else if (event.is<Event::Resized>())
+        {
+            writeVarint(buffer, event.size.width);
+            writeVarint(buffer, event.size.height);
+        }
+    }
+}
+
+e2d::internal::InputPlayer::InputPlayer()
+{
+    log::debug("Constructing InputPlayer");
+}
+
+e2d::internal::InputPlayer::~InputPlayer()
+{
+    log::debug("Destructing InputPlayer");
+}
+
+bool e2d::internal::InputPlayer::open(const std::string& filepath)
+{
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file)
+    {
+        log::error("Failed to open recording '{}'", filepath);
+        return false;
+    }
+
+    std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    if (data.size() < sizeof(magic) + 1 || data.compare(0, sizeof(magic), magic, sizeof(magic)) != 0)
+    {
+        log::error("The file '{}' is not a recording", filepath);
+        return false;
+    }
+    if (static_cast<std::uint8_t>(data[sizeof(magic)]) != version)
+    {
+        log::error("The recording '{}' has unsupported version {}",
+                   filepath,
+                   static_cast<unsigned int>(static_cast<std::uint8_t>(data[sizeof(magic)])));
+        return false;
+    }
+
+    this->m_data       = data.substr(sizeof(magic) + 1);
+    this->m_position   = 0;
+    this->m_frameCount = 0;
+    return true;
+}
+
+bool e2d::internal::InputPlayer::next(RecordedFrame& frame)
+{
+    if (this->m_position >= this->m_data.size())
+    {
+        return false;
+    }
+    if (!decodeFrame(this->m_data, this->m_position, frame))
+    {
+        log::error("The recording is corrupt after frame {}", this->m_frameCount);
+        this->m_position = this->m_data.size();
+        return false;
+    }
+
+    ++this->m_frameCount;
+    return true;
+}
+
+std::uint64_t e2d::internal::InputPlayer::getFrameCount() const
+{
+    return this->m_frameCount;
+}
+
+bool e2d::internal::InputPlayer::decodeFrame(const std::string& data, std::size_t& pos, RecordedFrame& frame)
+{
+    std::size_t   position   = pos;
+    std::uint64_t eventCount = 0;
+    if (!readVarint(data, position, frame.deltaTime) || !readVarint(data, position, eventCount) ||
+        eventCount > data.size() - position)
+    {
+        return false;
+    }
+
+    frame.events.clear();
+    for (std::uint64_t i = 0; i < eventCount; ++i)
+    {
+        if (position >= data.size())
+        {
+            return false;
+        }
+
+        Event event{};
+        const auto type = static_cast<std::uint8_t>(data[position++]);
+        if (type > Event::Quit)
+        {
+            return false;
+        }
+        event.type = static_cast<Event::EventType>(type);
+
+        if (event.is<Event::KeyPressed>() || event.is<Event::KeyReleased>())
+        {
+            int code     = 0;
+            int scancode = 0;
+            if (!readSigned(data, position, code) || !readSigned(data, position, scancode) || position >= data.size())
+            {
+                return false;
+            }
+            const auto modifiers = static_cast<std::uint8_t>(data[position++]);
+            event.key.code       = static_cast<Keyboard::Key>(code);
+            event.key.scancode   = static_cast<Keyboard::Scancode>(scancode);
+            event.key.alt        = (modifiers & 1) != 0;
+            event.key.control    = (modifiers & 2) != 0;
+            event.key.shift      = (modifiers & 4) != 0;
+            event.key.system     = (modifiers & 8) != 0;
+        }
+        else if (event.is<Event::Resized>())
+        {
+            if (!readUnsigned(data, position, event.size.width) || !readUnsigned(data, position, event.size.height))
+            {
+                return false;
+            }
+        }
+        frame.events.push_back(event);
+    }
+
+    pos = position;
+    return true;
+}
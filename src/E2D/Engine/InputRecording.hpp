@@ -0,0 +1,179 @@
+/**
+ * @file InputRecording.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_INPUT_RECORDING_HPP
+#define E2D_ENGINE_INPUT_RECORDING_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <E2D/Engine/Event.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace e2d::internal
+{
+
+/**
+ * @struct RecordedFrame
+ * @ingroup engine
+ * @brief @internal The input of a single frame, as stored in a recording.
+ */
+struct RecordedFrame
+{
+    std::uint64_t      deltaTime{0}; //!< The time the variable updates of the frame consumed, in nanoseconds.
+    std::vector<Event> events;       //!< The events handed to the active scene during the frame.
+};
+
+/**
+ * @class InputRecorder
+ * @ingroup engine
+ * @brief @internal Writes the input of every frame to a recording file.
+ *
+ * A recording starts with a magic number and a format version, followed by the frames in order.
+ * Frames are not numbered since every frame is stored, and all integers use a variable length
+ * encoding, so an idle frame takes only a few bytes.
+ */
+class E2D_ENGINE_API InputRecorder final : NonCopyable
+{
+public:
+    /**
+     * @brief Default constructor.
+     */
+    InputRecorder();
+
+    /**
+     * @brief Destructor that closes the recording.
+     */
+    ~InputRecorder();
+
+    /**
+     * @brief Creates a recording file and writes its header.
+     *
+     * @param filepath The path of the file to record to. An existing file is overwritten.
+     * @return True if the file was created, false otherwise.
+     */
+    bool open(const std::string& filepath);
+
+    /**
+     * @brief Appends a frame to the recording.
+     *
+     * @param frame The input of the frame.
+     * @return True if the frame was written, false if writing to the file failed.
+     */
+    bool record(const RecordedFrame& frame);
+
+    /**
+     * @brief Retrieves the number of frames recorded so far.
+     *
+     * @return The number of frames.
+     */
+    std::uint64_t getFrameCount() const;
+
+    /**
+     * @brief Encodes a frame in the format of a recording.
+     *
+     * @param buffer The buffer to append the encoded frame to.
+     * @param frame The frame to encode.
+     */
+    static void encodeFrame(std::string& buffer, const RecordedFrame& frame);
+
+private:
+    std::ofstream m_file;          //!< The recording file.
+    std::string   m_buffer;        //!< The encoded frame, reused between frames.
+    std::uint64_t m_frameCount{0}; //!< The number of frames recorded.
+
+}; // class InputRecorder
+
+/**
+ * @class InputPlayer
+ * @ingroup engine
+ * @brief @internal Reads back the frames of a recording made by InputRecorder.
+ *
+ * The whole recording is read into memory when it is opened, so replaying does not touch the disk
+ * and cannot stall frames.
+ */
+class E2D_ENGINE_API InputPlayer final : NonCopyable
+{
+public:
+    /**
+     * @brief Default constructor.
+     */
+    InputPlayer();
+
+    /**
+     * @brief Destructor.
+     */
+    ~InputPlayer();
+
+    /**
+     * @brief Reads a recording file and checks its header.
+     *
+     * @param filepath The path of the recording.
+     * @return True if the file is a recording in a supported format, false otherwise.
+     */
+    bool open(const std::string& filepath);
+
+    /**
+     * @brief Reads the next frame of the recording.
+     *
+     * @param frame Receives the frame. Its event vector is reused to avoid allocating every frame.
+     * @return True if a frame was read, false at the end of the recording or if the rest of it is corrupt.
+     */
+    bool next(RecordedFrame& frame);
+
+    /**
+     * @brief Retrieves the number of frames read so far.
+     *
+     * @return The number of frames.
+     */
+    std::uint64_t getFrameCount() const;
+
+    /**
+     * @brief Decodes a frame encoded by InputRecorder::encodeFrame.
+     *
+     * @param data The encoded frames.
+     * @param pos The position of the frame, advanced past it on success.
+     * @param frame Receives the frame.
+     * @return True if a complete and valid frame was decoded, false otherwise.
+     */
+    static bool decodeFrame(const std::string& data, std::size_t& pos, RecordedFrame& frame);
+
+private:
+    std::string   m_data;          //!< The frames of the recording, without the header.
+    std::size_t   m_position{0};   //!< The position of the next frame in the data.
+    std::uint64_t m_frameCount{0}; //!< The number of frames read.
+
+}; // class InputPlayer
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_INPUT_RECORDING_HPP
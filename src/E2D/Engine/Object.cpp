@@ -26,6 +26,7 @@
 
 #include <E2D/Core/Logger.hpp>
 
+#include <E2D/Engine/EngineMetrics.hpp>
 #include <E2D/Engine/Object.hpp>
 
 #include <utility>
@@ -36,16 +37,19 @@ std::mutex                 e2d::Object::s_counterMutex;
 e2d::Object::Object() : m_identifier(generateUniqueIdentifier())
 {
     log::debug("Constructing Object with identifier '{}'", this->m_identifier);
+    internal::EngineMetrics::getInstance().objectsAlive.add(1);
 }
 
 e2d::Object::Object(std::string identifier) : m_identifier(std::move(identifier))
 {
     log::debug("Constructing Object with identifier '{}'", this->m_identifier);
+    internal::EngineMetrics::getInstance().objectsAlive.add(1);
 }
 
 e2d::Object::~Object()
 {
     log::debug("Destructing Object with identifier '{}'", this->m_identifier);
+    internal::EngineMetrics::getInstance().objectsAlive.add(-1);
 }
 
 void e2d::Object::onLoad()
@@ -0,0 +1,393 @@
+/**
+ * @file ParticleSystem.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/ParticleSystem.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/SDLRenderUtils.hpp>
+#include <E2D/Engine/Texture.hpp>
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define E2D_PARTICLES_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define E2D_PARTICLES_SSE
+#endif
+
+namespace
+{
+const float pi = 3.14159265358979f;
+
+/**
+ * @brief Moves the particles by their velocities and ages them, using as many lanes as the target supports.
+ */
+void integrate(float*                positionsX,
+               float*                positionsY,
+               float*                velocitiesX,
+               float*                velocitiesY,
+               float*                remaining,
+               std::size_t           count,
+               float                 deltaTime,
+               const e2d::Vector2f& acceleration)
+{
+    const float velocityStepX = acceleration.x * deltaTime;
+    const float velocityStepY = acceleration.y * deltaTime;
+
+    std::size_t i = 0;
+#if defined(E2D_PARTICLES_AVX)
+    const __m256 time  = _mm256_set1_ps(deltaTime);
+    const __m256 stepX = _mm256_set1_ps(velocityStepX);
+    const __m256 stepY = _mm256_set1_ps(velocityStepY);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 velocityX = _mm256_add_ps(_mm256_loadu_ps(velocitiesX + i), stepX);
+        const __m256 velocityY = _mm256_add_ps(_mm256_loadu_ps(velocitiesY + i), stepY);
+        const __m256 positionX = _mm256_add_ps(_mm256_loadu_ps(positionsX + i), _mm256_mul_ps(velocityX, time));
+        const __m256 positionY = _mm256_add_ps(_mm256_loadu_ps(positionsY + i), _mm256_mul_ps(velocityY, time));
+        _mm256_storeu_ps(velocitiesX + i, velocityX);
+        _mm256_storeu_ps(velocitiesY + i, velocityY);
+        _mm256_storeu_ps(positionsX + i, positionX);
+        _mm256_storeu_ps(positionsY + i, positionY);
+        _mm256_storeu_ps(remaining + i, _mm256_sub_ps(_mm256_loadu_ps(remaining + i), time));
+    }
+#elif defined(E2D_PARTICLES_SSE)
+    const __m128 time  = _mm_set1_ps(deltaTime);
+    const __m128 stepX = _mm_set1_ps(velocityStepX);
+    const __m128 stepY = _mm_set1_ps(velocityStepY);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 velocityX = _mm_add_ps(_mm_loadu_ps(velocitiesX + i), stepX);
+        const __m128 velocityY = _mm_add_ps(_mm_loadu_ps(velocitiesY + i), stepY);
+        const __m128 positionX = _mm_add_ps(_mm_loadu_ps(positionsX + i), _mm_mul_ps(velocityX, time));
+        const __m128 positionY = _mm_add_ps(_mm_loadu_ps(positionsY + i), _mm_mul_ps(velocityY, time));
+        _mm_storeu_ps(velocitiesX + i, velocityX);
+        _mm_storeu_ps(velocitiesY + i, velocityY);
+        _mm_storeu_ps(positionsX + i, positionX);
+        _mm_storeu_ps(positionsY + i, positionY);
+        _mm_storeu_ps(remaining + i, _mm_sub_ps(_mm_loadu_ps(remaining + i), time));
+    }
+#endif
+
+    // The particles left over, or all of them on targets without SIMD support
+    for (; i < count; ++i)
+    {
+        velocitiesX[i] += velocityStepX;
+        velocitiesY[i] += velocityStepY;
+        positionsX[i] += velocitiesX[i] * deltaTime;
+        positionsY[i] += velocitiesY[i] * deltaTime;
+        remaining[i] -= deltaTime;
+    }
+}
+
+float pick(std::minstd_rand& random, float min, float max)
+{
+    return min < max ? std::uniform_real_distribution<float>(min, max)(random) : min;
+}
+} // namespace
+
+e2d::ParticleSystem::ParticleSystem() : m_geometry(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing ParticleSystem");
+}
+
+e2d::ParticleSystem::ParticleSystem(const std::string& identifier) :
+e2d::Object(identifier),
+m_geometry(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing ParticleSystem with identifier '{}'", identifier);
+}
+
+e2d::ParticleSystem::~ParticleSystem()
+{
+    log::debug("Destructing ParticleSystem");
+}
+
+void e2d::ParticleSystem::setTexture(const std::shared_ptr<const Texture>& texture)
+{
+    this->m_texture       = texture;
+    this->m_textureRect   = IntRect();
+    this->m_textureRegion = false;
+    this->invalidateLayer();
+}
+
+void e2d::ParticleSystem::setTexture(const TextureRegion& region)
+{
+    this->m_texture       = region.texture;
+    this->m_textureRect   = region.rect;
+    this->m_textureRegion = true;
+    this->invalidateLayer();
+}
+
+std::shared_ptr<const e2d::Texture> e2d::ParticleSystem::getTexture() const
+{
+    return this->m_texture;
+}
+
+void e2d::ParticleSystem::setEmitter(const ParticleEmitter& emitter)
+{
+    this->m_emitter = emitter;
+}
+
+const e2d::ParticleEmitter& e2d::ParticleSystem::getEmitter() const
+{
+    return this->m_emitter;
+}
+
+void e2d::ParticleSystem::setEmissionRate(float particlesPerSecond)
+{
+    this->m_emissionRate = std::max(particlesPerSecond, 0.f);
+    this->m_emissionDebt = 0;
+}
+
+float e2d::ParticleSystem::getEmissionRate() const
+{
+    return this->m_emissionRate;
+}
+
+void e2d::ParticleSystem::setAcceleration(const Vector2f& acceleration)
+{
+    this->m_acceleration = acceleration;
+}
+
+const e2d::Vector2f& e2d::ParticleSystem::getAcceleration() const
+{
+    return this->m_acceleration;
+}
+
+void e2d::ParticleSystem::setFadeOut(bool fadeOut)
+{
+    this->m_fadeOut = fadeOut;
+    this->invalidateLayer();
+}
+
+bool e2d::ParticleSystem::isFadingOut() const
+{
+    return this->m_fadeOut;
+}
+
+void e2d::ParticleSystem::setCapacity(std::size_t capacity)
+{
+    this->m_capacity = capacity;
+    if (this->getCount() > capacity)
+    {
+        this->resize(capacity);
+    }
+}
+
+std::size_t e2d::ParticleSystem::getCapacity() const
+{
+    return this->m_capacity;
+}
+
+void e2d::ParticleSystem::setSeed(std::uint32_t seed)
+{
+    this->m_random.seed(seed);
+}
+
+std::size_t e2d::ParticleSystem::burst(std::size_t count)
+{
+    const auto first = this->getCount();
+    const auto last  = std::min(first + count, this->m_capacity);
+    this->resize(last);
+
+    const auto& emitter = this->m_emitter;
+    for (auto i = first; i < last; ++i)
+    {
+        const float turn     = pick(this->m_random, -emitter.spread, emitter.spread) / 2;
+        const float angle    = (emitter.direction + turn) * pi / 180;
+        const float speed    = pick(this->m_random, emitter.minSpeed, emitter.maxSpeed);
+        const float lifetime = std::max(pick(this->m_random, emitter.minLifetime, emitter.maxLifetime), 0.001f);
+
+        this->m_positionsX[i]       = emitter.position.x + pick(this->m_random, -emitter.area.x, emitter.area.x) / 2;
+        this->m_positionsY[i]       = emitter.position.y + pick(this->m_random, -emitter.area.y, emitter.area.y) / 2;
+        this->m_velocitiesX[i]      = std::cos(angle) * speed;
+        this->m_velocitiesY[i]      = std::sin(angle) * speed;
+        this->m_remaining[i]        = lifetime;
+        this->m_inverseLifetimes[i] = 1 / lifetime;
+        this->m_sizes[i]            = pick(this->m_random, emitter.minSize, emitter.maxSize);
+        this->m_colors[i]           = emitter.color;
+    }
+    return last - first;
+}
+
+void e2d::ParticleSystem::clear()
+{
+    this->resize(0);
+    this->m_emissionDebt = 0;
+}
+
+std::size_t e2d::ParticleSystem::getCount() const
+{
+    return this->m_positionsX.size();
+}
+
+void e2d::ParticleSystem::update(float deltaTime)
+{
+    if (this->getCount() > 0)
+    {
+        this->invalidateLayer();
+    }
+
+    integrate(this->m_positionsX.data(),
+              this->m_positionsY.data(),
+              this->m_velocitiesX.data(),
+              this->m_velocitiesY.data(),
+              this->m_remaining.data(),
+              this->getCount(),
+              deltaTime,
+              this->m_acceleration);
+    this->removeExpired();
+
+    if (this->m_emissionRate > 0)
+    {
+        this->m_emissionDebt += this->m_emissionRate * deltaTime;
+        const auto due = std::floor(this->m_emissionDebt);
+        this->m_emissionDebt -= due;
+        this->burst(static_cast<std::size_t>(due));
+    }
+}
+
+void e2d::ParticleSystem::onFixedUpdate()
+{
+}
+
+void e2d::ParticleSystem::onVariableUpdate(double deltaTime)
+{
+    this->update(static_cast<float>(deltaTime));
+}
+
+void e2d::ParticleSystem::render() const
+{
+    const auto count = this->getCount();
+    if (count == 0)
+    {
+        return;
+    }
+
+    auto& geometry = *this->m_geometry;
+
+    internal::extendSDLQuadIndices(geometry.indices, count);
+
+    // The corners of the texture area drawn on each particle, from 0 to 1 on both axes
+    SDL_FPoint topLeft{0, 0};
+    SDL_FPoint bottomRight{1, 1};
+    if (this->m_texture && this->m_textureRegion)
+    {
+        const auto width  = static_cast<float>(this->m_texture->getSize().x);
+        const auto height = static_cast<float>(this->m_texture->getSize().y);
+        const auto rect   = FloatRect(this->m_textureRect);
+        topLeft           = {rect.left / width, rect.top / height};
+        bottomRight       = {(rect.left + rect.width) / width, (rect.top + rect.height) / height};
+    }
+
+    geometry.vertices.resize(count * 4);
+    auto* vertex = geometry.vertices.data();
+    for (std::size_t i = 0; i < count; ++i, vertex += 4)
+    {
+        const float x    = this->m_positionsX[i];
+        const float y    = this->m_positionsY[i];
+        const float half = this->m_sizes[i] / 2;
+
+        const auto& color = this->m_colors[i];
+        SDL_Color   vertexColor{color.r, color.g, color.b, color.a};
+        if (this->m_fadeOut)
+        {
+            const float opacity = std::clamp(this->m_remaining[i] * this->m_inverseLifetimes[i], 0.f, 1.f);
+            vertexColor.a       = static_cast<Uint8>(static_cast<float>(color.a) * opacity);
+        }
+
+        vertex[0] = {{x - half, y - half}, vertexColor, {topLeft.x, topLeft.y}};
+        vertex[1] = {{x + half, y - half}, vertexColor, {bottomRight.x, topLeft.y}};
+        vertex[2] = {{x + half, y + half}, vertexColor, {bottomRight.x, bottomRight.y}};
+        vertex[3] = {{x - half, y + half}, vertexColor, {topLeft.x, bottomRight.y}};
+    }
+
+    internal::RenderCommand command;
+    command.texture     = this->m_texture ? static_cast<SDL_Texture*>(this->m_texture->getNativeTextureHandle())
+                                          : nullptr;
+    command.revision    = this->m_texture ? this->m_texture->getRevision() : 0;
+    command.priority    = this->getRenderPriority();
+    command.vertexCount = count * 4;
+    command.indexCount  = count * 6;
+    geometry.commands.assign(1, command);
+
+    internal::RendererContext::getInstance().getRenderer().submit(geometry);
+}
+
+unsigned int e2d::ParticleSystem::getContentRevision() const
+{
+    return this->m_texture ? this->m_texture->getRevision() : 0;
+}
+
+void e2d::ParticleSystem::removeExpired()
+{
+    auto count = this->getCount();
+    for (std::size_t i = 0; i < count;)
+    {
+        if (this->m_remaining[i] > 0)
+        {
+            ++i;
+            continue;
+        }
+
+        // Order does not matter, so the last particle fills the gap instead of shifting the rest
+        --count;
+        this->m_positionsX[i]       = this->m_positionsX[count];
+        this->m_positionsY[i]       = this->m_positionsY[count];
+        this->m_velocitiesX[i]      = this->m_velocitiesX[count];
+        this->m_velocitiesY[i]      = this->m_velocitiesY[count];
+        this->m_remaining[i]        = this->m_remaining[count];
+        this->m_inverseLifetimes[i] = this->m_inverseLifetimes[count];
+        this->m_sizes[i]            = this->m_sizes[count];
+        this->m_colors[i]           = this->m_colors[count];
+    }
+    this->resize(count);
+}
+
+void e2d::ParticleSystem::resize(std::size_t count)
+{
+    if (count != this->getCount())
+    {
+        this->invalidateLayer();
+    }
+    this->m_positionsX.resize(count);
+    this->m_positionsY.resize(count);
+    this->m_velocitiesX.resize(count);
+    this->m_velocitiesY.resize(count);
+    this->m_remaining.resize(count);
+    this->m_inverseLifetimes.resize(count);
+    this->m_sizes.resize(count);
+    this->m_colors.resize(count);
+}
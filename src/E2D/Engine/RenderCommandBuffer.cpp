@@ -0,0 +1,131 @@
+/**
+ * @file RenderCommandBuffer.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/RenderCommandBuffer.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/SDLRenderUtils.hpp>
+#include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/Text.hpp>
+#include <E2D/Engine/Texture.hpp>
+
+#include <SDL.h>
+
+e2d::RenderCommandBuffer::RenderCommandBuffer() : m_commands(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing RenderCommandBuffer");
+}
+
+e2d::RenderCommandBuffer::~RenderCommandBuffer()
+{
+    log::debug("Destructing RenderCommandBuffer");
+}
+
+void e2d::RenderCommandBuffer::drawSprite(const e2d::Sprite& sprite)
+{
+    internal::RenderCommand command;
+    if (sprite.makeRenderCommand(command))
+    {
+        command.clip    = internal::toSDLRect(this->m_clip);
+        command.hasClip = this->m_clipped;
+        this->m_commands->commands.push_back(command);
+    }
+}
+
+void e2d::RenderCommandBuffer::drawText(const e2d::Text& text)
+{
+    internal::RenderCommand command;
+    if (text.makeRenderCommand(command))
+    {
+        command.clip    = internal::toSDLRect(this->m_clip);
+        command.hasClip = this->m_clipped;
+        this->m_commands->commands.push_back(command);
+    }
+}
+
+void e2d::RenderCommandBuffer::drawGeometry(const std::shared_ptr<const e2d::Texture>& texture,
+                                            const std::vector<e2d::Vertex>&            vertices,
+                                            const std::vector<int>&                    indices,
+                                            int                                        renderPriority)
+{
+    if (vertices.empty())
+    {
+        return;
+    }
+
+    auto& snapshot = *this->m_commands;
+
+    internal::RenderCommand command;
+    command.texture     = texture ? static_cast<SDL_Texture*>(texture->getNativeTextureHandle()) : nullptr;
+    command.revision    = texture ? texture->getRevision() : 0;
+    command.priority    = renderPriority;
+    command.clip        = internal::toSDLRect(this->m_clip);
+    command.hasClip     = this->m_clipped;
+    command.firstVertex = snapshot.vertices.size();
+    command.vertexCount = vertices.size();
+    command.firstIndex  = snapshot.indices.size();
+    command.indexCount  = indices.size();
+    snapshot.commands.push_back(command);
+
+    snapshot.vertices.reserve(snapshot.vertices.size() + vertices.size());
+    for (const auto& vertex : vertices)
+    {
+        snapshot.vertices.push_back({{vertex.position.x, vertex.position.y},
+                                     {vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a},
+                                     {vertex.textureCoordinates.x, vertex.textureCoordinates.y}});
+    }
+    snapshot.indices.insert(snapshot.indices.end(), indices.begin(), indices.end());
+}
+
+void e2d::RenderCommandBuffer::setClip(const e2d::IntRect& rectangle)
+{
+    this->m_clip    = rectangle;
+    this->m_clipped = true;
+}
+
+void e2d::RenderCommandBuffer::resetClip()
+{
+    this->m_clipped = false;
+}
+
+void e2d::RenderCommandBuffer::clear()
+{
+    this->m_commands->commands.clear();
+    this->m_commands->vertices.clear();
+    this->m_commands->indices.clear();
+    this->m_clipped = false;
+}
+
+std::size_t e2d::RenderCommandBuffer::getCommandCount() const
+{
+    return this->m_commands->commands.size();
+}
+
+bool e2d::RenderCommandBuffer::isEmpty() const
+{
+    return this->m_commands->commands.empty();
+}
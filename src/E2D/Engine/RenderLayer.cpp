@@ -0,0 +1,282 @@
+/**
+ * @file RenderLayer.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/EngineMetrics.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderLayer.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/Transformable.hpp>
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+e2d::RenderLayer::RenderLayer(std::string name) : m_name(std::move(name))
+{
+    log::debug("Constructing RenderLayer with name '{}'", this->m_name);
+}
+
+e2d::RenderLayer::~RenderLayer()
+{
+    log::debug("Destructing RenderLayer with name '{}'", this->m_name);
+    for (const auto& entry : this->m_entries)
+    {
+        entry.renderable->m_layer = nullptr;
+    }
+}
+
+const std::string& e2d::RenderLayer::getName() const
+{
+    return this->m_name;
+}
+
+bool e2d::RenderLayer::add(e2d::Renderable& renderable)
+{
+    if (dynamic_cast<const RenderLayer*>(&renderable) != nullptr)
+    {
+        log::error("Failed to add layer to layer '{}': layers cannot be nested", this->m_name);
+        return false;
+    }
+    if (renderable.m_layer == this)
+    {
+        return true;
+    }
+
+    if (renderable.m_layer)
+    {
+        renderable.m_layer->remove(renderable);
+    }
+    renderable.m_layer = this;
+
+    // Found once here, as sorting by position would otherwise need a cast per renderable every frame
+    const auto* transformable = dynamic_cast<const Transformable*>(&renderable);
+    this->m_entries.push_back({&renderable, transformable, 0, 0, 0});
+    this->invalidate();
+    return true;
+}
+
+bool e2d::RenderLayer::remove(e2d::Renderable& renderable)
+{
+    const auto it = std::find_if(this->m_entries.begin(),
+                                 this->m_entries.end(),
+                                 [&renderable](const Entry& entry) { return entry.renderable == &renderable; });
+    if (it == this->m_entries.end())
+    {
+        return false;
+    }
+
+    renderable.m_layer = nullptr;
+    this->m_entries.erase(it);
+    this->invalidate();
+    return true;
+}
+
+bool e2d::RenderLayer::contains(const e2d::Renderable& renderable) const
+{
+    return renderable.m_layer == this;
+}
+
+std::size_t e2d::RenderLayer::getCount() const
+{
+    return this->m_entries.size();
+}
+
+void e2d::RenderLayer::setSortMode(e2d::RenderLayer::SortMode sortMode)
+{
+    if (sortMode == SortMode::Custom && !this->m_sortKey)
+    {
+        throw std::runtime_error("Layer `" + this->m_name + "` has no sort key.");
+    }
+    this->m_sortMode = sortMode;
+    this->invalidate();
+}
+
+e2d::RenderLayer::SortMode e2d::RenderLayer::getSortMode() const
+{
+    return this->m_sortMode;
+}
+
+void e2d::RenderLayer::setSortKey(e2d::RenderLayer::SortKey sortKey)
+{
+    if (!sortKey)
+    {
+        throw std::runtime_error("The sort key of layer `" + this->m_name + "` is empty.");
+    }
+    this->m_sortKey  = std::move(sortKey);
+    this->m_sortMode = SortMode::Custom;
+    this->invalidate();
+}
+
+void e2d::RenderLayer::setStatic(bool isStatic)
+{
+    this->m_static = isStatic;
+    if (!isStatic)
+    {
+        // Frees the cache, which is as large as the screen
+        this->m_cache.destroy();
+        this->m_cacheValid = false;
+    }
+}
+
+bool e2d::RenderLayer::isStatic() const
+{
+    return this->m_static;
+}
+
+void e2d::RenderLayer::invalidate()
+{
+    this->m_cacheValid = false;
+}
+
+void e2d::RenderLayer::render() const
+{
+    if (this->m_static)
+    {
+        this->renderCached();
+        return;
+    }
+
+    this->sort();
+    for (const auto& entry : this->m_entries)
+    {
+        entry.renderable->render();
+    }
+}
+
+void e2d::RenderLayer::sort() const
+{
+    switch (this->m_sortMode)
+    {
+        case SortMode::None:
+            return;
+        case SortMode::Priority:
+            for (auto& entry : this->m_entries)
+            {
+                entry.key = entry.renderable->getRenderPriority();
+            }
+            break;
+        case SortMode::PositionY:
+            for (auto& entry : this->m_entries)
+            {
+                entry.key = entry.transformable ? entry.transformable->getPosition().y : 0;
+            }
+            break;
+        case SortMode::Custom:
+            for (auto& entry : this->m_entries)
+            {
+                entry.key = this->m_sortKey(*entry.renderable);
+            }
+            break;
+    }
+
+    // An insertion sort of the order of the last frame, which is close to linear when it is nearly sorted already.
+    // It is also stable, so renderables with equal keys do not flicker between orders.
+    for (std::size_t i = 1; i < this->m_entries.size(); ++i)
+    {
+        const auto  entry = this->m_entries[i];
+        std::size_t j     = i;
+        while (j > 0 && entry.key < this->m_entries[j - 1].key)
+        {
+            this->m_entries[j] = this->m_entries[j - 1];
+            --j;
+        }
+        this->m_entries[j] = entry;
+    }
+}
+
+bool e2d::RenderLayer::hasChanged() const
+{
+    for (const auto& entry : this->m_entries)
+    {
+        if (entry.transformable && entry.transformable->getTransformRevision() != entry.revision)
+        {
+            return true;
+        }
+        if (entry.renderable->getContentRevision() != entry.content)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void e2d::RenderLayer::renderCached() const
+{
+    if (this->m_entries.empty())
+    {
+        return;
+    }
+
+    auto&          renderer = internal::RendererContext::getInstance().getRenderer();
+    const Vector2i size     = renderer.getOutputSize();
+
+    // Only the revisions are checked every frame, other changes invalidate the layer when they are made
+    if (!this->m_cacheValid || size != this->m_cache.getSize() || this->hasChanged())
+    {
+        this->sort();
+        for (auto& entry : this->m_entries)
+        {
+            entry.revision = entry.transformable ? entry.transformable->getTransformRevision() : 0;
+            entry.content  = entry.renderable->getContentRevision();
+        }
+
+        const auto draw = [this]
+        {
+            for (const auto& entry : this->m_entries)
+            {
+                entry.renderable->render();
+            }
+        };
+        const bool rendered = (size == this->m_cache.getSize() || this->m_cache.create(size)) &&
+                              this->m_cache.clear() &&
+                              renderer.renderToTarget(
+                                  static_cast<SDL_Texture*>(this->m_cache.getTexture()->getNativeTextureHandle()),
+                                  draw);
+        if (!rendered)
+        {
+            // Still draws the layer, just without the cache
+            this->m_cacheValid = false;
+            draw();
+            return;
+        }
+
+        this->m_cacheValid = true;
+        internal::EngineMetrics::getInstance().layerBakes.increment();
+    }
+
+    internal::RenderCommand command;
+    command.texture     = static_cast<SDL_Texture*>(this->m_cache.getTexture()->getNativeTextureHandle());
+    command.revision    = this->m_cache.getTexture()->getRevision();
+    command.destination = {0, 0, size.x, size.y};
+    command.priority    = this->getRenderPriority();
+    renderer.submit(command);
+}
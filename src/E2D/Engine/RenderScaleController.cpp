@@ -0,0 +1,85 @@
+/**
+ * @file RenderScaleController.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RenderScaleController.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+e2d::internal::RenderScaleController::RenderScaleController()
+{
+    log::debug("Constructing RenderScaleController");
+}
+
+e2d::internal::RenderScaleController::~RenderScaleController()
+{
+    log::debug("Destructing RenderScaleController");
+}
+
+void e2d::internal::RenderScaleController::setBudget(double budget)
+{
+    this->m_budget    = std::max(budget, 0.0);
+    this->m_totalTime = 0;
+    this->m_samples   = 0;
+}
+
+double e2d::internal::RenderScaleController::getBudget() const
+{
+    return this->m_budget;
+}
+
+float e2d::internal::RenderScaleController::update(double frameTime, float renderScale)
+{
+    if (this->m_budget <= 0)
+    {
+        return renderScale;
+    }
+
+    this->m_totalTime += frameTime;
+    if (++this->m_samples < SampleCount)
+    {
+        return renderScale;
+    }
+
+    const double averageTime = this->m_totalTime / static_cast<double>(this->m_samples);
+    this->m_totalTime        = 0;
+    this->m_samples          = 0;
+
+    float scale = renderScale;
+    if (averageTime > this->m_budget)
+    {
+        // The time to fill the frame roughly follows its number of pixels, the square of the scale
+        scale *= static_cast<float>(std::sqrt(this->m_budget / averageTime));
+    }
+    else if (averageTime < this->m_budget * Headroom)
+    {
+        scale += RaiseStep;
+    }
+    return std::clamp(scale, Renderer::MinRenderScale, 1.f);
+}
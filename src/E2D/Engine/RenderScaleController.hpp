@@ -0,0 +1,98 @@
+/**
+ * @file RenderScaleController.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_RENDER_SCALE_CONTROLLER_HPP
+#define E2D_ENGINE_RENDER_SCALE_CONTROLLER_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <cstddef>
+
+namespace e2d::internal
+{
+
+/**
+ * @class RenderScaleController
+ * @ingroup engine
+ * @brief @internal Chooses the render scale that keeps the time each frame takes within a budget.
+ *
+ * Frame times are averaged over a number of frames before the scale changes. Over budget, the scale
+ * is lowered at once by as much as the average exceeds the budget, taking into account that the number
+ * of pixels drawn follows the square of the scale. Well within budget, the scale is raised again in
+ * small steps, so that it settles instead of swinging around the budget.
+ */
+class E2D_ENGINE_API RenderScaleController final : NonCopyable
+{
+public:
+    static constexpr std::size_t SampleCount = 30;    //!< The number of frames averaged before the scale changes.
+    static constexpr double      Headroom    = 0.75;  //!< The fraction of the budget below which the scale is raised.
+    static constexpr float       RaiseStep   = 0.05f; //!< How much the scale is raised at a time.
+
+    /**
+     * @brief Constructs a new RenderScaleController object without a budget.
+     */
+    RenderScaleController();
+
+    /**
+     * @brief Destructor.
+     */
+    ~RenderScaleController();
+
+    /**
+     * @brief Sets the time each frame may take, discarding the frame times recorded so far.
+     *
+     * @param budget The budget in seconds, or 0 to leave the render scale alone.
+     */
+    void setBudget(double budget);
+
+    /**
+     * @brief Retrieves the time each frame may take.
+     *
+     * @return The budget in seconds, or 0 if there is none.
+     */
+    double getBudget() const;
+
+    /**
+     * @brief Records the time a frame took and chooses the render scale of the next frames.
+     *
+     * @param frameTime The time from the start of the frame to the start of the next one, in seconds.
+     * @param renderScale The render scale the frame was rendered at.
+     * @return The render scale to render the next frames at.
+     */
+    float update(double frameTime, float renderScale);
+
+private:
+    double      m_budget{0};    //!< The time each frame may take, in seconds.
+    double      m_totalTime{0}; //!< The sum of the frame times recorded since the scale last changed.
+    std::size_t m_samples{0};   //!< The number of frame times recorded since the scale last changed.
+
+}; // class RenderScaleController
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_RENDER_SCALE_CONTROLLER_HPP
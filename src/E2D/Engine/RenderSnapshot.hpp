@@ -0,0 +1,92 @@
+/**
+ * @file RenderSnapshot.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_RENDER_SNAPSHOT_HPP
+#define E2D_ENGINE_RENDER_SNAPSHOT_HPP
+
+#include <E2D/Core/Color.hpp>
+
+#include <SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace e2d::internal
+{
+
+/**
+ * @struct RenderCommand
+ * @ingroup engine
+ * @brief @internal A single texture copy or geometry draw, with everything needed to issue it resolved up front.
+ *
+ * Renderable objects describe what they draw with commands instead of calling SDL themselves, so
+ * the calls can be issued later and on another thread, after the objects have moved on.
+ *
+ * The revision tells apart textures whose pixels changed without the texture moving, such as a render
+ * texture drawn into again, for the commands of consecutive frames to be compared.
+ *
+ * Geometry commands refer to a range of the vertices and indices of the snapshot or command buffer
+ * that holds them, and leave the copy specific members unused.
+ */
+struct RenderCommand
+{
+    SDL_Texture*     texture{nullptr};    //!< The texture to copy, or to map onto the geometry if any.
+    unsigned int     revision{0};         //!< The revision of the pixels of the texture when it was recorded.
+    SDL_Rect         source{};            //!< The part of the texture to copy.
+    bool             hasSource{false};    //!< Whether source is used, or the whole texture is copied.
+    SDL_Rect         destination{};       //!< The area of the screen to copy to.
+    double           angle{0};            //!< The rotation in degrees, clockwise.
+    SDL_Point        center{};            //!< The point the destination is rotated around.
+    SDL_RendererFlip flip{SDL_FLIP_NONE}; //!< Whether the texture is mirrored.
+    int              priority{0};         //!< The render priority, used to merge command buffers.
+    SDL_Rect         clip{};              //!< The area of the screen drawing is limited to.
+    bool             hasClip{false};      //!< Whether clip is used, or the whole screen can be drawn to.
+    std::size_t      firstVertex{0};      //!< The first vertex of a geometry draw.
+    std::size_t      vertexCount{0};      //!< The number of vertices of a geometry draw, or zero for a texture copy.
+    std::size_t      firstIndex{0};       //!< The first index of a geometry draw.
+    std::size_t      indexCount{0};       //!< The number of indices of a geometry draw, or zero if it is not indexed.
+};
+
+/**
+ * @struct RenderSnapshot
+ * @ingroup engine
+ * @brief @internal Everything needed to draw one frame, independent of the objects it was taken from.
+ *
+ * The commands are stored in render priority order, so issuing them in sequence reproduces the frame.
+ */
+struct RenderSnapshot
+{
+    Color                      background; //!< The color the frame is cleared with.
+    std::vector<RenderCommand> commands;   //!< The texture copies and geometry draws of the frame, in drawing order.
+    std::vector<SDL_Vertex>    vertices;   //!< The vertices of the geometry draws.
+    std::vector<int>           indices;    //!< The indices of the geometry draws into their vertices.
+    std::uint64_t              frame{0};   //!< The number of the frame, counting from one.
+};
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_RENDER_SNAPSHOT_HPP
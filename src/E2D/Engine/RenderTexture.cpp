@@ -0,0 +1,156 @@
+/**
+ * @file RenderTexture.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderCommandBuffer.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/TextureImpl.hpp>
+
+#include <SDL.h>
+
+e2d::RenderTexture::RenderTexture() : m_texture(std::make_shared<Texture>())
+{
+    log::debug("Constructing RenderTexture");
+}
+
+e2d::RenderTexture::~RenderTexture()
+{
+    log::debug("Destructing RenderTexture");
+}
+
+bool e2d::RenderTexture::create(const e2d::Vector2i& size)
+{
+    log::debug("Creating render texture with width '{}' and height '{}'", size.x, size.y);
+    if (!this->m_texture->m_textureImpl->createTarget(size))
+    {
+        return false;
+    }
+    ++this->m_texture->m_revision;
+    return true;
+}
+
+bool e2d::RenderTexture::loadFromFile(const std::string& filepath)
+{
+    Texture image;
+    return image.loadFromFile(filepath) && this->createFromImage(image);
+}
+
+bool e2d::RenderTexture::loadFromMemory(const void* data, std::size_t size)
+{
+    Texture image;
+    return image.loadFromMemory(data, size) && this->createFromImage(image);
+}
+
+bool e2d::RenderTexture::isLoaded() const
+{
+    return this->m_texture->isLoaded();
+}
+
+void e2d::RenderTexture::destroy()
+{
+    this->m_texture->destroy();
+}
+
+const e2d::Vector2i& e2d::RenderTexture::getSize() const
+{
+    return this->m_texture->getSize();
+}
+
+std::shared_ptr<const e2d::Texture> e2d::RenderTexture::getTexture() const
+{
+    return this->m_texture;
+}
+
+bool e2d::RenderTexture::clear(const e2d::Color& color)
+{
+    if (!this->isLoaded())
+    {
+        return false;
+    }
+
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
+    return this->drawToTexture(
+        [&renderer, &color]
+        {
+            SDL_SetRenderDrawColor(renderer.getNativeRenderer(), color.r, color.g, color.b, color.a);
+            SDL_RenderClear(renderer.getNativeRenderer());
+        });
+}
+
+bool e2d::RenderTexture::draw(const e2d::Renderable& renderable)
+{
+    if (!this->isLoaded())
+    {
+        return false;
+    }
+
+    return this->drawToTexture([&renderable] { renderable.render(); });
+}
+
+bool e2d::RenderTexture::draw(const e2d::RenderCommandBuffer& buffer)
+{
+    if (!this->isLoaded())
+    {
+        return false;
+    }
+
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
+    return this->drawToTexture([&renderer, &buffer] { renderer.submit(buffer); });
+}
+
+bool e2d::RenderTexture::createFromImage(const e2d::Texture& image)
+{
+    if (!this->create(image.getSize()))
+    {
+        return false;
+    }
+
+    // Copies the pixels as they are, instead of blending them onto the transparent texture
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
+    auto* source   = image.m_textureImpl->getTexture();
+    return this->drawToTexture(
+        [&renderer, source]
+        {
+            SDL_SetTextureBlendMode(source, SDL_BLENDMODE_NONE);
+            SDL_RenderCopy(renderer.getNativeRenderer(), source, nullptr, nullptr);
+        });
+}
+
+bool e2d::RenderTexture::drawToTexture(const std::function<void()>& draw)
+{
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
+    if (!renderer.renderToTarget(this->m_texture->m_textureImpl->getTexture(), draw))
+    {
+        return false;
+    }
+    ++this->m_texture->m_revision;
+    return true;
+}
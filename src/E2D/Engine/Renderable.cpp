@@ -25,8 +25,15 @@
  */
 
 #include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderLayer.hpp>
 
-e2d::Renderable::~Renderable() = default;
+e2d::Renderable::~Renderable()
+{
+    if (this->m_layer)
+    {
+        this->m_layer->remove(*this);
+    }
+}
 
 int e2d::Renderable::getRenderPriority() const
 {
@@ -35,5 +42,28 @@ int e2d::Renderable::getRenderPriority() const
 
 void e2d::Renderable::setRenderPriority(int renderPriority)
 {
+    if (this->m_renderPriority == renderPriority)
+    {
+        return;
+    }
     this->m_renderPriority = renderPriority;
+    this->invalidateLayer();
+}
+
+e2d::RenderLayer* e2d::Renderable::getLayer() const
+{
+    return this->m_layer;
+}
+
+void e2d::Renderable::invalidateLayer() const
+{
+    if (this->m_layer)
+    {
+        this->m_layer->invalidate();
+    }
+}
+
+unsigned int e2d::Renderable::getContentRevision() const
+{
+    return 0;
 }
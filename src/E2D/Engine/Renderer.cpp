@@ -26,13 +26,187 @@
 
 #include <E2D/Core/Logger.hpp>
 
+#include <E2D/Engine/EngineMetrics.hpp>
 #include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/RenderCommandBuffer.hpp>
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RenderQueue.hpp>
+#include <E2D/Engine/TextureCache.hpp>
 #include <E2D/Engine/Window.hpp>
 
 #include <SDL.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace
+{
+const double pi = 3.14159265358979;
+
+SDL_Rect getBounds(const e2d::internal::RenderCommand& command, const e2d::internal::RenderSnapshot& source)
+{
+    SDL_Rect bounds = command.destination;
+    if (command.vertexCount > 0 || command.angle != 0)
+    {
+        float minX = std::numeric_limits<float>::max();
+        float minY = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float maxY = std::numeric_limits<float>::lowest();
+
+        const auto extend = [&](float x, float y)
+        {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+        };
+
+        if (command.vertexCount > 0)
+        {
+            for (std::size_t i = command.firstVertex; i < command.firstVertex + command.vertexCount; ++i)
+            {
+                extend(source.vertices[i].position.x, source.vertices[i].position.y);
+            }
+        }
+        else
+        {
+            // Rotates the corners of the destination around the center, clockwise as SDL does
+            const auto& destination = command.destination;
+            const auto  pivotX      = static_cast<double>(destination.x + command.center.x);
+            const auto  pivotY      = static_cast<double>(destination.y + command.center.y);
+            const auto  radians     = command.angle * pi / 180;
+            const auto  cosAngle    = std::cos(radians);
+            const auto  sinAngle    = std::sin(radians);
+            for (const int cornerX : {destination.x, destination.x + destination.w})
+            {
+                for (const int cornerY : {destination.y, destination.y + destination.h})
+                {
+                    const double offsetX = cornerX - pivotX;
+                    const double offsetY = cornerY - pivotY;
+                    extend(static_cast<float>(pivotX + offsetX * cosAngle - offsetY * sinAngle),
+                           static_cast<float>(pivotY + offsetX * sinAngle + offsetY * cosAngle));
+                }
+            }
+        }
+
+        bounds.x = static_cast<int>(std::floor(minX));
+        bounds.y = static_cast<int>(std::floor(minY));
+        bounds.w = static_cast<int>(std::ceil(maxX)) - bounds.x;
+        bounds.h = static_cast<int>(std::ceil(maxY)) - bounds.y;
+    }
+
+    if (command.hasClip && !SDL_IntersectRect(&bounds, &command.clip, &bounds))
+    {
+        return {};
+    }
+    return bounds;
+}
+
+bool isSameDraw(const e2d::internal::RenderCommand&  lhs,
+                const e2d::internal::RenderSnapshot& lhsSource,
+                const e2d::internal::RenderCommand&  rhs,
+                const e2d::internal::RenderSnapshot& rhsSource)
+{
+    // A texture drawn into or reloaded keeps its address, so its revision tells whether its pixels changed
+    if (lhs.texture != rhs.texture || lhs.revision != rhs.revision || lhs.hasSource != rhs.hasSource ||
+        (lhs.hasSource && !SDL_RectEquals(&lhs.source, &rhs.source)) ||
+        !SDL_RectEquals(&lhs.destination, &rhs.destination) || lhs.angle != rhs.angle ||
+        lhs.center.x != rhs.center.x || lhs.center.y != rhs.center.y || lhs.flip != rhs.flip ||
+        lhs.hasClip != rhs.hasClip || (lhs.hasClip && !SDL_RectEquals(&lhs.clip, &rhs.clip)) ||
+        lhs.vertexCount != rhs.vertexCount || lhs.indexCount != rhs.indexCount)
+    {
+        return false;
+    }
+
+    // The geometry is compared by value, as it moves within the snapshot when earlier commands change
+    const auto lhsVertices = lhsSource.vertices.begin() + static_cast<std::ptrdiff_t>(lhs.firstVertex);
+    const auto rhsVertices = rhsSource.vertices.begin() + static_cast<std::ptrdiff_t>(rhs.firstVertex);
+    const auto lhsIndices  = lhsSource.indices.begin() + static_cast<std::ptrdiff_t>(lhs.firstIndex);
+    const auto rhsIndices  = rhsSource.indices.begin() + static_cast<std::ptrdiff_t>(rhs.firstIndex);
+    return std::equal(lhsVertices,
+                      lhsVertices + static_cast<std::ptrdiff_t>(lhs.vertexCount),
+                      rhsVertices,
+                      [](const SDL_Vertex& lhsVertex, const SDL_Vertex& rhsVertex)
+                      {
+                          return lhsVertex.position.x == rhsVertex.position.x &&
+                                 lhsVertex.position.y == rhsVertex.position.y &&
+                                 lhsVertex.color.r == rhsVertex.color.r && lhsVertex.color.g == rhsVertex.color.g &&
+                                 lhsVertex.color.b == rhsVertex.color.b && lhsVertex.color.a == rhsVertex.color.a &&
+                                 lhsVertex.tex_coord.x == rhsVertex.tex_coord.x &&
+                                 lhsVertex.tex_coord.y == rhsVertex.tex_coord.y;
+                      }) &&
+           std::equal(lhsIndices, lhsIndices + static_cast<std::ptrdiff_t>(lhs.indexCount), rhsIndices);
+}
+
+void addBounds(SDL_Rect& area, const e2d::internal::RenderCommand& command, const e2d::internal::RenderSnapshot& source)
+{
+    const SDL_Rect bounds = getBounds(command, source);
+    if (SDL_RectEmpty(&bounds))
+    {
+        return;
+    }
+    if (SDL_RectEmpty(&area))
+    {
+        area = bounds;
+        return;
+    }
+    SDL_UnionRect(&area, &bounds, &area);
+}
+
+SDL_Rect findChangedArea(const e2d::internal::RenderSnapshot& previous, const e2d::internal::RenderSnapshot& current)
+{
+    const auto& before = previous.commands;
+    const auto& after  = current.commands;
+
+    // Adding or removing a renderable shifts the commands after it, so the matching ends are skipped first
+    std::size_t first = 0;
+    while (first < before.size() && first < after.size() &&
+           isSameDraw(before[first], previous, after[first], current))
+    {
+        ++first;
+    }
+    std::size_t endBefore = before.size();
+    std::size_t endAfter  = after.size();
+    while (endBefore > first && endAfter > first &&
+           isSameDraw(before[endBefore - 1], previous, after[endAfter - 1], current))
+    {
+        --endBefore;
+        --endAfter;
+    }
+
+    SDL_Rect area{};
+    if (endBefore - first == endAfter - first)
+    {
+        // The commands still pair up, so only those that differ changed
+        for (std::size_t i = first; i < endBefore; ++i)
+        {
+            if (!isSameDraw(before[i], previous, after[i], current))
+            {
+                addBounds(area, before[i], previous);
+                addBounds(area, after[i], current);
+            }
+        }
+        return area;
+    }
+
+    for (std::size_t i = first; i < endBefore; ++i)
+    {
+        addBounds(area, before[i], previous);
+    }
+    for (std::size_t i = first; i < endAfter; ++i)
+    {
+        addBounds(area, after[i], current);
+    }
+    return area;
+}
+} // namespace
+
 e2d::internal::Renderer::Renderer() : m_renderQueue(std::make_unique<internal::RenderQueue>())
 {
     log::debug("Constructing Renderer");
@@ -44,11 +218,21 @@ e2d::internal::Renderer::~Renderer()
     this->destroy();
 }
 
-bool e2d::internal::Renderer::create(const Window& window)
+bool e2d::internal::Renderer::create(const Window& window, const e2d::RendererSettings& settings)
 {
-    log::debug("Creating renderer");
+    log::debug("Creating renderer with driver '{}' and vsync '{}'", settings.driver, settings.vsync);
+
+    applyHints(settings);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, settings.driver.empty() ? nullptr : settings.driver.c_str());
+
+    // A chosen driver is used regardless of the flags, so these only matter when SDL chooses
+    Uint32 flags = settings.driver == "software" ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+    if (settings.vsync)
+    {
+        flags |= SDL_RENDERER_PRESENTVSYNC;
+    }
 
-    this->m_renderer = SDL_CreateRenderer(window.getNativeWindow(), -1, SDL_RENDERER_ACCELERATED);
+    this->m_renderer = SDL_CreateRenderer(window.getNativeWindow(), -1, flags);
 
     if (this->m_renderer == nullptr)
     {
@@ -56,9 +240,44 @@ bool e2d::internal::Renderer::create(const Window& window)
         return false;
     }
 
+    SDL_GetRendererOutputSize(this->m_renderer, &this->m_outputSize.x, &this->m_outputSize.y);
+    this->m_nativeTextureFormat = TextureCache::getNativeFormat(this->m_renderer);
     return true;
 }
 
+bool e2d::internal::Renderer::createOffscreen(int width, int height, const e2d::RendererSettings& settings)
+{
+    log::debug("Creating offscreen renderer with width '{}' and height '{}'", width, height);
+
+    applyHints(settings);
+
+    this->m_surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (this->m_surface == nullptr)
+    {
+        log::error("Failed to create offscreen surface: {}", SDL_GetError());
+        return false;
+    }
+
+    this->m_renderer = SDL_CreateSoftwareRenderer(this->m_surface);
+    if (this->m_renderer == nullptr)
+    {
+        log::error("Failed to create offscreen renderer: {}", SDL_GetError());
+        SDL_FreeSurface(this->m_surface);
+        this->m_surface = nullptr;
+        return false;
+    }
+
+    this->m_outputSize          = {width, height};
+    this->m_nativeTextureFormat = TextureCache::getNativeFormat(this->m_renderer);
+    return true;
+}
+
+void e2d::internal::Renderer::applyHints(const e2d::RendererSettings& settings)
+{
+    SDL_SetHint(SDL_HINT_RENDER_BATCHING, settings.batching ? "1" : "0");
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, settings.textureFilter == ScaleFilter::Linear ? "linear" : "nearest");
+}
+
 bool e2d::internal::Renderer::isCreated() const
 {
     return this->m_renderer != nullptr;
@@ -66,10 +285,20 @@ bool e2d::internal::Renderer::isCreated() const
 
 void e2d::internal::Renderer::destroy()
 {
+    this->setPartialRedraw(false);
+    this->setRenderScale(1);
+
     if (this->m_renderer)
     {
         SDL_DestroyRenderer(this->m_renderer);
-        this->m_renderer = nullptr;
+        this->m_renderer            = nullptr;
+        this->m_nativeTextureFormat = 0;
+    }
+
+    if (this->m_surface)
+    {
+        SDL_FreeSurface(this->m_surface);
+        this->m_surface = nullptr;
     }
 }
 
@@ -78,24 +307,571 @@ void e2d::internal::Renderer::draw(const e2d::Renderable* renderable)
     this->m_renderQueue->push(renderable);
 }
 
-void e2d::internal::Renderer::render(const e2d::Color& drawColor) const
+void e2d::internal::Renderer::render(const e2d::Color& drawColor)
 {
-    SDL_SetRenderDrawColor(this->m_renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
-    SDL_RenderClear(this->m_renderer);
+    // No texture is the render target between frames, so this is the size of the screen
+    SDL_GetRendererOutputSize(this->m_renderer, &this->m_outputSize.x, &this->m_outputSize.y);
+
+    if (this->m_partialRedraw)
+    {
+        this->m_snapshot.background = drawColor;
+        this->m_snapshot.commands.clear();
+        this->m_snapshot.vertices.clear();
+        this->m_snapshot.indices.clear();
+    }
+    else
+    {
+        if (this->m_renderScale < 1 && this->updateBackBuffer(this->m_outputSize) && this->bindBackBuffer())
+        {
+            // Commands are drawn right away, so they go into the back buffer from the start
+            this->m_backBufferValid = false;
+        }
 
+        SDL_SetRenderDrawColor(this->m_renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
+        SDL_RenderClear(this->m_renderer);
+        this->m_lastTexture = nullptr;
+    }
+
+    // The queue pops in ascending priority, so the sorted buffered commands are merged in as it goes
+    auto& buffered = this->m_buffered.commands;
+    std::stable_sort(buffered.begin(),
+                     buffered.end(),
+                     [](const RenderCommand& lhs, const RenderCommand& rhs) { return lhs.priority < rhs.priority; });
+
+    std::size_t   next  = 0;
+    std::uint64_t drawn = 0;
     while (!this->m_renderQueue->isEmpty())
     {
         const Renderable* renderable = this->m_renderQueue->pop();
         if (renderable)
         {
+            auto last = next;
+            while (last < buffered.size() && buffered[last].priority < renderable->getRenderPriority())
+            {
+                ++last;
+            }
+            this->submitBuffered(next, last);
+            next = last;
+
             renderable->render();
+            ++drawn;
         }
     }
+    this->submitBuffered(next, buffered.size());
+    EngineMetrics::getInstance().renderablesDrawn.increment(drawn);
+
+    buffered.clear();
+    this->m_buffered.vertices.clear();
+    this->m_buffered.indices.clear();
+
+    if (this->m_partialRedraw)
+    {
+        this->m_snapshot.frame = ++this->m_frameCount;
+        this->present(this->m_snapshot);
+        return;
+    }
+
+    this->resetClip();
+    ++this->m_frameCount;
+    if (this->m_backBuffer && SDL_GetRenderTarget(this->m_renderer) == this->m_backBuffer)
+    {
+        this->presentBackBuffer(this->m_frameCount);
+        return;
+    }
+
+    if (this->m_captureEnabled)
+    {
+        this->captureFrame(this->m_frameCount);
+    }
 
     SDL_RenderPresent(this->m_renderer);
 }
 
+void e2d::internal::Renderer::submit(const RenderCommand& command)
+{
+    // Texture copies carry no geometry, so any snapshot will do as the source
+    this->dispatch(command, this->m_buffered);
+}
+
+void e2d::internal::Renderer::submit(const e2d::RenderCommandBuffer& buffer)
+{
+    const auto& recorded = *buffer.m_commands;
+    if (this->m_drawingToTarget || this->m_recording)
+    {
+        // There is no frame to merge the buffer into, so it is drawn on its own
+        std::vector<std::size_t> order(recorded.commands.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [&recorded](std::size_t lhs, std::size_t rhs)
+                         { return recorded.commands[lhs].priority < recorded.commands[rhs].priority; });
+        for (const auto index : order)
+        {
+            this->dispatch(recorded.commands[index], recorded);
+        }
+        return;
+    }
+
+    const auto firstVertex = this->m_buffered.vertices.size();
+    const auto firstIndex  = this->m_buffered.indices.size();
+
+    for (const auto& command : recorded.commands)
+    {
+        auto& merged = this->m_buffered.commands.emplace_back(command);
+        merged.firstVertex += firstVertex;
+        merged.firstIndex += firstIndex;
+    }
+    this->m_buffered.vertices.insert(this->m_buffered.vertices.end(),
+                                     recorded.vertices.begin(),
+                                     recorded.vertices.end());
+    this->m_buffered.indices.insert(this->m_buffered.indices.end(), recorded.indices.begin(), recorded.indices.end());
+}
+
+void e2d::internal::Renderer::submit(const RenderSnapshot& recorded)
+{
+    for (const auto& command : recorded.commands)
+    {
+        this->dispatch(command, recorded);
+    }
+}
+
+void e2d::internal::Renderer::beginRecording(RenderSnapshot& snapshot)
+{
+    this->m_recording = &snapshot;
+}
+
+void e2d::internal::Renderer::endRecording()
+{
+    this->m_recording = nullptr;
+}
+
+bool e2d::internal::Renderer::renderToTarget(SDL_Texture* target, const std::function<void()>& draw)
+{
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(this->m_renderer);
+    this->resetClip();
+    if (SDL_SetRenderTarget(this->m_renderer, target) != 0)
+    {
+        log::error("Failed to draw to render target: {}", SDL_GetError());
+        return false;
+    }
+
+    // Drawing into a target may be nested, e.g. baking a layer while drawing into a render texture
+    const bool     wasDrawingToTarget = this->m_drawingToTarget;
+    const Vector2i previousTargetSize = this->m_targetSize;
+    SDL_QueryTexture(target, nullptr, nullptr, &this->m_targetSize.x, &this->m_targetSize.y);
+
+    this->m_drawingToTarget = true;
+    this->m_lastTexture     = nullptr;
+    draw();
+    this->resetClip();
+    this->m_drawingToTarget = wasDrawingToTarget;
+    this->m_targetSize      = previousTargetSize;
+    this->m_lastTexture     = nullptr;
+
+    if (SDL_SetRenderTarget(this->m_renderer, previousTarget) != 0)
+    {
+        log::error("Failed to restore render target: {}", SDL_GetError());
+        return false;
+    }
+    if (previousTarget != nullptr && previousTarget == this->m_backBuffer)
+    {
+        // Setting a target resets the scale, which maps the coordinates of the screen onto the back buffer
+        SDL_RenderSetScale(this->m_renderer, this->m_backBufferScale.x, this->m_backBufferScale.y);
+    }
+    return true;
+}
+
+bool e2d::internal::Renderer::setPartialRedraw(bool enabled)
+{
+    if (enabled && this->m_renderer && !SDL_RenderTargetSupported(this->m_renderer))
+    {
+        log::error("Failed to enable partial redraw: the renderer does not support render targets");
+        return false;
+    }
+
+    this->m_partialRedraw   = enabled;
+    this->m_backBufferValid = false;
+    this->m_presented.commands.clear();
+    this->m_presented.vertices.clear();
+    this->m_presented.indices.clear();
+    this->releaseBackBuffer();
+    return true;
+}
+
+bool e2d::internal::Renderer::isPartialRedraw() const
+{
+    return this->m_partialRedraw;
+}
+
+void e2d::internal::Renderer::setRenderScale(float renderScale)
+{
+    this->m_renderScale = std::clamp(renderScale, MinRenderScale, 1.f);
+    this->releaseBackBuffer();
+}
+
+float e2d::internal::Renderer::getRenderScale() const
+{
+    return this->m_renderScale;
+}
+
+void e2d::internal::Renderer::setScaleFilter(e2d::ScaleFilter scaleFilter)
+{
+    this->m_scaleFilter = scaleFilter;
+    if (this->m_backBuffer)
+    {
+        SDL_SetTextureScaleMode(this->m_backBuffer,
+                                scaleFilter == ScaleFilter::Nearest ? SDL_ScaleModeNearest : SDL_ScaleModeLinear);
+    }
+}
+
+e2d::ScaleFilter e2d::internal::Renderer::getScaleFilter() const
+{
+    return this->m_scaleFilter;
+}
+
+e2d::Vector2i e2d::internal::Renderer::getOutputSize() const
+{
+    return this->m_outputSize;
+}
+
+e2d::Vector2i e2d::internal::Renderer::getTargetSize() const
+{
+    return this->m_drawingToTarget ? this->m_targetSize : this->m_outputSize;
+}
+
+void e2d::internal::Renderer::submitBuffered(std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        this->dispatch(this->m_buffered.commands[i], this->m_buffered);
+    }
+}
+
+void e2d::internal::Renderer::dispatch(const RenderCommand& command, const RenderSnapshot& source)
+{
+    if (this->m_recording)
+    {
+        append(command, source, *this->m_recording);
+    }
+    else if (this->m_partialRedraw && !this->m_drawingToTarget)
+    {
+        append(command, source, this->m_snapshot);
+    }
+    else
+    {
+        this->execute(command, source);
+    }
+}
+
+void e2d::internal::Renderer::append(const RenderCommand&  command,
+                                     const RenderSnapshot& source,
+                                     RenderSnapshot&       destination)
+{
+    auto& appended = destination.commands.emplace_back(command);
+    if (command.vertexCount > 0)
+    {
+        // Moves the geometry along, since the source is typically reused once the command is issued
+        const auto vertices = source.vertices.begin() + static_cast<std::ptrdiff_t>(command.firstVertex);
+        const auto indices  = source.indices.begin() + static_cast<std::ptrdiff_t>(command.firstIndex);
+
+        appended.firstVertex = destination.vertices.size();
+        appended.firstIndex  = destination.indices.size();
+        destination.vertices.insert(destination.vertices.end(),
+                                    vertices,
+                                    vertices + static_cast<std::ptrdiff_t>(command.vertexCount));
+        destination.indices.insert(destination.indices.end(),
+                                   indices,
+                                   indices + static_cast<std::ptrdiff_t>(command.indexCount));
+    }
+}
+
+void e2d::internal::Renderer::execute(const RenderCommand& command, const RenderSnapshot& source)
+{
+    SDL_Rect clip    = command.clip;
+    bool     clipped = command.hasClip;
+    if (this->m_dirtyClipping)
+    {
+        // Commands outside of the area being redrawn would not change a pixel
+        const SDL_Rect bounds = getBounds(command, source);
+        if (!SDL_HasIntersection(&bounds, &this->m_dirty))
+        {
+            return;
+        }
+        if (!clipped)
+        {
+            clip = this->m_dirty;
+        }
+        else if (!SDL_IntersectRect(&clip, &this->m_dirty, &clip))
+        {
+            return;
+        }
+        clipped = true;
+    }
+
+    if (clipped != this->m_clipped || (clipped && !SDL_RectEquals(&clip, &this->m_clip)))
+    {
+        SDL_RenderSetClipRect(this->m_renderer, clipped ? &clip : nullptr);
+        this->m_clip    = clip;
+        this->m_clipped = clipped;
+    }
+
+    if (command.vertexCount > 0)
+    {
+        SDL_RenderGeometry(this->m_renderer,
+                           command.texture,
+                           &source.vertices[command.firstVertex],
+                           static_cast<int>(command.vertexCount),
+                           command.indexCount > 0 ? &source.indices[command.firstIndex] : nullptr,
+                           static_cast<int>(command.indexCount));
+    }
+    else
+    {
+        SDL_RenderCopyEx(this->m_renderer,
+                         command.texture,
+                         command.hasSource ? &command.source : nullptr,
+                         &command.destination,
+                         command.angle,
+                         &command.center,
+                         command.flip);
+    }
+
+    const auto& metrics = EngineMetrics::getInstance();
+    metrics.drawCalls.increment();
+    if (command.texture != this->m_lastTexture)
+    {
+        metrics.textureSwitches.increment();
+        this->m_lastTexture = command.texture;
+    }
+}
+
+void e2d::internal::Renderer::present(const RenderSnapshot& snapshot)
+{
+    if (this->m_partialRedraw && this->presentPartial(snapshot))
+    {
+        return;
+    }
+
+    Vector2i outputSize;
+    SDL_GetRendererOutputSize(this->m_renderer, &outputSize.x, &outputSize.y);
+    const bool scaled = this->m_renderScale < 1 && this->updateBackBuffer(outputSize) && this->bindBackBuffer();
+
+    const auto& color = snapshot.background;
+    SDL_SetRenderDrawColor(this->m_renderer, color.r, color.g, color.b, color.a);
+    SDL_RenderClear(this->m_renderer);
+
+    this->m_lastTexture = nullptr;
+    for (const auto& command : snapshot.commands)
+    {
+        this->execute(command, snapshot);
+    }
+    this->resetClip();
+
+    if (scaled)
+    {
+        this->m_backBufferValid = false;
+        this->presentBackBuffer(snapshot.frame);
+        return;
+    }
+
+    if (this->m_captureEnabled)
+    {
+        this->captureFrame(snapshot.frame);
+    }
+
+    SDL_RenderPresent(this->m_renderer);
+}
+
+bool e2d::internal::Renderer::presentPartial(const RenderSnapshot& snapshot)
+{
+    Vector2i outputSize;
+    SDL_GetRendererOutputSize(this->m_renderer, &outputSize.x, &outputSize.y);
+    if (!this->updateBackBuffer(outputSize))
+    {
+        return false;
+    }
+
+    const SDL_Rect screen{0, 0, outputSize.x, outputSize.y};
+    SDL_Rect       dirty = screen;
+    if (this->m_backBufferValid && snapshot.background == this->m_presented.background)
+    {
+        dirty = findChangedArea(this->m_presented, snapshot);
+        if (SDL_RectEmpty(&dirty))
+        {
+            EngineMetrics::getInstance().framesSkipped.increment();
+            return true;
+        }
+
+        if (this->m_renderScale < 1)
+        {
+            // Pixels of the back buffer on the edge of the area may be partly outside of it, so the edge is
+            // widened by a pixel of the back buffer, where drawing again gives the same result as before
+            const auto margin = static_cast<int>(std::ceil(1 / this->m_renderScale));
+            dirty.x -= margin;
+            dirty.y -= margin;
+            dirty.w += 2 * margin;
+            dirty.h += 2 * margin;
+        }
+        if (!SDL_IntersectRect(&dirty, &screen, &dirty))
+        {
+            EngineMetrics::getInstance().framesSkipped.increment();
+            return true;
+        }
+    }
+
+    this->resetClip();
+    if (!this->bindBackBuffer())
+    {
+        // The back buffer may be left half drawn, so it is drawn whole next time
+        this->m_backBufferValid = false;
+        return false;
+    }
+
+    // Clearing would ignore the clip rectangle, so the area is filled instead
+    const auto& color = snapshot.background;
+    SDL_SetRenderDrawColor(this->m_renderer, color.r, color.g, color.b, color.a);
+    SDL_SetRenderDrawBlendMode(this->m_renderer, SDL_BLENDMODE_NONE);
+    SDL_RenderFillRect(this->m_renderer, &dirty);
+
+    this->m_lastTexture   = nullptr;
+    this->m_dirty         = dirty;
+    this->m_dirtyClipping = true;
+    for (const auto& command : snapshot.commands)
+    {
+        this->execute(command, snapshot);
+    }
+    this->m_dirtyClipping = false;
+    this->resetClip();
+
+    this->m_presented       = snapshot;
+    this->m_backBufferValid = true;
+    this->presentBackBuffer(snapshot.frame);
+    return true;
+}
+
+bool e2d::internal::Renderer::updateBackBuffer(const Vector2i& outputSize)
+{
+    const Vector2i size(std::max(1, static_cast<int>(static_cast<float>(outputSize.x) * this->m_renderScale)),
+                        std::max(1, static_cast<int>(static_cast<float>(outputSize.y) * this->m_renderScale)));
+
+    Vector2i bufferSize;
+    if (this->m_backBuffer)
+    {
+        SDL_QueryTexture(this->m_backBuffer, nullptr, nullptr, &bufferSize.x, &bufferSize.y);
+        if (bufferSize == size)
+        {
+            return true;
+        }
+        SDL_DestroyTexture(this->m_backBuffer);
+    }
+
+    this->m_backBufferValid = false;
+    this->m_backBuffer      = SDL_CreateTexture(this->m_renderer,
+                                           SDL_PIXELFORMAT_RGBA32,
+                                           SDL_TEXTUREACCESS_TARGET,
+                                           size.x,
+                                           size.y);
+    if (this->m_backBuffer == nullptr)
+    {
+        log::error("Failed to create back buffer: {}", SDL_GetError());
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(this->m_backBuffer, SDL_BLENDMODE_NONE);
+    SDL_SetTextureScaleMode(this->m_backBuffer,
+                            this->m_scaleFilter == ScaleFilter::Nearest ? SDL_ScaleModeNearest : SDL_ScaleModeLinear);
+    this->m_backBufferScale = {static_cast<float>(size.x) / static_cast<float>(outputSize.x),
+                               static_cast<float>(size.y) / static_cast<float>(outputSize.y)};
+    return true;
+}
+
+bool e2d::internal::Renderer::bindBackBuffer()
+{
+    if (SDL_SetRenderTarget(this->m_renderer, this->m_backBuffer) != 0)
+    {
+        log::error("Failed to draw to back buffer: {}", SDL_GetError());
+        return false;
+    }
+    SDL_RenderSetScale(this->m_renderer, this->m_backBufferScale.x, this->m_backBufferScale.y);
+    return true;
+}
+
+void e2d::internal::Renderer::presentBackBuffer(std::uint64_t frame)
+{
+    SDL_SetRenderTarget(this->m_renderer, nullptr);
+    SDL_RenderCopy(this->m_renderer, this->m_backBuffer, nullptr, nullptr);
+
+    if (this->m_captureEnabled)
+    {
+        this->captureFrame(frame);
+    }
+
+    SDL_RenderPresent(this->m_renderer);
+}
+
+void e2d::internal::Renderer::releaseBackBuffer()
+{
+    if (this->m_backBuffer && !this->m_partialRedraw && this->m_renderScale >= 1)
+    {
+        SDL_DestroyTexture(this->m_backBuffer);
+        this->m_backBuffer = nullptr;
+    }
+}
+
+void e2d::internal::Renderer::resetClip()
+{
+    if (this->m_clipped)
+    {
+        SDL_RenderSetClipRect(this->m_renderer, nullptr);
+        this->m_clipped = false;
+    }
+}
+
+void e2d::internal::Renderer::setCaptureEnabled(bool enabled)
+{
+    this->m_captureEnabled = enabled;
+}
+
+bool e2d::internal::Renderer::isCaptureEnabled() const
+{
+    return this->m_captureEnabled;
+}
+
+const e2d::FrameCapture& e2d::internal::Renderer::getCapturedFrame() const
+{
+    return this->m_capture;
+}
+
 SDL_Renderer* e2d::internal::Renderer::getNativeRenderer() const
 {
     return this->m_renderer;
 }
+
+std::uint32_t e2d::internal::Renderer::getNativeTextureFormat() const
+{
+    return this->m_nativeTextureFormat;
+}
+
+void e2d::internal::Renderer::captureFrame(std::uint64_t frame)
+{
+    int width  = 0;
+    int height = 0;
+    if (SDL_GetRendererOutputSize(this->m_renderer, &width, &height) != 0)
+    {
+        log::error("Failed to capture frame: {}", SDL_GetError());
+        return;
+    }
+
+    // Reuses the pixel buffer of the previous capture as long as the size does not change
+    this->m_capture.size = {width, height};
+    this->m_capture.pixels.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+    if (SDL_RenderReadPixels(this->m_renderer,
+                             nullptr,
+                             SDL_PIXELFORMAT_RGBA32,
+                             this->m_capture.pixels.data(),
+                             width * 4) != 0)
+    {
+        log::error("Failed to capture frame: {}", SDL_GetError());
+        return;
+    }
+    this->m_capture.frame = frame;
+}
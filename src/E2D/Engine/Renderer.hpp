@@ -31,14 +31,26 @@
 
 #include <E2D/Core/Color.hpp>
 #include <E2D/Core/NonCopyable.hpp>
+#include <E2D/Core/Vector2.hpp>
 
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/RendererSettings.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/ScaleFilter.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 
 struct SDL_Renderer; // Forward declaration of SDL_Renderer
+struct SDL_Surface;  // Forward declaration of SDL_Surface
+struct SDL_Texture;  // Forward declaration of SDL_Texture
 
 namespace e2d
 {
-class Renderable; // Forward declaration of Renderable
+class Renderable;          // Forward declaration of Renderable
+class RenderCommandBuffer; // Forward declaration of RenderCommandBuffer
 
 namespace internal
 {
@@ -59,6 +71,8 @@ class Window;      // Forward declaration of Window
 class E2D_ENGINE_API Renderer final : NonCopyable
 {
 public:
+    static constexpr float MinRenderScale = 0.25f; //!< The smallest fraction of the output size frames are drawn at.
+
     /**
      * @brief Constructs a new Renderer object.
      *
@@ -77,9 +91,23 @@ public:
      * @brief Initializes the renderer with the specified window.
      *
      * @param window A reference to the Window object to render to.
+     * @param settings The driver, vsync and hints to create the renderer with.
      * @return True if initialization is successful, false otherwise.
      */
-    bool create(const Window& window);
+    bool create(const Window& window, const RendererSettings& settings = {});
+
+    /**
+     * @brief Initializes the renderer to draw into an offscreen surface.
+     *
+     * Uses the software renderer, so no window, display or GPU is needed. The surface keeps the
+     * last rendered frame, which can be read back with frame capturing.
+     *
+     * @param width The width of the surface in pixels.
+     * @param height The height of the surface in pixels.
+     * @param settings The hints to create the renderer with; the driver and vsync are ignored.
+     * @return True if initialization is successful, false otherwise.
+     */
+    bool createOffscreen(int width, int height, const RendererSettings& settings = {});
 
     /**
      * @brief Checks if the renderer is created and valid.
@@ -111,7 +139,163 @@ public:
      *
      * @param drawColor The color to clear the screen with before rendering.
      */
-    void render(const Color& drawColor) const;
+    void render(const Color& drawColor);
+
+    /**
+     * @brief Draws a texture as part of the frame being rendered.
+     *
+     * Renderable objects call this from their render method instead of calling SDL directly. The
+     * command is issued right away, or recorded into the snapshot of the frame with partial redraw.
+     *
+     * @param command The texture copy to draw.
+     */
+    void submit(const RenderCommand& command);
+
+    /**
+     * @brief Adds the commands recorded into a buffer to the frame being prepared.
+     *
+     * The commands are copied, so the buffer can be cleared and recorded again right away. When the
+     * frame is rendered, the commands of all buffers are stable sorted by render priority and drawn
+     * between the renderables of the queue, after those with the same priority.
+     *
+     * @param buffer The recorded commands to draw.
+     */
+    void submit(const RenderCommandBuffer& buffer);
+
+    /**
+     * @brief Draws previously recorded commands as part of the frame being rendered.
+     *
+     * @param recorded The commands to draw, in order, together with their geometry.
+     */
+    void submit(const RenderSnapshot& recorded);
+
+    /**
+     * @brief Collects the commands submitted from now on instead of drawing them.
+     *
+     * Lets the caller find out what renderables would draw, for example to tell whether a cached
+     * layer is still up to date, and draw it later with submit(). Recording lasts until endRecording().
+     *
+     * @param snapshot The snapshot to append the commands and their geometry to.
+     */
+    void beginRecording(RenderSnapshot& snapshot);
+
+    /**
+     * @brief Stops collecting commands, so that submitted commands are drawn again.
+     */
+    void endRecording();
+
+    /**
+     * @brief Draws into a texture instead of the screen, right away.
+     *
+     * Everything submitted while the draw function runs is drawn into the target immediately, and
+     * command buffers are drawn on their own in render priority order. The previous target is restored
+     * afterwards, so this can be called in the middle of a frame. The draw function must not create or
+     * destroy textures.
+     *
+     * @param target A texture created with SDL_TEXTUREACCESS_TARGET.
+     * @param draw The function submitting what to draw.
+     * @return True if the target was drawn to, false otherwise.
+     */
+    bool renderToTarget(SDL_Texture* target, const std::function<void()>& draw);
+
+    /**
+     * @brief Enables or disables redrawing only the parts of the screen that changed.
+     *
+     * Frames are drawn into a back buffer texture that persists between frames. What the renderables
+     * draw is recorded and compared with the previous frame, and only the area covered by commands
+     * that changed, appeared or disappeared is cleared and drawn again, skipping commands outside of
+     * it. The back buffer is then copied to the screen. A frame in which nothing changed is neither
+     * drawn nor presented. Renderables must submit commands instead of calling SDL directly.
+     *
+     * @param enabled True to redraw only what changed, false to redraw the whole screen every frame.
+     * @return True if the mode was set, false if the renderer does not support render targets.
+     */
+    bool setPartialRedraw(bool enabled);
+
+    /**
+     * @brief Checks whether only the parts of the screen that changed are redrawn.
+     *
+     * @return True if partial redraw is enabled, false otherwise.
+     */
+    bool isPartialRedraw() const;
+
+    /**
+     * @brief Sets the fraction of the output size frames are drawn at.
+     *
+     * Below 1, frames are drawn into a back buffer of that fraction of the output size, in the same
+     * coordinates as at full size, and stretched onto the screen with the scale filter. Fewer pixels
+     * are drawn, at the cost of sharpness. Changing the render scale creates the back buffer again.
+     *
+     * @param renderScale The render scale, clamped between MinRenderScale and 1.
+     */
+    void setRenderScale(float renderScale);
+
+    /**
+     * @brief Retrieves the fraction of the output size frames are drawn at.
+     *
+     * @return The render scale.
+     */
+    float getRenderScale() const;
+
+    /**
+     * @brief Sets how frames drawn at a reduced render scale are stretched onto the screen.
+     *
+     * @param scaleFilter The scale filter.
+     */
+    void setScaleFilter(ScaleFilter scaleFilter);
+
+    /**
+     * @brief Retrieves how frames drawn at a reduced render scale are stretched onto the screen.
+     *
+     * @return The scale filter.
+     */
+    ScaleFilter getScaleFilter() const;
+
+    /**
+     * @brief Retrieves the size of the screen in the coordinates renderables draw in.
+     *
+     * This is the output size of the window or offscreen surface, also while drawing into a texture or
+     * at a reduced render scale. It is updated when the renderer is created and with every frame.
+     *
+     * @return The size of the screen in pixels.
+     */
+    Vector2i getOutputSize() const;
+
+    /**
+     * @brief Retrieves the size of what is being drawn into, for culling.
+     *
+     * While drawing into a texture with renderToTarget(), this is the size of the texture, otherwise it
+     * is the output size.
+     *
+     * @return The size of the current render target in pixels.
+     */
+    Vector2i getTargetSize() const;
+
+    /**
+     * @brief Enables or disables reading every rendered frame back to memory.
+     *
+     * Reading back a frame stalls until rendering has finished, so it is only meant for tests and
+     * tools, and works best with an offscreen renderer.
+     *
+     * @param enabled True to capture every frame, false to stop capturing.
+     */
+    void setCaptureEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether rendered frames are read back to memory.
+     *
+     * @return True if frames are captured, false otherwise.
+     */
+    bool isCaptureEnabled() const;
+
+    /**
+     * @brief Retrieves the last captured frame.
+     *
+     * The capture remains unchanged until the next frame is rendered.
+     *
+     * @return The last frame rendered while capturing was enabled, or an empty capture if there is none.
+     */
+    const FrameCapture& getCapturedFrame() const;
 
     /**
      * @brief Retrieves the native renderer object.
@@ -122,9 +306,141 @@ public:
      */
     SDL_Renderer* getNativeRenderer() const;
 
+    /**
+     * @brief Retrieves the pixel format textures are created in.
+     *
+     * The format is queried once when the renderer is created, so unlike querying the renderer this
+     * may be called on loader threads.
+     *
+     * @return The SDL pixel format, or SDL_PIXELFORMAT_UNKNOWN if the renderer is not created.
+     */
+    std::uint32_t getNativeTextureFormat() const;
+
 private:
-    SDL_Renderer*                          m_renderer{nullptr}; //!< Pointer to the underlying SDL_Renderer object.
-    std::unique_ptr<internal::RenderQueue> m_renderQueue;       //!< Pointer to the render queue.
+    /**
+     * @brief Sets the SDL hints that are read when a renderer or texture is created.
+     *
+     * @param settings The settings to take the hints from.
+     */
+    static void applyHints(const RendererSettings& settings);
+
+    /**
+     * @brief Issues the commands of submitted buffers, or records them with partial redraw.
+     *
+     * @param begin The index of the first buffered command to issue.
+     * @param end The index one past the last buffered command to issue.
+     */
+    void submitBuffered(std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Issues a command, or appends it to the recording or the snapshot of the frame.
+     *
+     * @param command The texture copy or geometry draw to issue.
+     * @param source The snapshot holding the vertices and indices of a geometry draw.
+     */
+    void dispatch(const RenderCommand& command, const RenderSnapshot& source);
+
+    /**
+     * @brief Appends a command to a snapshot, along with its geometry.
+     *
+     * @param command The texture copy or geometry draw to append.
+     * @param source The snapshot holding the vertices and indices of a geometry draw.
+     * @param destination The snapshot to append to.
+     */
+    static void append(const RenderCommand& command, const RenderSnapshot& source, RenderSnapshot& destination);
+
+    /**
+     * @brief Issues a draw command and counts it in the engine metrics.
+     *
+     * @param command The texture copy or geometry draw to issue.
+     * @param source The snapshot holding the vertices and indices of a geometry draw.
+     */
+    void execute(const RenderCommand& command, const RenderSnapshot& source);
+
+    /**
+     * @brief Lets drawing reach the whole screen again if a command has clipped it.
+     */
+    void resetClip();
+
+    /**
+     * @brief Clears the screen, issues the commands of a snapshot and presents the frame.
+     *
+     * With partial redraw, only what changed since the last frame is drawn, see presentPartial().
+     *
+     * @param snapshot The frame to draw.
+     */
+    void present(const RenderSnapshot& snapshot);
+
+    /**
+     * @brief Draws the parts of a snapshot that changed since the last frame into the back buffer, and
+     * presents it.
+     *
+     * @param snapshot The frame to draw.
+     * @return True if the frame was presented or skipped, false if the back buffer could not be drawn to.
+     */
+    bool presentPartial(const RenderSnapshot& snapshot);
+
+    /**
+     * @brief Creates the back buffer, or creates it again if it does not have the output size at the
+     * render scale.
+     *
+     * @param outputSize The size of the screen in pixels.
+     * @return True if the back buffer is ready, false if it could not be created.
+     */
+    bool updateBackBuffer(const Vector2i& outputSize);
+
+    /**
+     * @brief Draws into the back buffer from now on, in the coordinates of the screen.
+     *
+     * @return True if the back buffer is drawn into, false otherwise.
+     */
+    bool bindBackBuffer();
+
+    /**
+     * @brief Draws into the screen again, copies the back buffer onto it and presents the frame.
+     *
+     * @param frame The number of the frame.
+     */
+    void presentBackBuffer(std::uint64_t frame);
+
+    /**
+     * @brief Destroys the back buffer, unless partial redraw or a reduced render scale still need it.
+     */
+    void releaseBackBuffer();
+
+    /**
+     * @brief Reads the pixels of the frame that was just rendered into the capture.
+     *
+     * @param frame The number of the frame.
+     */
+    void captureFrame(std::uint64_t frame);
+
+    SDL_Renderer*                          m_renderer{nullptr};      //!< Pointer to the underlying SDL_Renderer object.
+    SDL_Surface*                           m_surface{nullptr};       //!< The surface of an offscreen renderer.
+    std::uint32_t                          m_nativeTextureFormat{0}; //!< The pixel format textures are created in.
+    std::unique_ptr<internal::RenderQueue> m_renderQueue;            //!< Pointer to the render queue.
+    const SDL_Texture*                     m_lastTexture{nullptr};   //!< The texture of the previous draw call.
+    bool                                   m_captureEnabled{false};  //!< Whether frames are read back to memory.
+    FrameCapture                           m_capture;                //!< The last captured frame.
+    std::uint64_t                          m_frameCount{0};          //!< The number of frames rendered.
+    RenderSnapshot                         m_buffered;               //!< The commands of the submitted buffers.
+    SDL_Rect                               m_clip{};                 //!< The clip rectangle of the previous draw call.
+    bool                                   m_clipped{false};         //!< Whether the previous draw call was clipped.
+    RenderSnapshot*                        m_recording{nullptr};     //!< The snapshot collecting submitted commands.
+    bool                                   m_drawingToTarget{false}; //!< Whether commands are drawn into a texture.
+    RenderSnapshot                         m_snapshot;               //!< The frame recorded with partial redraw.
+
+    bool           m_partialRedraw{false};             //!< Whether only what changed is redrawn.
+    SDL_Texture*   m_backBuffer{nullptr};              //!< The texture frames are drawn into, if any.
+    Vector2f       m_backBufferScale{1, 1};            //!< The size of a screen pixel in the back buffer.
+    bool           m_backBufferValid{false};           //!< Whether the back buffer holds m_presented.
+    RenderSnapshot m_presented;                        //!< The frame last drawn with partial redraw.
+    SDL_Rect       m_dirty{};                          //!< The area being redrawn.
+    bool           m_dirtyClipping{false};             //!< Whether drawing is limited to m_dirty.
+    float          m_renderScale{1};                   //!< The fraction of the output size frames are drawn at.
+    ScaleFilter    m_scaleFilter{ScaleFilter::Linear}; //!< How the back buffer is stretched onto the screen.
+    Vector2i       m_outputSize;                       //!< The size of the screen.
+    Vector2i       m_targetSize;                       //!< The size of the texture drawn into by renderToTarget().
 
 }; // class Renderer
 
@@ -50,31 +50,60 @@ e2d::internal::RendererContext& e2d::internal::RendererContext::getInstance()
 
 bool e2d::internal::RendererContext::isInitialized() const
 {
-    return this->m_window->isCreated() && this->m_renderer->isCreated();
+    const bool hasWindow = this->m_renderMode == RenderMode::Headless || this->m_window->isCreated();
+    return hasWindow && this->m_renderer->isCreated();
 }
 
-bool e2d::internal::RendererContext::initialize()
+bool e2d::internal::RendererContext::initialize(RenderMode              renderMode,
+                                                const std::string&      title,
+                                                const WindowSettings&   windowSettings,
+                                                const RendererSettings& rendererSettings)
 {
     if (this->isInitialized())
     {
         return false;
     }
 
-    if (!this->m_window->create("E2D", 800, 600))
+    this->m_renderMode = renderMode;
+
+    if (renderMode == RenderMode::Headless)
     {
-        log::error("Failed to create window");
-        return false;
+        if (!this->m_renderer->createOffscreen(windowSettings.size.x, windowSettings.size.y, rendererSettings))
+        {
+            log::error("Failed to create offscreen renderer");
+            return false;
+        }
     }
-
-    if (!this->m_renderer->create(*this->m_window))
+    else
     {
-        log::error("Failed to create renderer");
-        return false;
+        if (!this->m_window->create(title.c_str(), windowSettings))
+        {
+            log::error("Failed to create window");
+            return false;
+        }
+
+        if (!this->m_renderer->create(*this->m_window, rendererSettings))
+        {
+            log::error("Failed to create renderer");
+            return false;
+        }
     }
 
+    this->m_renderThreadId = std::this_thread::get_id();
+
     return true;
 }
 
+e2d::RenderMode e2d::internal::RendererContext::getRenderMode() const
+{
+    return this->m_renderMode;
+}
+
+bool e2d::internal::RendererContext::isRenderThread() const
+{
+    return this->m_renderThreadId == std::this_thread::get_id();
+}
+
 void e2d::internal::RendererContext::destroy()
 {
     if (this->m_renderer)
@@ -31,7 +31,13 @@
 
 #include <E2D/Core/NonCopyable.hpp>
 
+#include <E2D/Engine/RenderMode.hpp>
+#include <E2D/Engine/RendererSettings.hpp>
+#include <E2D/Engine/WindowSettings.hpp>
+
 #include <memory>
+#include <string>
+#include <thread>
 
 namespace e2d::internal
 {
@@ -66,6 +72,7 @@ public:
      * @brief Checks if the RendererContext is initialized.
      *
      * Determines whether the window and renderer have been successfully created and initialized.
+     * In headless mode there is no window, so only the renderer is checked.
      *
      * @return True if both the window and renderer are initialized, false otherwise.
      */
@@ -75,12 +82,38 @@ public:
      * @brief Initializes the window and renderer.
      *
      * Creates the window and renderer necessary for rendering operations. This method must be
-     * called before any rendering can take place. It sets up the window with a default title,
-     * width, and height, and associates it with the renderer.
+     * called before any rendering can take place. It sets up the window with the given title and
+     * settings, and associates it with the renderer. In headless mode no window is created and
+     * the renderer draws into an offscreen surface of the window size instead.
      *
+     * @param renderMode Whether to render to a window or offscreen.
+     * @param title The title of the window.
+     * @param windowSettings The size and mode of the window.
+     * @param rendererSettings The driver, vsync and hints of the renderer.
      * @return True if initialization is successful, false otherwise.
      */
-    bool initialize();
+    bool initialize(RenderMode              renderMode       = RenderMode::Windowed,
+                    const std::string&      title            = "E2D",
+                    const WindowSettings&   windowSettings   = {},
+                    const RendererSettings& rendererSettings = {});
+
+    /**
+     * @brief Retrieves the render mode the context was last initialized with.
+     *
+     * @return The render mode.
+     */
+    RenderMode getRenderMode() const;
+
+    /**
+     * @brief Checks if the calling thread is the render thread.
+     *
+     * The render thread is the thread that initialized the context. All operations that talk to the
+     * GPU, such as creating or uploading textures, must be performed on this thread since the
+     * underlying SDL renderer is not thread-safe.
+     *
+     * @return True if the calling thread is the render thread, false otherwise.
+     */
+    bool isRenderThread() const;
 
     /**
      * @brief Destroys the window and renderer.
@@ -127,8 +160,10 @@ private:
      */
     ~RendererContext();
 
-    std::unique_ptr<Window>   m_window;   //!< Unique pointer to the window.
-    std::unique_ptr<Renderer> m_renderer; //!< Unique pointer to the renderer.
+    std::unique_ptr<Window>   m_window;                            //!< Unique pointer to the window.
+    std::unique_ptr<Renderer> m_renderer;                          //!< Unique pointer to the renderer.
+    std::thread::id           m_renderThreadId;                    //!< Identifier of the thread that initialized the context.
+    RenderMode                m_renderMode = RenderMode::Windowed; //!< Whether the context renders offscreen.
 
 }; // RendererContext class
 
@@ -37,3 +37,8 @@ e2d::Resource::~Resource()
 {
     log::debug("Destructing Resource");
 }
+
+std::function<bool()> e2d::Resource::prepareFromFile(const std::string& filepath)
+{
+    return [this, filepath]() { return this->loadFromFile(filepath); };
+}
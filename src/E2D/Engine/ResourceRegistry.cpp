@@ -26,19 +26,40 @@
 
 #include <E2D/Core/Logger.hpp>
 
+#include <E2D/Engine/EngineMetrics.hpp>
+#include <E2D/Engine/FileWatcher.hpp>
+#include <E2D/Engine/Font.hpp>
 #include <E2D/Engine/ResourceRegistry.hpp>
 #include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/TextureAtlas.hpp>
+#include <E2D/Engine/TextureCache.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <system_error>
+#include <thread>
 #include <utility>
+#include <vector>
 
 e2d::ResourceRegistry::ResourceRegistry()
 {
     log::debug("Constructing ResourceRegistry");
+
+    this->registerManifestType<Texture>("texture");
+    this->registerManifestType<Font>("font");
+    this->registerManifestType<TextureAtlas>("atlas");
 }
 
 e2d::ResourceRegistry::~ResourceRegistry()
 {
     log::debug("Destructing ResourceRegistry");
+    this->disableHotReload();
 }
 
 e2d::ResourceRegistry& e2d::ResourceRegistry::getInstance()
@@ -47,6 +68,341 @@ e2d::ResourceRegistry& e2d::ResourceRegistry::getInstance()
     return instance;
 }
 
+bool e2d::ResourceRegistry::loadManifest(const std::string& filepath, const ProgressCallback& progress)
+{
+    std::ifstream file(filepath);
+    if (!file)
+    {
+        log::error("Failed to open resource manifest '{}'", filepath);
+        return false;
+    }
+    return this->loadManifest(file, filepath, progress);
+}
+
+bool e2d::ResourceRegistry::loadManifestFromMemory(const void* data, std::size_t size, const ProgressCallback& progress)
+{
+    std::istringstream stream(std::string(static_cast<const char*>(data), size));
+    return this->loadManifest(stream, "memory", progress);
+}
+
+bool e2d::ResourceRegistry::enableTextureCache(const std::string& directory)
+{
+    return internal::TextureCache::getInstance().enable(directory);
+}
+
+void e2d::ResourceRegistry::disableTextureCache()
+{
+    internal::TextureCache::getInstance().disable();
+}
+
+bool e2d::ResourceRegistry::isTextureCacheEnabled() const
+{
+    return internal::TextureCache::getInstance().isEnabled();
+}
+
+e2d::ResourceRegistry::TextureCacheStats e2d::ResourceRegistry::getTextureCacheStats() const
+{
+    const auto& textureCache = internal::TextureCache::getInstance();
+    return {textureCache.getHits(), textureCache.getMisses()};
+}
+
+void e2d::ResourceRegistry::resetTextureCacheStats()
+{
+    internal::TextureCache::getInstance().resetStats();
+}
+
+bool e2d::ResourceRegistry::enableHotReload()
+{
+    const std::unique_lock<std::shared_mutex> lock(this->m_mutex);
+    if (this->m_fileWatcher)
+    {
+        return true;
+    }
+
+    auto fileWatcher = std::make_unique<internal::FileWatcher>([this](const std::string& filepath)
+                                                                { this->prepareReload(filepath); });
+    for (const auto& [identifier, resource] : this->m_resources)
+    {
+        if (!resource->getFilepath().empty())
+        {
+            fileWatcher->watch(resource->getFilepath());
+        }
+    }
+    if (!fileWatcher->start())
+    {
+        log::error("Failed to enable hot reloading of resources");
+        return false;
+    }
+
+    log::info("Enabled hot reloading of resources");
+    this->m_fileWatcher = std::move(fileWatcher);
+    return true;
+}
+
+void e2d::ResourceRegistry::disableHotReload()
+{
+    std::unique_ptr<internal::FileWatcher> fileWatcher;
+    {
+        const std::unique_lock<std::shared_mutex> lock(this->m_mutex);
+        fileWatcher = std::move(this->m_fileWatcher);
+    }
+
+    // Stop outside the lock, the watcher thread may be waiting for it while preparing a reload
+    if (fileWatcher)
+    {
+        fileWatcher->stop();
+        log::info("Disabled hot reloading of resources");
+    }
+
+    const std::lock_guard<std::mutex> lock(this->m_reloadMutex);
+    this->m_pendingReloads.clear();
+}
+
+bool e2d::ResourceRegistry::isHotReloadEnabled() const
+{
+    const std::shared_lock<std::shared_mutex> lock(this->m_mutex);
+    return this->m_fileWatcher != nullptr;
+}
+
+std::size_t e2d::ResourceRegistry::applyPendingReloads()
+{
+    std::unordered_map<std::string, std::function<bool()>> pendingReloads;
+    {
+        const std::lock_guard<std::mutex> lock(this->m_reloadMutex);
+        if (this->m_pendingReloads.empty())
+        {
+            return 0;
+        }
+        pendingReloads.swap(this->m_pendingReloads);
+    }
+
+    std::size_t reloaded = 0;
+    for (const auto& [identifier, reload] : pendingReloads)
+    {
+        if (reload())
+        {
+            log::info("Reloaded resource with identifier '{}'", identifier);
+            ++reloaded;
+        }
+        else
+        {
+            log::error("Failed to reload resource with identifier '{}', keeping its previous contents", identifier);
+        }
+    }
+    return reloaded;
+}
+
+bool e2d::ResourceRegistry::insert(const std::string&         identifier,
+                                   std::unique_ptr<IResource> resource,
+                                   std::size_t                memorySize)
+{
+    const std::string filepath = resource->getFilepath();
+
+    std::uintmax_t size = memorySize;
+    if (!filepath.empty())
+    {
+        std::error_code error;
+        size = std::filesystem::file_size(filepath, error);
+        if (error)
+        {
+            size = 0;
+        }
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> lock(this->m_mutex);
+
+        if (this->m_fileWatcher && !filepath.empty())
+        {
+            this->m_fileWatcher->watch(filepath);
+        }
+
+        if (!this->m_resources.emplace(identifier, std::move(resource)).second)
+        {
+            log::warn("Discarding resource with identifier '{}' since it was loaded concurrently", identifier);
+            return false;
+        }
+    }
+
+    const auto& metrics = internal::EngineMetrics::getInstance();
+    metrics.resourcesLoaded.increment();
+    metrics.bytesLoaded.increment(size);
+    return true;
+}
+
+void e2d::ResourceRegistry::prepareReload(const std::string& filepath)
+{
+    std::vector<std::pair<std::string, std::shared_ptr<Resource>>> resources;
+    {
+        const std::shared_lock<std::shared_mutex> lock(this->m_mutex);
+        for (const auto& [identifier, resource] : this->m_resources)
+        {
+            if (resource->getFilepath() == filepath)
+            {
+                resources.emplace_back(identifier, resource->getResource());
+            }
+        }
+    }
+
+    for (const auto& [identifier, resource] : resources)
+    {
+        auto reload = resource->prepareFromFile(filepath);
+        if (!reload)
+        {
+            log::error("Failed to reload resource with identifier '{}' from file '{}'", identifier, filepath);
+            continue;
+        }
+
+        // A newer change of the same file supersedes a reload that has not been applied yet
+        const std::lock_guard<std::mutex> lock(this->m_reloadMutex);
+        this->m_pendingReloads[identifier] = std::move(reload);
+    }
+}
+
+bool e2d::ResourceRegistry::loadManifest(std::istream&           stream,
+                                         const std::string&      source,
+                                         const ProgressCallback& progress)
+{
+    struct Entry
+    {
+        std::string                type;       //!< The manifest type name of the resource.
+        std::string                identifier; //!< The identifier to register the resource with.
+        std::string                filepath;   //!< The path of the resource file.
+        std::unique_ptr<IResource> resource;   //!< The resource being loaded.
+        std::function<bool()>      complete;   //!< Completes the prepared load, empty if preparing failed.
+    };
+
+    // Parse the manifest and skip duplicates, without loading anything yet
+    std::vector<Entry>                                                   entries;
+    std::unordered_map<std::string, std::pair<std::string, std::string>> seen;
+    {
+        const std::shared_lock<std::shared_mutex> lock(this->m_mutex);
+
+        std::string line;
+        for (std::size_t lineNumber = 1; std::getline(stream, line); ++lineNumber)
+        {
+            std::istringstream lineStream(line);
+
+            Entry entry;
+            if (!(lineStream >> entry.type) || entry.type.front() == '#')
+            {
+                continue;
+            }
+            if (!(lineStream >> entry.identifier) || !std::getline(lineStream >> std::ws, entry.filepath))
+            {
+                log::error("Failed to load resource manifest '{}': malformed entry on line {}", source, lineNumber);
+                return false;
+            }
+
+            const auto factory = this->m_manifestTypes.find(entry.type);
+            if (factory == this->m_manifestTypes.end())
+            {
+                log::error("Failed to load resource manifest '{}': unknown type '{}' on line {}",
+                           source,
+                           entry.type,
+                           lineNumber);
+                return false;
+            }
+
+            if (const auto duplicate = seen.find(entry.identifier); duplicate != seen.end())
+            {
+                if (duplicate->second != std::make_pair(entry.type, entry.filepath))
+                {
+                    log::error("Failed to load resource manifest '{}': identifier '{}' on line {} is already in use",
+                               source,
+                               entry.identifier,
+                               lineNumber);
+                    return false;
+                }
+                continue;
+            }
+            seen.emplace(entry.identifier, std::make_pair(entry.type, entry.filepath));
+
+            if (this->m_resources.count(entry.identifier) != 0)
+            {
+                log::debug("Skipping resource '{}' of manifest '{}' since it is already loaded",
+                           entry.identifier,
+                           source);
+                continue;
+            }
+
+            entry.resource = factory->second(entry.identifier);
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    // Reading the files in path order keeps the disk access as sequential as possible
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const Entry& lhs, const Entry& rhs) { return lhs.filepath < rhs.filepath; });
+
+    const auto total = entries.size();
+    log::info("Loading {} resources from manifest '{}'", total, source);
+
+    std::mutex               readyMutex;
+    std::condition_variable  readyCondition;
+    std::queue<std::size_t>  ready;
+    std::atomic<std::size_t> next{0};
+
+    const auto workerCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), total);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (std::size_t worker = 0; worker < workerCount; ++worker)
+    {
+        workers.emplace_back(
+            [&entries, &readyMutex, &readyCondition, &ready, &next, total]()
+            {
+                for (auto index = next++; index < total; index = next++)
+                {
+                    auto& entry    = entries[index];
+                    entry.complete = entry.resource->getResource()->prepareFromFile(entry.filepath);
+
+                    const std::lock_guard<std::mutex> lock(readyMutex);
+                    ready.push(index);
+                    readyCondition.notify_one();
+                }
+            });
+    }
+
+    // Complete the resources on this thread in the order they become ready
+    bool succeeded = true;
+    for (std::size_t loaded = 1; loaded <= total; ++loaded)
+    {
+        std::size_t index = 0;
+        {
+            std::unique_lock<std::mutex> lock(readyMutex);
+            readyCondition.wait(lock, [&ready]() { return !ready.empty(); });
+            index = ready.front();
+            ready.pop();
+        }
+
+        auto& entry = entries[index];
+        if (entry.complete && entry.complete())
+        {
+            entry.resource->setFilepath(entry.filepath);
+            succeeded = this->insert(entry.identifier, std::move(entry.resource)) && succeeded;
+        }
+        else
+        {
+            log::error("Failed to load resource with identifier '{}' from file '{}'", entry.identifier, entry.filepath);
+            succeeded = false;
+        }
+        entry.complete = nullptr;
+
+        if (progress)
+        {
+            progress(loaded, total);
+        }
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    return succeeded;
+}
+
 e2d::ResourceRegistry::IResource::IResource(std::string type, std::string identifier) :
 m_type(std::move(type)),
 m_identifier(std::move(identifier))
@@ -68,3 +424,13 @@ const std::string& e2d::ResourceRegistry::IResource::getIdentifier() const
 {
     return this->m_identifier;
 }
+
+const std::string& e2d::ResourceRegistry::IResource::getFilepath() const
+{
+    return this->m_filepath;
+}
+
+void e2d::ResourceRegistry::IResource::setFilepath(const std::string& filepath)
+{
+    this->m_filepath = filepath;
+}
@@ -85,3 +85,12 @@ SDL_RendererFlip e2d::internal::toSDLRendererFlip(const e2d::Vector2f& scale)
     }
     return flip;
 }
+
+void e2d::internal::extendSDLQuadIndices(std::vector<int>& indices, std::size_t quadCount)
+{
+    for (auto quad = indices.size() / 6; quad < quadCount; ++quad)
+    {
+        const auto first = static_cast<int>(quad * 4);
+        indices.insert(indices.end(), {first, first + 1, first + 2, first + 2, first + 3, first});
+    }
+}
@@ -33,6 +33,9 @@
 
 #include <SDL.h>
 
+#include <cstddef>
+#include <vector>
+
 namespace e2d::internal
 {
 
@@ -100,6 +103,19 @@ E2D_ENGINE_API SDL_Point
  */
 E2D_ENGINE_API SDL_RendererFlip toSDLRendererFlip(const e2d::Vector2f& scale);
 
+/**
+ * @ingroup engine
+ * @brief @internal Extends the indices of a geometry draw to cover a number of quads.
+ *
+ * Each quad is drawn as two triangles from four consecutive vertices, in the order top left, top right,
+ * bottom right and bottom left. The indices only depend on the number of quads, so they can be kept
+ * between frames and only extended when more quads are drawn than before.
+ *
+ * @param indices The indices to extend, covering a whole number of quads.
+ * @param quadCount The number of quads the indices must cover at least.
+ */
+E2D_ENGINE_API void extendSDLQuadIndices(std::vector<int>& indices, std::size_t quadCount);
+
 } // namespace e2d::internal
 
 #endif //E2D_ENGINE_SDL_RENDER_UTILS_HPP
@@ -26,13 +26,18 @@
 
 #include <E2D/Core/Logger.hpp>
 
+#include <E2D/Engine/EngineMetrics.hpp>
 #include <E2D/Engine/Event.hpp>
 #include <E2D/Engine/ObjectRegistry.hpp>
 #include <E2D/Engine/Renderable.hpp>
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderLayer.hpp>
 #include <E2D/Engine/Scene.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 std::atomic<std::uint64_t> e2d::Scene::s_counter{1};
 std::mutex                 e2d::Scene::s_counterMutex;
 
@@ -103,6 +108,60 @@ void e2d::Scene::resume()
     }
 }
 
+bool e2d::Scene::removeObject(const std::string& identifier)
+{
+    return this->m_objectRegistry->removeObject(identifier);
+}
+
+void e2d::Scene::submit(const e2d::RenderCommandBuffer& buffer) const
+{
+    internal::RendererContext::getInstance().getRenderer().submit(buffer);
+}
+
+e2d::RenderLayer& e2d::Scene::createLayer(const std::string& name, int renderPriority)
+{
+    if (this->hasLayer(name))
+    {
+        throw std::runtime_error("The layer `" + name + "` already exists.");
+    }
+
+    auto& layer = *this->m_layers.emplace_back(std::make_unique<RenderLayer>(name));
+    layer.setRenderPriority(renderPriority);
+    return layer;
+}
+
+bool e2d::Scene::hasLayer(const std::string& name) const
+{
+    return std::any_of(this->m_layers.begin(),
+                       this->m_layers.end(),
+                       [&name](const auto& layer) { return layer->getName() == name; });
+}
+
+e2d::RenderLayer& e2d::Scene::getLayer(const std::string& name) const
+{
+    for (const auto& layer : this->m_layers)
+    {
+        if (layer->getName() == name)
+        {
+            return *layer;
+        }
+    }
+    throw std::runtime_error("The layer `" + name + "` does not exist.");
+}
+
+bool e2d::Scene::removeLayer(const std::string& name)
+{
+    const auto it = std::find_if(this->m_layers.begin(),
+                                 this->m_layers.end(),
+                                 [&name](const auto& layer) { return layer->getName() == name; });
+    if (it == this->m_layers.end())
+    {
+        return false;
+    }
+    this->m_layers.erase(it);
+    return true;
+}
+
 bool e2d::Scene::isLoaded() const
 {
     return this->m_loaded;
@@ -115,6 +174,8 @@ bool e2d::Scene::isPaused() const
 
 void e2d::Scene::handleEvent(const e2d::Event& event)
 {
+    internal::EngineMetrics::getInstance().eventsDispatched.increment();
+
     if (event.is<e2d::Event::LostFocus>())
     {
         this->pause();
@@ -151,9 +212,18 @@ void e2d::Scene::variableUpdate(double deltaTime)
 
 void e2d::Scene::draw()
 {
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
     for (const auto& entity : this->m_objectRegistry->getAllObjectsOfType<Renderable>())
     {
-        internal::RendererContext::getInstance().getRenderer().draw(entity);
+        // Renderables in a layer are drawn by the layer
+        if (entity->getLayer() == nullptr)
+        {
+            renderer.draw(entity);
+        }
+    }
+    for (const auto& layer : this->m_layers)
+    {
+        renderer.draw(layer.get());
     }
 }
 
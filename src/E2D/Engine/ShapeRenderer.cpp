@@ -0,0 +1,230 @@
+/**
+ * @file ShapeRenderer.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/ShapeRenderer.hpp>
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+const float pi = 3.14159265358979f;
+
+SDL_Vertex makeVertex(const e2d::Vector2f& position, const SDL_Color& color)
+{
+    return {{position.x, position.y}, color, {0, 0}};
+}
+
+std::vector<e2d::Vector2f> makeCorners(const e2d::FloatRect& rectangle)
+{
+    const auto right  = rectangle.left + rectangle.width;
+    const auto bottom = rectangle.top + rectangle.height;
+    return {{rectangle.left, rectangle.top}, {right, rectangle.top}, {right, bottom}, {rectangle.left, bottom}};
+}
+} // namespace
+
+e2d::ShapeRenderer::ShapeRenderer() : m_geometry(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing ShapeRenderer");
+}
+
+e2d::ShapeRenderer::ShapeRenderer(const std::string& identifier) :
+e2d::Object(identifier),
+m_geometry(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing ShapeRenderer with identifier '{}'", identifier);
+}
+
+e2d::ShapeRenderer::~ShapeRenderer()
+{
+    log::debug("Destructing ShapeRenderer");
+}
+
+void e2d::ShapeRenderer::setLineThickness(float thickness)
+{
+    this->m_lineThickness = std::max(thickness, 0.f);
+}
+
+float e2d::ShapeRenderer::getLineThickness() const
+{
+    return this->m_lineThickness;
+}
+
+void e2d::ShapeRenderer::drawLine(const Vector2f& from, const Vector2f& to, const Color& color)
+{
+    const auto delta  = to - from;
+    const auto length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+    if (length == 0 || this->m_lineThickness == 0)
+    {
+        return;
+    }
+
+    // Extends the line by half its thickness at both ends, so that the lines of an outline meet at the corners
+    const auto half      = this->m_lineThickness / 2;
+    const auto direction = delta / length * half;
+    const auto normal    = Vector2f(-direction.y, direction.x);
+    const auto start     = from - direction;
+    const auto end       = to + direction;
+
+    auto&           geometry = *this->m_geometry;
+    const int       first    = static_cast<int>(geometry.vertices.size());
+    const SDL_Color vertexColor{color.r, color.g, color.b, color.a};
+    geometry.vertices.insert(geometry.vertices.end(),
+                             {makeVertex(start + normal, vertexColor),
+                              makeVertex(end + normal, vertexColor),
+                              makeVertex(end - normal, vertexColor),
+                              makeVertex(start - normal, vertexColor)});
+    geometry.indices.insert(geometry.indices.end(), {first, first + 1, first + 2, first + 2, first + 3, first});
+    this->invalidateLayer();
+}
+
+void e2d::ShapeRenderer::drawRect(const FloatRect& rectangle, const Color& color)
+{
+    this->appendOutline(makeCorners(rectangle), color);
+}
+
+void e2d::ShapeRenderer::fillRect(const FloatRect& rectangle, const Color& color)
+{
+    this->appendFan(makeCorners(rectangle), color);
+}
+
+void e2d::ShapeRenderer::drawCircle(const Vector2f& center, float radius, const Color& color)
+{
+    this->appendOutline(makeCircle(center, radius), color);
+}
+
+void e2d::ShapeRenderer::fillCircle(const Vector2f& center, float radius, const Color& color)
+{
+    this->appendFan(makeCircle(center, radius), color);
+}
+
+void e2d::ShapeRenderer::drawPolygon(const std::vector<Vector2f>& points, const Color& color)
+{
+    this->appendOutline(points, color);
+}
+
+void e2d::ShapeRenderer::fillPolygon(const std::vector<Vector2f>& points, const Color& color)
+{
+    this->appendFan(points, color);
+}
+
+void e2d::ShapeRenderer::clear()
+{
+    this->m_geometry->vertices.clear();
+    this->m_geometry->indices.clear();
+    this->invalidateLayer();
+}
+
+bool e2d::ShapeRenderer::isEmpty() const
+{
+    return this->m_geometry->indices.empty();
+}
+
+void e2d::ShapeRenderer::onFixedUpdate()
+{
+}
+
+void e2d::ShapeRenderer::onVariableUpdate(double deltaTime)
+{
+    (void)deltaTime;
+}
+
+void e2d::ShapeRenderer::render() const
+{
+    auto& geometry = *this->m_geometry;
+    if (geometry.indices.empty())
+    {
+        return;
+    }
+
+    internal::RenderCommand command;
+    command.priority    = this->getRenderPriority();
+    command.vertexCount = geometry.vertices.size();
+    command.indexCount  = geometry.indices.size();
+    geometry.commands.assign(1, command);
+
+    internal::RendererContext::getInstance().getRenderer().submit(geometry);
+
+    // The renderer has drawn or copied the shapes, so they can be drawn anew for the next frame
+    geometry.vertices.clear();
+    geometry.indices.clear();
+}
+
+void e2d::ShapeRenderer::appendOutline(const std::vector<Vector2f>& points, const Color& color)
+{
+    if (points.size() < 2)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        this->drawLine(points[i], points[(i + 1) % points.size()], color);
+    }
+}
+
+void e2d::ShapeRenderer::appendFan(const std::vector<Vector2f>& points, const Color& color)
+{
+    if (points.size() < 3)
+    {
+        return;
+    }
+
+    auto&           geometry = *this->m_geometry;
+    const int       first    = static_cast<int>(geometry.vertices.size());
+    const SDL_Color vertexColor{color.r, color.g, color.b, color.a};
+    for (const auto& point : points)
+    {
+        geometry.vertices.push_back(makeVertex(point, vertexColor));
+    }
+    for (int i = 1; i + 1 < static_cast<int>(points.size()); ++i)
+    {
+        geometry.indices.insert(geometry.indices.end(), {first, first + i, first + i + 1});
+    }
+    this->invalidateLayer();
+}
+
+std::vector<e2d::Vector2f> e2d::ShapeRenderer::makeCircle(const Vector2f& center, float radius)
+{
+    // About one corner every 4 pixels along the circle keeps it round at any size
+    const auto corners = std::clamp(static_cast<int>(2 * pi * radius / 4), 12, 128);
+
+    std::vector<Vector2f> points;
+    points.reserve(static_cast<std::size_t>(corners));
+    for (int i = 0; i < corners; ++i)
+    {
+        const auto angle = 2 * pi * static_cast<float>(i) / static_cast<float>(corners);
+        points.emplace_back(center.x + std::cos(angle) * radius, center.y + std::sin(angle) * radius);
+    }
+    return points;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file SkylinePacker.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/SkylinePacker.hpp>
+
+#include <algorithm>
+#include <limits>
+
+e2d::internal::SkylinePacker::SkylinePacker(const e2d::Vector2i& size) : m_size(size)
+{
+    log::debug("Constructing SkylinePacker");
+    this->clear();
+}
+
+e2d::internal::SkylinePacker::~SkylinePacker()
+{
+    log::debug("Destructing SkylinePacker");
+}
+
+std::optional<e2d::IntRect> e2d::internal::SkylinePacker::insert(const e2d::Vector2i& size)
+{
+    if (size.x <= 0 || size.y <= 0)
+    {
+        return std::nullopt;
+    }
+
+    auto bestIndex = this->m_skyline.size();
+    auto bestTop   = std::numeric_limits<int>::max();
+    auto bestWidth = std::numeric_limits<int>::max();
+    auto bestY     = 0;
+
+    for (std::size_t index = 0; index < this->m_skyline.size(); ++index)
+    {
+        const auto y = this->fit(index, size);
+        if (!y)
+        {
+            continue;
+        }
+
+        // Prefer the lowest top edge, then the narrowest segment to keep wide gaps for wide rectangles
+        const auto top = *y + size.y;
+        if (top < bestTop || (top == bestTop && this->m_skyline[index].width < bestWidth))
+        {
+            bestIndex = index;
+            bestTop   = top;
+            bestWidth = this->m_skyline[index].width;
+            bestY     = *y;
+        }
+    }
+
+    if (bestIndex == this->m_skyline.size())
+    {
+        return std::nullopt;
+    }
+
+    const IntRect rectangle({this->m_skyline[bestIndex].x, bestY}, size);
+    this->addLevel(bestIndex, rectangle);
+
+    this->m_usedSize.x = std::max(this->m_usedSize.x, rectangle.left + rectangle.width);
+    this->m_usedSize.y = std::max(this->m_usedSize.y, rectangle.top + rectangle.height);
+
+    return rectangle;
+}
+
+void e2d::internal::SkylinePacker::clear()
+{
+    this->m_skyline.clear();
+    this->m_skyline.push_back({0, 0, this->m_size.x});
+    this->m_usedSize = {0, 0};
+}
+
+const e2d::Vector2i& e2d::internal::SkylinePacker::getSize() const
+{
+    return this->m_size;
+}
+
+const e2d::Vector2i& e2d::internal::SkylinePacker::getUsedSize() const
+{
+    return this->m_usedSize;
+}
+
+std::optional<int> e2d::internal::SkylinePacker::fit(std::size_t index, const e2d::Vector2i& size) const
+{
+    if (this->m_skyline[index].x + size.x > this->m_size.x)
+    {
+        return std::nullopt;
+    }
+
+    auto y         = this->m_skyline[index].y;
+    auto widthLeft = size.x;
+    while (widthLeft > 0)
+    {
+        if (index == this->m_skyline.size())
+        {
+            return std::nullopt;
+        }
+
+        y = std::max(y, this->m_skyline[index].y);
+        if (y + size.y > this->m_size.y)
+        {
+            return std::nullopt;
+        }
+
+        widthLeft -= this->m_skyline[index].width;
+        ++index;
+    }
+    return y;
+}
+
+void e2d::internal::SkylinePacker::addLevel(std::size_t index, const e2d::IntRect& rectangle)
+{
+    const auto insertAt = this->m_skyline.begin() + static_cast<std::ptrdiff_t>(index);
+    this->m_skyline.insert(insertAt, {rectangle.left, rectangle.top + rectangle.height, rectangle.width});
+
+    // Shrink or remove the segments now covered by the new one
+    for (auto next = index + 1; next < this->m_skyline.size();)
+    {
+        const auto& previous = this->m_skyline[next - 1];
+        auto&       current  = this->m_skyline[next];
+
+        const auto overlap = previous.x + previous.width - current.x;
+        if (overlap <= 0)
+        {
+            break;
+        }
+
+        current.x += overlap;
+        current.width -= overlap;
+        if (current.width > 0)
+        {
+            break;
+        }
+        this->m_skyline.erase(this->m_skyline.begin() + static_cast<std::ptrdiff_t>(next));
+    }
+
+    // Merge neighbouring segments at the same height
+    for (std::size_t current = 0; current + 1 < this->m_skyline.size();)
+    {
+        if (this->m_skyline[current].y == this->m_skyline[current + 1].y)
+        {
+            this->m_skyline[current].width += this->m_skyline[current + 1].width;
+            this->m_skyline.erase(this->m_skyline.begin() + static_cast<std::ptrdiff_t>(current + 1));
+        }
+        else
+        {
+            ++current;
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * @file SkylinePacker.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_SKYLINE_PACKER_HPP
+#define E2D_ENGINE_SKYLINE_PACKER_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+#include <E2D/Core/Rect.hpp>
+#include <E2D/Core/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace e2d::internal
+{
+
+/**
+ * @class SkylinePacker
+ * @ingroup engine
+ * @brief @internal Packs rectangles into a fixed size bin using the skyline bottom-left heuristic.
+ *
+ * The packer keeps track of the upper contour (the skyline) of everything placed so far and puts
+ * each new rectangle at the position along the skyline where its top edge ends up lowest. It is
+ * used by TextureAtlas to lay out images on atlas pages, but has no knowledge of textures itself.
+ */
+class E2D_ENGINE_API SkylinePacker final : NonCopyable
+{
+public:
+    /**
+     * @brief Constructs a new SkylinePacker object.
+     *
+     * Initializes an empty bin with the specified dimensions.
+     *
+     * @param size The width and height of the bin.
+     */
+    explicit SkylinePacker(const Vector2i& size);
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~SkylinePacker();
+
+    /**
+     * @brief Inserts a rectangle into the bin.
+     *
+     * Finds the lowest position along the skyline where a rectangle of the specified size fits
+     * and reserves it. Rectangles are never rotated.
+     *
+     * @param size The width and height of the rectangle to insert.
+     * @return The area reserved for the rectangle, or an empty optional if it does not fit.
+     */
+    std::optional<IntRect> insert(const Vector2i& size);
+
+    /**
+     * @brief Removes all rectangles from the bin.
+     *
+     * Resets the skyline to the bottom of the bin, making the full area available again.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the size of the bin.
+     *
+     * @return The width and height of the bin.
+     */
+    const Vector2i& getSize() const;
+
+    /**
+     * @brief Retrieves the size of the area actually occupied by inserted rectangles.
+     *
+     * This is the smallest size, anchored at the top left corner of the bin,
+     * that contains every rectangle inserted so far.
+     *
+     * @return The width and height of the used area.
+     */
+    const Vector2i& getUsedSize() const;
+
+private:
+    /**
+     * @struct Node
+     * @brief A horizontal segment of the skyline.
+     */
+    struct Node
+    {
+        int x;     //!< The left coordinate of the segment.
+        int y;     //!< The height of the skyline along the segment.
+        int width; //!< The width of the segment.
+    };
+
+    /**
+     * @brief Checks whether a rectangle fits with its left edge at the start of a skyline segment.
+     *
+     * @param index The index of the skyline segment.
+     * @param size The width and height of the rectangle.
+     * @return The top coordinate the rectangle would be placed at, or an empty optional if it does not fit.
+     */
+    std::optional<int> fit(std::size_t index, const Vector2i& size) const;
+
+    /**
+     * @brief Raises the skyline to cover a newly placed rectangle.
+     *
+     * @param index The index of the skyline segment the rectangle was placed at.
+     * @param rectangle The area occupied by the rectangle.
+     */
+    void addLevel(std::size_t index, const IntRect& rectangle);
+
+    Vector2i          m_size;     //!< The width and height of the bin.
+    Vector2i          m_usedSize; //!< The size of the area occupied by inserted rectangles.
+    std::vector<Node> m_skyline;  //!< The skyline segments, ordered from left to right.
+
+}; // class SkylinePacker
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_SKYLINE_PACKER_HPP
@@ -28,6 +28,7 @@
 
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
 #include <E2D/Engine/SDLRenderUtils.hpp>
 #include <E2D/Engine/Sprite.hpp>
 #include <E2D/Engine/Texture.hpp>
@@ -56,7 +57,17 @@ std::shared_ptr<const e2d::Texture> e2d::Sprite::getTexture() const
 
 void e2d::Sprite::setTexture(const std::shared_ptr<const Texture>& texture)
 {
-    this->m_texture = texture;
+    this->m_texture       = texture;
+    this->m_textureOffset = {0, 0};
+    this->invalidateLayer();
+}
+
+void e2d::Sprite::setTexture(const e2d::TextureRegion& region)
+{
+    this->m_texture       = region.texture;
+    this->m_textureOffset = region.rect.getPosition();
+    this->m_textureRect   = IntRect({0, 0}, region.rect.getSize());
+    this->invalidateLayer();
 }
 
 const e2d::IntRect& e2d::Sprite::getTextureRect() const
@@ -67,6 +78,7 @@ const e2d::IntRect& e2d::Sprite::getTextureRect() const
 void e2d::Sprite::setTextureRect(const e2d::IntRect& rectangle)
 {
     this->m_textureRect = rectangle;
+    this->invalidateLayer();
 }
 
 e2d::Vector2f e2d::Sprite::getSize() const
@@ -85,26 +97,44 @@ void e2d::Sprite::onVariableUpdate(double deltaTime)
 
 void e2d::Sprite::render() const
 {
-    if (this->m_texture)
+    internal::RenderCommand command;
+    if (this->makeRenderCommand(command))
     {
-        const auto sourceRectangle = internal::toSDLRect(this->m_textureRect);
-
-        const auto destinationRectangle = internal::calculateSDLDestinationRect(this->m_textureRect,
-                                                                                this->getPosition(),
-                                                                                this->getOrigin(),
-                                                                                this->getScale());
-
-        const auto destinationSize = Vector2i{destinationRectangle.w, destinationRectangle.h};
-        const auto rotationPoint = internal::calculateSDLRotationPoint(destinationSize, this->getOrigin(), this->getScale());
+        internal::RendererContext::getInstance().getRenderer().submit(command);
+    }
+}
 
-        const auto flip = internal::toSDLRendererFlip(this->getScale());
+unsigned int e2d::Sprite::getContentRevision() const
+{
+    return this->m_texture ? this->m_texture->getRevision() : 0;
+}
 
-        SDL_RenderCopyEx(internal::RendererContext::getInstance().getRenderer().getNativeRenderer(),
-                         static_cast<SDL_Texture*>(this->m_texture->getNativeTextureHandle()),
-                         &sourceRectangle,
-                         &destinationRectangle,
-                         this->getRotation(),
-                         &rotationPoint,
-                         flip);
+bool e2d::Sprite::makeRenderCommand(internal::RenderCommand& command) const
+{
+    if (!this->m_texture)
+    {
+        return false;
     }
+
+    const auto sourceRectangle = internal::toSDLRect(
+        IntRect(this->m_textureRect.getPosition() + this->m_textureOffset, this->m_textureRect.getSize()));
+
+    const auto destinationRectangle = internal::calculateSDLDestinationRect(this->m_textureRect,
+                                                                            this->getPosition(),
+                                                                            this->getOrigin(),
+                                                                            this->getScale());
+
+    const auto destinationSize = Vector2i{destinationRectangle.w, destinationRectangle.h};
+    const auto rotationPoint = internal::calculateSDLRotationPoint(destinationSize, this->getOrigin(), this->getScale());
+
+    command.texture     = static_cast<SDL_Texture*>(this->m_texture->getNativeTextureHandle());
+    command.revision    = this->m_texture->getRevision();
+    command.source      = sourceRectangle;
+    command.hasSource   = true;
+    command.destination = destinationRectangle;
+    command.angle       = this->getRotation();
+    command.center      = rotationPoint;
+    command.flip        = internal::toSDLRendererFlip(this->getScale());
+    command.priority    = this->getRenderPriority();
+    return true;
 }
@@ -0,0 +1,245 @@
+/**
+ * @file SpriteBatch.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/SDLRenderUtils.hpp>
+#include <E2D/Engine/SpriteBatch.hpp>
+#include <E2D/Engine/Texture.hpp>
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+const float pi = 3.14159265358979f;
+} // namespace
+
+e2d::SpriteBatch::SpriteBatch() : m_geometry(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing SpriteBatch");
+}
+
+e2d::SpriteBatch::SpriteBatch(const std::string& identifier) :
+e2d::Object(identifier),
+m_geometry(std::make_unique<internal::RenderSnapshot>())
+{
+    log::debug("Constructing SpriteBatch with identifier '{}'", identifier);
+}
+
+e2d::SpriteBatch::~SpriteBatch()
+{
+    log::debug("Destructing SpriteBatch");
+}
+
+void e2d::SpriteBatch::setTexture(const std::shared_ptr<const Texture>& texture)
+{
+    this->m_texture       = texture;
+    this->m_textureOffset = {};
+    this->invalidateLayer();
+}
+
+void e2d::SpriteBatch::setTexture(const TextureRegion& region)
+{
+    this->m_texture       = region.texture;
+    this->m_textureOffset = region.rect.getPosition();
+    this->invalidateLayer();
+}
+
+std::shared_ptr<const e2d::Texture> e2d::SpriteBatch::getTexture() const
+{
+    return this->m_texture;
+}
+
+std::size_t e2d::SpriteBatch::add(const SpriteInstance& instance)
+{
+    this->m_instances.push_back(instance);
+    this->invalidateLayer();
+    return this->m_instances.size() - 1;
+}
+
+void e2d::SpriteBatch::remove(std::size_t index)
+{
+    if (index >= this->m_instances.size())
+    {
+        throw std::runtime_error("The instance `" + std::to_string(index) + "` does not exist.");
+    }
+
+    // Order only matters for overlapping instances, so the last instance fills the gap instead of shifting the rest
+    this->m_instances[index] = this->m_instances.back();
+    this->m_instances.pop_back();
+    this->invalidateLayer();
+}
+
+void e2d::SpriteBatch::clear()
+{
+    this->m_instances.clear();
+    this->invalidateLayer();
+}
+
+void e2d::SpriteBatch::reserve(std::size_t capacity)
+{
+    this->m_instances.reserve(capacity);
+}
+
+void e2d::SpriteBatch::setInstance(std::size_t index, const SpriteInstance& instance)
+{
+    if (index >= this->m_instances.size())
+    {
+        throw std::runtime_error("The instance `" + std::to_string(index) + "` does not exist.");
+    }
+    this->m_instances[index] = instance;
+    this->invalidateLayer();
+}
+
+const e2d::SpriteInstance& e2d::SpriteBatch::getInstance(std::size_t index) const
+{
+    if (index >= this->m_instances.size())
+    {
+        throw std::runtime_error("The instance `" + std::to_string(index) + "` does not exist.");
+    }
+    return this->m_instances[index];
+}
+
+const std::vector<e2d::SpriteInstance>& e2d::SpriteBatch::getInstances() const
+{
+    return this->m_instances;
+}
+
+std::size_t e2d::SpriteBatch::getCount() const
+{
+    return this->m_instances.size();
+}
+
+void e2d::SpriteBatch::onFixedUpdate()
+{
+}
+
+void e2d::SpriteBatch::onVariableUpdate(double deltaTime)
+{
+    (void)deltaTime;
+}
+
+void e2d::SpriteBatch::render() const
+{
+    if (!this->m_texture || this->m_instances.empty() || this->m_texture->getSize().x <= 0 ||
+        this->m_texture->getSize().y <= 0)
+    {
+        return;
+    }
+
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
+
+    const Vector2i targetSize   = renderer.getTargetSize();
+    const auto     targetWidth  = static_cast<float>(targetSize.x);
+    const auto     targetHeight = static_cast<float>(targetSize.y);
+
+    const auto textureWidth  = static_cast<float>(this->m_texture->getSize().x);
+    const auto textureHeight = static_cast<float>(this->m_texture->getSize().y);
+    const auto offset        = Vector2f(this->m_textureOffset);
+
+    auto& geometry = *this->m_geometry;
+    geometry.vertices.resize(this->m_instances.size() * 4);
+
+    auto*       vertex = geometry.vertices.data();
+    std::size_t drawn  = 0;
+    for (const auto& instance : this->m_instances)
+    {
+        const auto rect = FloatRect(instance.textureRect);
+
+        // The corners relative to the position, before rotating
+        const float left   = -instance.origin.x * instance.scale.x;
+        const float top    = -instance.origin.y * instance.scale.y;
+        const float right  = (rect.width - instance.origin.x) * instance.scale.x;
+        const float bottom = (rect.height - instance.origin.y) * instance.scale.y;
+
+        float cosine = 1;
+        float sine   = 0;
+        if (instance.rotation != 0)
+        {
+            cosine = std::cos(instance.rotation * pi / 180);
+            sine   = std::sin(instance.rotation * pi / 180);
+        }
+
+        const auto transform = [&instance, cosine, sine](float x, float y)
+        {
+            return SDL_FPoint{instance.position.x + x * cosine - y * sine,
+                              instance.position.y + x * sine + y * cosine};
+        };
+
+        const SDL_FPoint corners[4] = {transform(left, top),
+                                       transform(right, top),
+                                       transform(right, bottom),
+                                       transform(left, bottom)};
+
+        const auto [minX, maxX] = std::minmax({corners[0].x, corners[1].x, corners[2].x, corners[3].x});
+        const auto [minY, maxY] = std::minmax({corners[0].y, corners[1].y, corners[2].y, corners[3].y});
+        if (maxX < 0 || maxY < 0 || minX > targetWidth || minY > targetHeight)
+        {
+            continue;
+        }
+
+        const float     u0 = (offset.x + rect.left) / textureWidth;
+        const float     v0 = (offset.y + rect.top) / textureHeight;
+        const float     u1 = (offset.x + rect.left + rect.width) / textureWidth;
+        const float     v1 = (offset.y + rect.top + rect.height) / textureHeight;
+        const SDL_Color color{instance.color.r, instance.color.g, instance.color.b, instance.color.a};
+
+        vertex[0] = {corners[0], color, {u0, v0}};
+        vertex[1] = {corners[1], color, {u1, v0}};
+        vertex[2] = {corners[2], color, {u1, v1}};
+        vertex[3] = {corners[3], color, {u0, v1}};
+        vertex += 4;
+        ++drawn;
+    }
+
+    if (drawn == 0)
+    {
+        return;
+    }
+    internal::extendSDLQuadIndices(geometry.indices, drawn);
+
+    internal::RenderCommand command;
+    command.texture     = static_cast<SDL_Texture*>(this->m_texture->getNativeTextureHandle());
+    command.revision    = this->m_texture->getRevision();
+    command.priority    = this->getRenderPriority();
+    command.vertexCount = drawn * 4;
+    command.indexCount  = drawn * 6;
+    geometry.commands.assign(1, command);
+
+    renderer.submit(geometry);
+}
+
+unsigned int e2d::SpriteBatch::getContentRevision() const
+{
+    return this->m_texture ? this->m_texture->getRevision() : 0;
+}
@@ -31,6 +31,7 @@
 #include <E2D/Engine/Font.hpp>
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
 #include <E2D/Engine/SDLRenderUtils.hpp>
 #include <E2D/Engine/Text.hpp>
 #include <E2D/Engine/TextImpl.hpp>
@@ -95,6 +96,10 @@ e2d::Vector2f e2d::Text::getSize() const
 
 void e2d::Text::onFixedUpdate()
 {
+    if (this->m_font && this->m_font->getRevision() != this->m_fontRevision)
+    {
+        this->updateNativeTexture();
+    }
 }
 
 void e2d::Text::onVariableUpdate(double deltaTime)
@@ -104,35 +109,52 @@ void e2d::Text::onVariableUpdate(double deltaTime)
 
 void e2d::Text::render() const
 {
-    auto* texture = this->m_textImpl->getTexture();
-    if (texture)
+    internal::RenderCommand command;
+    if (this->makeRenderCommand(command))
     {
-        const IntRect textureRectangle({0, 0}, this->m_textImpl->getSize());
-
-        const auto destinationRectangle = internal::calculateSDLDestinationRect(textureRectangle,
-                                                                                this->getPosition(),
-                                                                                this->getOrigin(),
-                                                                                this->getScale());
-
-        const auto rotationPoint = internal::calculateSDLRotationPoint(this->m_textImpl->getSize(),
-                                                                       this->getOrigin(),
-                                                                       this->getScale());
-
-        const auto flip = internal::toSDLRendererFlip(this->getScale());
-
-        SDL_RenderCopyEx(internal::RendererContext::getInstance().getRenderer().getNativeRenderer(),
-                         texture,
-                         nullptr,
-                         &destinationRectangle,
-                         this->getRotation(),
-                         &rotationPoint,
-                         flip);
+        internal::RendererContext::getInstance().getRenderer().submit(command);
     }
 }
 
+unsigned int e2d::Text::getContentRevision() const
+{
+    return this->m_textImpl->getRevision();
+}
+
 void e2d::Text::updateNativeTexture()
 {
     auto* renderer = internal::RendererContext::getInstance().getRenderer().getNativeRenderer();
     auto* font     = static_cast<TTF_Font*>(this->m_font->getNativeFontHandle(this->m_fontSize));
     this->m_textImpl->updateNativeTexture(renderer, font, this->m_string);
+    this->m_fontRevision = this->m_font->getRevision();
+    this->invalidateLayer();
+}
+
+bool e2d::Text::makeRenderCommand(internal::RenderCommand& command) const
+{
+    auto* texture = this->m_textImpl->getTexture();
+    if (!texture)
+    {
+        return false;
+    }
+
+    const IntRect textureRectangle({0, 0}, this->m_textImpl->getSize());
+
+    const auto destinationRectangle = internal::calculateSDLDestinationRect(textureRectangle,
+                                                                            this->getPosition(),
+                                                                            this->getOrigin(),
+                                                                            this->getScale());
+
+    const auto rotationPoint = internal::calculateSDLRotationPoint(this->m_textImpl->getSize(),
+                                                                   this->getOrigin(),
+                                                                   this->getScale());
+
+    command.texture     = texture;
+    command.revision    = this->m_textImpl->getRevision();
+    command.destination = destinationRectangle;
+    command.angle       = this->getRotation();
+    command.center      = rotationPoint;
+    command.flip        = internal::toSDLRendererFlip(this->getScale());
+    command.priority    = this->getRenderPriority();
+    return true;
 }
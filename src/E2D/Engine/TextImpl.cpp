@@ -59,7 +59,9 @@ void e2d::internal::TextImpl::updateNativeTexture(SDL_Renderer* renderer, TTF_Fo
     SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), SDL_Color{255, 255, 255, 255});
     if (surface)
     {
+        this->destroy();
         this->m_texture = SDL_CreateTextureFromSurface(renderer, surface);
+        ++this->m_revision;
 
         if (SDL_QueryTexture(this->m_texture, nullptr, nullptr, &this->m_textureSize.x, &this->m_textureSize.y) != 0)
         {
@@ -83,6 +85,11 @@ SDL_Texture* e2d::internal::TextImpl::getTexture() const
     return this->m_texture;
 }
 
+unsigned int e2d::internal::TextImpl::getRevision() const
+{
+    return this->m_revision;
+}
+
 void e2d::internal::TextImpl::destroy()
 {
     if (this->m_texture)
@@ -97,6 +97,16 @@ public:
      */
     SDL_Texture* getTexture() const;
 
+    /**
+     * @brief Retrieves the revision of the texture.
+     *
+     * The revision is incremented every time a text is uploaded, as the new texture can be created
+     * at the address of the one it replaces.
+     *
+     * @return The revision of the texture.
+     */
+    unsigned int getRevision() const;
+
     /**
      * @brief Destroys the texture, freeing associated resources.
      *
@@ -107,6 +117,7 @@ public:
 private:
     SDL_Texture*  m_texture{nullptr}; //!< Pointer to the underlying SDL_Texture object.
     e2d::Vector2i m_textureSize;      //!< Stores the dimensions of the SDL_Texture object.
+    unsigned int  m_revision{0};      //!< Incremented every time a text is uploaded.
 
 }; // TextImpl class
 
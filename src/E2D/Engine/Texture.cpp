@@ -28,6 +28,7 @@
 
 #include <E2D/Engine/Application.hpp>
 #include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
 #include <E2D/Engine/Texture.hpp>
 #include <E2D/Engine/TextureImpl.hpp>
 
@@ -45,12 +46,44 @@ e2d::Texture::~Texture()
 
 bool e2d::Texture::loadFromFile(const std::string& filepath)
 {
-    return this->m_textureImpl->loadTexture(filepath.c_str());
+    if (!this->m_textureImpl->loadTexture(filepath.c_str()))
+    {
+        return false;
+    }
+    ++this->m_revision;
+    return true;
 }
 
 bool e2d::Texture::loadFromMemory(const void* data, std::size_t size)
 {
-    return this->m_textureImpl->loadFromMemory(data, size);
+    if (!this->m_textureImpl->loadFromMemory(data, size))
+    {
+        return false;
+    }
+    ++this->m_revision;
+    return true;
+}
+
+std::function<bool()> e2d::Texture::prepareFromFile(const std::string& filepath)
+{
+    // Only the format cached when the renderer was created is read here, the renderer itself is not
+    // touched off the render thread. Whether the cache is enabled is left to loadImage(), which
+    // decodes the file without an entry if it is not.
+    const auto format = internal::RendererContext::getInstance().getRenderer().getNativeTextureFormat();
+    const auto image  = internal::TextureCache::getInstance().loadImage(filepath, format);
+    if (!image)
+    {
+        return {};
+    }
+    return [this, image]()
+    {
+        if (!this->m_textureImpl->loadFromImage(*image))
+        {
+            return false;
+        }
+        ++this->m_revision;
+        return true;
+    };
 }
 
 bool e2d::Texture::isLoaded() const
@@ -61,6 +94,7 @@ bool e2d::Texture::isLoaded() const
 void e2d::Texture::destroy()
 {
     this->m_textureImpl->destroy();
+    ++this->m_revision;
 }
 
 const e2d::Vector2i& e2d::Texture::getSize() const
@@ -68,6 +102,11 @@ const e2d::Vector2i& e2d::Texture::getSize() const
     return this->m_textureImpl->getSize();
 }
 
+unsigned int e2d::Texture::getRevision() const
+{
+    return this->m_revision;
+}
+
 void* e2d::Texture::getNativeTextureHandle() const
 {
     return this->m_textureImpl->getTexture();
@@ -0,0 +1,388 @@
+/**
+ * @file TextureAtlas.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/SkylinePacker.hpp>
+#include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/TextureAtlas.hpp>
+#include <E2D/Engine/TextureImpl.hpp>
+
+// NOLINTBEGIN
+#include <cstring> //unused, but must be included before SDL on macOS (bug?)
+// NOLINTEND
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+using SurfacePtr = std::unique_ptr<SDL_Surface, decltype(&SDL_FreeSurface)>;
+
+constexpr const char* layoutHeader  = "atlas";
+constexpr int         layoutVersion = 1;
+
+bool isValidName(const std::string& name)
+{
+    return !name.empty() && std::none_of(name.begin(), name.end(), [](char c) { return std::isspace(c) != 0; });
+}
+} // namespace
+
+e2d::TextureAtlas::TextureAtlas()
+{
+    log::debug("Constructing TextureAtlas");
+}
+
+e2d::TextureAtlas::~TextureAtlas()
+{
+    log::debug("Destructing TextureAtlas");
+}
+
+bool e2d::TextureAtlas::loadFromFile(const std::string& filepath)
+{
+    std::ifstream file(filepath);
+    if (!file)
+    {
+        log::error("Failed to open texture atlas layout '{}'", filepath);
+        return false;
+    }
+    return this->loadLayout(file, filepath);
+}
+
+bool e2d::TextureAtlas::loadFromMemory(const void* data, std::size_t size)
+{
+    std::istringstream stream(std::string(static_cast<const char*>(data), size));
+    return this->loadLayout(stream, "memory");
+}
+
+bool e2d::TextureAtlas::add(const std::string& name, const std::string& filepath)
+{
+    if (!isValidName(name))
+    {
+        log::error("Failed to add '{}' to texture atlas: names may not be empty or contain whitespace", name);
+        return false;
+    }
+
+    const auto exists = std::any_of(this->m_entries.begin(),
+                                    this->m_entries.end(),
+                                    [&name](const Entry& entry) { return entry.name == name; });
+    if (exists)
+    {
+        log::error("Failed to add '{}' to texture atlas: the name is already in use", name);
+        return false;
+    }
+
+    this->m_entries.push_back({name, filepath, 0, {}});
+    return true;
+}
+
+bool e2d::TextureAtlas::pack()
+{
+    return this->build(true);
+}
+
+bool e2d::TextureAtlas::saveLayout(const std::string& filepath) const
+{
+    if (!this->isLoaded())
+    {
+        log::error("Failed to save texture atlas layout '{}': the atlas has not been packed", filepath);
+        return false;
+    }
+
+    std::ofstream file(filepath, std::ios::trunc);
+    if (!file)
+    {
+        log::error("Failed to open texture atlas layout '{}' for writing", filepath);
+        return false;
+    }
+
+    file << layoutHeader << ' ' << layoutVersion << '\n';
+    for (std::size_t index = 0; index < this->m_pageSizes.size(); ++index)
+    {
+        file << "page " << index << ' ' << this->m_pageSizes[index].x << ' ' << this->m_pageSizes[index].y << '\n';
+    }
+    for (const auto& entry : this->m_entries)
+    {
+        file << "region " << entry.name << ' ' << entry.page << ' ' << entry.rect.left << ' ' << entry.rect.top << ' '
+             << entry.rect.width << ' ' << entry.rect.height << ' ' << entry.filepath << '\n';
+    }
+
+    if (!file)
+    {
+        log::error("Failed to write texture atlas layout '{}'", filepath);
+        return false;
+    }
+    return true;
+}
+
+bool e2d::TextureAtlas::isLoaded() const
+{
+    return !this->m_pages.empty();
+}
+
+void e2d::TextureAtlas::destroy()
+{
+    this->m_entries.clear();
+    this->m_pageSizes.clear();
+    this->m_pages.clear();
+    this->m_regions.clear();
+}
+
+bool e2d::TextureAtlas::hasRegion(const std::string& name) const
+{
+    return this->m_regions.find(name) != this->m_regions.end();
+}
+
+const e2d::TextureRegion& e2d::TextureAtlas::getRegion(const std::string& name) const
+{
+    const auto it = this->m_regions.find(name);
+    if (it == this->m_regions.end())
+    {
+        throw std::runtime_error("The texture atlas region `" + name + "` does not exist.");
+    }
+    return it->second;
+}
+
+std::size_t e2d::TextureAtlas::getPageCount() const
+{
+    return this->m_pages.size();
+}
+
+std::shared_ptr<const e2d::Texture> e2d::TextureAtlas::getPage(std::size_t index) const
+{
+    if (index >= this->m_pages.size())
+    {
+        return nullptr;
+    }
+    return this->m_pages[index];
+}
+
+void e2d::TextureAtlas::setMaxPageSize(const e2d::Vector2i& size)
+{
+    this->m_maxPageSize = size;
+}
+
+const e2d::Vector2i& e2d::TextureAtlas::getMaxPageSize() const
+{
+    return this->m_maxPageSize;
+}
+
+void e2d::TextureAtlas::setPadding(int padding)
+{
+    this->m_padding = std::max(padding, 0);
+}
+
+int e2d::TextureAtlas::getPadding() const
+{
+    return this->m_padding;
+}
+
+bool e2d::TextureAtlas::loadLayout(std::istream& stream, const std::string& source)
+{
+    std::string header;
+    int         version = 0;
+    if (!(stream >> header >> version) || header != layoutHeader || version != layoutVersion)
+    {
+        log::error("Failed to load texture atlas layout '{}': unsupported format", source);
+        return false;
+    }
+
+    std::vector<Entry>    entries;
+    std::vector<Vector2i> pageSizes;
+
+    std::string keyword;
+    while (stream >> keyword)
+    {
+        if (keyword == "page")
+        {
+            std::size_t index = 0;
+            Vector2i    size;
+            if (!(stream >> index >> size.x >> size.y) || index != pageSizes.size())
+            {
+                log::error("Failed to load texture atlas layout '{}': malformed page", source);
+                return false;
+            }
+            pageSizes.push_back(size);
+        }
+        else if (keyword == "region")
+        {
+            Entry entry;
+            if (!(stream >> entry.name >> entry.page >> entry.rect.left >> entry.rect.top >> entry.rect.width >>
+                  entry.rect.height) ||
+                !std::getline(stream >> std::ws, entry.filepath) || entry.page >= pageSizes.size() ||
+                entry.rect.left < 0 || entry.rect.top < 0 ||
+                entry.rect.left + entry.rect.width > pageSizes[entry.page].x ||
+                entry.rect.top + entry.rect.height > pageSizes[entry.page].y)
+            {
+                log::error("Failed to load texture atlas layout '{}': malformed region", source);
+                return false;
+            }
+            entries.push_back(std::move(entry));
+        }
+        else
+        {
+            log::error("Failed to load texture atlas layout '{}': unknown keyword '{}'", source, keyword);
+            return false;
+        }
+    }
+
+    this->destroy();
+    this->m_entries   = std::move(entries);
+    this->m_pageSizes = std::move(pageSizes);
+    return this->build(false);
+}
+
+bool e2d::TextureAtlas::build(bool repack)
+{
+    this->m_pages.clear();
+    this->m_regions.clear();
+
+    std::vector<SurfacePtr> images;
+    images.reserve(this->m_entries.size());
+    for (const auto& entry : this->m_entries)
+    {
+        images.emplace_back(IMG_Load(entry.filepath.c_str()), &SDL_FreeSurface);
+        if (!images.back())
+        {
+            log::error("Failed to load texture atlas image '{}': {}", entry.filepath, IMG_GetError());
+            return false;
+        }
+
+        // Copy the pixels verbatim instead of blending them onto the transparent page
+        SDL_SetSurfaceBlendMode(images.back().get(), SDL_BLENDMODE_NONE);
+    }
+
+    if (repack)
+    {
+        // Placing the tallest images first keeps the skyline flat and wastes the least space
+        std::vector<std::size_t> order(this->m_entries.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [&images](std::size_t lhs, std::size_t rhs)
+                         {
+                             if (images[lhs]->h != images[rhs]->h)
+                             {
+                                 return images[lhs]->h > images[rhs]->h;
+                             }
+                             return images[lhs]->w > images[rhs]->w;
+                         });
+
+        std::vector<std::unique_ptr<internal::SkylinePacker>> packers;
+        for (const auto index : order)
+        {
+            auto&          entry = this->m_entries[index];
+            const Vector2i size{images[index]->w, images[index]->h};
+            const Vector2i paddedSize{size.x + this->m_padding, size.y + this->m_padding};
+
+            std::optional<IntRect> area;
+            for (entry.page = 0; entry.page < packers.size(); ++entry.page)
+            {
+                if ((area = packers[entry.page]->insert(paddedSize)))
+                {
+                    break;
+                }
+            }
+            if (!area)
+            {
+                packers.push_back(std::make_unique<internal::SkylinePacker>(this->m_maxPageSize));
+                area = packers.back()->insert(paddedSize);
+            }
+            if (!area)
+            {
+                log::error("Failed to pack texture atlas image '{}': it is larger than the maximum page size",
+                           entry.filepath);
+                return false;
+            }
+
+            entry.rect = IntRect(area->getPosition(), size);
+        }
+
+        this->m_pageSizes.clear();
+        for (const auto& packer : packers)
+        {
+            this->m_pageSizes.push_back(packer->getUsedSize());
+        }
+    }
+
+    std::vector<SurfacePtr> pages;
+    for (const auto& pageSize : this->m_pageSizes)
+    {
+        pages.emplace_back(SDL_CreateRGBSurfaceWithFormat(0, pageSize.x, pageSize.y, 32, SDL_PIXELFORMAT_RGBA32),
+                           &SDL_FreeSurface);
+        if (!pages.back())
+        {
+            log::error("Failed to create texture atlas page: {}", SDL_GetError());
+            return false;
+        }
+        SDL_FillRect(pages.back().get(), nullptr, 0);
+    }
+
+    for (std::size_t index = 0; index < this->m_entries.size(); ++index)
+    {
+        const auto& entry = this->m_entries[index];
+        if (images[index]->w != entry.rect.width || images[index]->h != entry.rect.height)
+        {
+            log::error("Failed to place texture atlas image '{}': its size no longer matches the layout",
+                       entry.filepath);
+            return false;
+        }
+
+        SDL_Rect destination{entry.rect.left, entry.rect.top, entry.rect.width, entry.rect.height};
+        if (SDL_BlitSurface(images[index].get(), nullptr, pages[entry.page].get(), &destination) != 0)
+        {
+            log::error("Failed to copy texture atlas image '{}' onto its page: {}", entry.filepath, SDL_GetError());
+            return false;
+        }
+    }
+
+    std::vector<std::shared_ptr<Texture>> textures;
+    for (const auto& page : pages)
+    {
+        auto texture = std::make_shared<Texture>();
+        if (!texture->m_textureImpl->loadFromSurface(page.get()))
+        {
+            return false;
+        }
+        textures.push_back(std::move(texture));
+    }
+
+    this->m_pages = std::move(textures);
+    for (const auto& entry : this->m_entries)
+    {
+        this->m_regions[entry.name] = TextureRegion{this->m_pages[entry.page], entry.rect};
+    }
+
+    log::info("Built texture atlas with {} images on {} pages", this->m_entries.size(), this->m_pages.size());
+    return true;
+}
@@ -0,0 +1,302 @@
+/**
+ * @file TextureCache.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/TextureCache.hpp>
+
+// NOLINTBEGIN
+#include <cstring> //unused, but must be included before SDL on macOS (bug?)
+// NOLINTEND
+
+#include <SDL.h>
+#include <SDL_image.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using SurfacePtr = std::unique_ptr<SDL_Surface, decltype(&SDL_FreeSurface)>;
+
+constexpr std::uint32_t cacheMagic   = 0x54443245; // "E2DT"
+constexpr std::uint32_t cacheVersion = 1;
+
+/**
+ * @brief Header preceding the raw pixel rows of a cache entry.
+ */
+struct CacheHeader
+{
+    std::uint32_t magic;       //!< Identifies the file as a cache entry.
+    std::uint32_t version;     //!< The version of the entry layout.
+    std::uint64_t contentHash; //!< Hash of the source file's content.
+    std::uint32_t format;      //!< The SDL pixel format of the pixels.
+    std::int32_t  width;       //!< The width of the texture in pixels.
+    std::int32_t  height;      //!< The height of the texture in pixels.
+    std::int32_t  pitch;       //!< The length of a pixel row in bytes.
+    std::uint32_t blended;     //!< Whether the texture uses alpha blending.
+};
+
+std::uint64_t hash(const void* data, std::size_t size, std::uint64_t seed = 0xcbf29ce484222325ULL)
+{
+    // 64-bit FNV-1a
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        seed ^= bytes[i];
+        seed *= 0x100000001b3ULL;
+    }
+    return seed;
+}
+} // namespace
+
+e2d::internal::TextureCache::TextureCache()
+{
+    log::debug("Constructing TextureCache");
+}
+
+e2d::internal::TextureCache::~TextureCache()
+{
+    log::debug("Destructing TextureCache");
+}
+
+e2d::internal::TextureCache& e2d::internal::TextureCache::getInstance()
+{
+    static TextureCache instance;
+    return instance;
+}
+
+bool e2d::internal::TextureCache::enable(const std::string& directory)
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error)
+    {
+        log::error("Failed to create texture cache directory '{}': {}", directory, error.message());
+        return false;
+    }
+
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_directory = directory;
+    return true;
+}
+
+void e2d::internal::TextureCache::disable()
+{
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_directory.clear();
+}
+
+bool e2d::internal::TextureCache::isEnabled() const
+{
+    const std::lock_guard<std::mutex> lock(this->m_mutex);
+    return !this->m_directory.empty();
+}
+
+SDL_Texture* e2d::internal::TextureCache::loadTexture(SDL_Renderer* renderer, const std::string& filepath)
+{
+    const auto image = this->loadImage(filepath, getNativeFormat(renderer));
+    return image ? createTexture(renderer, *image) : nullptr;
+}
+
+std::shared_ptr<const e2d::internal::TextureCache::Image> e2d::internal::TextureCache::loadImage(
+    const std::string& filepath,
+    std::uint32_t      format)
+{
+    std::filesystem::path directory;
+    {
+        const std::lock_guard<std::mutex> lock(this->m_mutex);
+        directory = this->m_directory;
+    }
+
+    // The cache can be disabled at any time, so only the copied directory tells whether to use entries
+    const bool enabled = !directory.empty();
+
+    std::error_code error;
+    const auto      modified = std::filesystem::last_write_time(filepath, error);
+    std::ifstream   source(filepath, std::ios::binary);
+    if (error || !source)
+    {
+        log::error("Failed to open texture '{}'", filepath);
+        return nullptr;
+    }
+    const std::vector<char> content((std::istreambuf_iterator<char>(source)), std::istreambuf_iterator<char>());
+
+    // The entry name covers path and modification time, the stored content hash guards against stale entries
+    const auto modifiedTicks = modified.time_since_epoch().count();
+    const auto key = hash(&modifiedTicks, sizeof(modifiedTicks), hash(filepath.data(), filepath.size()));
+    const auto contentHash = hash(content.data(), content.size());
+
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".e2dtex";
+    const auto entryPath = directory / name.str();
+
+    auto        image = std::make_shared<Image>();
+    CacheHeader header{};
+    if (enabled)
+    {
+        if (std::ifstream entry(entryPath, std::ios::binary); entry)
+        {
+            if (entry.read(reinterpret_cast<char*>(&header), sizeof(header)) && header.magic == cacheMagic &&
+                header.version == cacheVersion && header.contentHash == contentHash && header.format == format &&
+                header.width > 0 && header.height > 0 && header.pitch > 0)
+            {
+                image->pixels.resize(static_cast<std::size_t>(header.pitch) * static_cast<std::size_t>(header.height));
+                if (entry.read(image->pixels.data(), static_cast<std::streamsize>(image->pixels.size())))
+                {
+                    image->format  = header.format;
+                    image->width   = header.width;
+                    image->height  = header.height;
+                    image->pitch   = header.pitch;
+                    image->blended = header.blended != 0;
+                    ++this->m_hits;
+                    return image;
+                }
+            }
+            log::warn("Ignoring stale or corrupt texture cache entry '{}'", entryPath.string());
+        }
+    }
+
+    ++this->m_misses;
+
+    SDL_RWops* rw = SDL_RWFromConstMem(content.data(), static_cast<int>(content.size()));
+    if (rw == nullptr)
+    {
+        log::error("Failed to load texture: {}", SDL_GetError());
+        return nullptr;
+    }
+
+    const SurfacePtr decoded(IMG_Load_RW(rw, 1), &SDL_FreeSurface);
+    if (!decoded)
+    {
+        log::error("Failed to load texture: {}", IMG_GetError());
+        return nullptr;
+    }
+
+    const SurfacePtr converted(SDL_ConvertSurfaceFormat(decoded.get(), format, 0), &SDL_FreeSurface);
+    if (!converted)
+    {
+        log::error("Failed to convert texture to the native pixel format: {}", SDL_GetError());
+        return nullptr;
+    }
+
+    // Match IMG_LoadTexture, which only enables blending for images with transparency
+    image->format  = format;
+    image->width   = converted->w;
+    image->height  = converted->h;
+    image->pitch   = converted->pitch;
+    image->blended = decoded->format->Amask != 0 || SDL_HasColorKey(decoded.get()) == SDL_TRUE;
+
+    SDL_LockSurface(converted.get());
+    const auto* pixels = static_cast<const char*>(converted->pixels);
+    image->pixels.assign(pixels, pixels + static_cast<std::ptrdiff_t>(converted->pitch) * converted->h);
+    SDL_UnlockSurface(converted.get());
+
+    if (!enabled)
+    {
+        return image;
+    }
+
+    header = {cacheMagic, cacheVersion, contentHash, format, image->width, image->height, image->pitch, image->blended};
+
+    // Write to a temporary file first so that concurrent loads never read a partial entry
+    auto temporaryPath = entryPath;
+    temporaryPath += ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    if (std::ofstream entry(temporaryPath, std::ios::binary | std::ios::trunc); entry)
+    {
+        entry.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        entry.write(image->pixels.data(), static_cast<std::streamsize>(image->pixels.size()));
+        entry.close();
+        if (entry)
+        {
+            std::filesystem::rename(temporaryPath, entryPath, error);
+        }
+        if (!entry || error)
+        {
+            log::warn("Failed to write texture cache entry '{}'", entryPath.string());
+            std::filesystem::remove(temporaryPath, error);
+        }
+    }
+
+    return image;
+}
+
+SDL_Texture* e2d::internal::TextureCache::createTexture(SDL_Renderer* renderer, const Image& image)
+{
+    auto* texture = SDL_CreateTexture(renderer, image.format, SDL_TEXTUREACCESS_STATIC, image.width, image.height);
+    if (texture == nullptr)
+    {
+        log::error("Failed to create texture: {}", SDL_GetError());
+        return nullptr;
+    }
+    if (SDL_UpdateTexture(texture, nullptr, image.pixels.data(), image.pitch) != 0)
+    {
+        log::error("Failed to update texture: {}", SDL_GetError());
+        SDL_DestroyTexture(texture);
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, image.blended ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+    return texture;
+}
+
+std::uint32_t e2d::internal::TextureCache::getNativeFormat(SDL_Renderer* renderer)
+{
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) == 0)
+    {
+        for (Uint32 i = 0; i < info.num_texture_formats; ++i)
+        {
+            if (SDL_ISPIXELFORMAT_ALPHA(info.texture_formats[i]))
+            {
+                return info.texture_formats[i];
+            }
+        }
+    }
+    return SDL_PIXELFORMAT_ARGB8888;
+}
+
+std::size_t e2d::internal::TextureCache::getHits() const
+{
+    return this->m_hits;
+}
+
+std::size_t e2d::internal::TextureCache::getMisses() const
+{
+    return this->m_misses;
+}
+
+void e2d::internal::TextureCache::resetStats()
+{
+    this->m_hits   = 0;
+    this->m_misses = 0;
+}
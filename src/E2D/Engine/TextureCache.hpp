@@ -0,0 +1,198 @@
+/**
+ * @file TextureCache.hpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E2D_ENGINE_TEXTURE_CACHE_HPP
+#define E2D_ENGINE_TEXTURE_CACHE_HPP
+
+#include <E2D/Engine/Export.hpp>
+
+#include <E2D/Core/NonCopyable.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct SDL_Renderer; // Forward declaration of SDL_Renderer
+struct SDL_Texture;  // Forward declaration of SDL_Texture
+
+namespace e2d::internal
+{
+
+/**
+ * @class TextureCache
+ * @ingroup engine
+ * @brief @internal Caches decoded texture pixels on disk to skip image decompression on later loads.
+ *
+ * When enabled, textures loaded from a file are decoded once, converted to the renderer's native
+ * pixel format and written to the cache directory. Subsequent loads of the same file read the raw
+ * pixels straight back into a texture. Entries are keyed by the source path and modification time,
+ * and are only used if the hash of the source file's content still matches.
+ */
+class E2D_ENGINE_API TextureCache final : NonCopyable
+{
+public:
+    /**
+     * @struct Image
+     * @brief Decoded pixels in the renderer's native format, ready to be uploaded.
+     */
+    struct Image
+    {
+        std::uint32_t     format{0};      //!< The SDL pixel format of the pixels.
+        int               width{0};       //!< The width of the image in pixels.
+        int               height{0};      //!< The height of the image in pixels.
+        int               pitch{0};       //!< The length of a pixel row in bytes.
+        bool              blended{false}; //!< Whether the texture uses alpha blending.
+        std::vector<char> pixels;         //!< The pixel rows.
+    };
+
+    /**
+     * @brief Retrieves the singleton instance of the TextureCache.
+     *
+     * @return A reference to the TextureCache singleton instance.
+     */
+    static TextureCache& getInstance();
+
+    /**
+     * @brief Enables the cache, storing entries in the specified directory.
+     *
+     * The directory is created if it does not exist yet.
+     *
+     * @param directory Path to the directory cache entries are stored in.
+     * @return True if the cache is enabled, false if the directory could not be created.
+     */
+    bool enable(const std::string& directory);
+
+    /**
+     * @brief Disables the cache.
+     *
+     * Textures are decoded from their source files again. Existing cache entries are kept on disk.
+     */
+    void disable();
+
+    /**
+     * @brief Checks if the cache is enabled.
+     *
+     * @return True if the cache is enabled, false otherwise.
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief Loads a texture from a file through the cache.
+     *
+     * Reads the cached pixels if a valid entry exists, otherwise decodes the file and stores the
+     * decoded pixels for the next load. Failing to write an entry does not fail the load. If the cache
+     * is disabled, the file is decoded without reading or writing an entry, so callers do not need to
+     * check isEnabled() first, which could change before the load.
+     *
+     * @param renderer The renderer to create the texture with.
+     * @param filepath Path to the image file.
+     * @return Pointer to the created texture, or nullptr if the file could not be loaded.
+     */
+    SDL_Texture* loadTexture(SDL_Renderer* renderer, const std::string& filepath);
+
+    /**
+     * @brief Loads the decoded pixels of an image file through the cache.
+     *
+     * Performs the part of loadTexture() that does not involve the renderer, and may therefore be
+     * called on any thread. Whether the cache is enabled is read once, so disabling it concurrently
+     * makes the load decode the file without writing an entry.
+     *
+     * @param filepath Path to the image file.
+     * @param format The SDL pixel format to convert the pixels to, usually Renderer::getNativeTextureFormat().
+     * @return Shared pointer to the decoded image, or null if the file could not be loaded.
+     */
+    std::shared_ptr<const Image> loadImage(const std::string& filepath, std::uint32_t format);
+
+    /**
+     * @brief Creates a texture from a decoded image.
+     *
+     * Must be called on the render thread.
+     *
+     * @param renderer The renderer to create the texture with.
+     * @param image The decoded image.
+     * @return Pointer to the created texture, or nullptr if creating it failed.
+     */
+    static SDL_Texture* createTexture(SDL_Renderer* renderer, const Image& image);
+
+    /**
+     * @brief Retrieves the pixel format textures are cached in for a renderer.
+     *
+     * This is the first format with an alpha channel the renderer supports natively. Querying the
+     * renderer must happen on the render thread, other threads read Renderer::getNativeTextureFormat().
+     *
+     * @param renderer The renderer.
+     * @return The SDL pixel format.
+     */
+    static std::uint32_t getNativeFormat(SDL_Renderer* renderer);
+
+    /**
+     * @brief Retrieves the number of loads served from the cache.
+     *
+     * @return The number of cache hits.
+     */
+    std::size_t getHits() const;
+
+    /**
+     * @brief Retrieves the number of loads that had to decode the source file.
+     *
+     * @return The number of cache misses.
+     */
+    std::size_t getMisses() const;
+
+    /**
+     * @brief Resets the hit and miss counters to zero.
+     */
+    void resetStats();
+
+private:
+    /**
+     * @brief Constructs a new TextureCache object.
+     *
+     * Private to enforce the singleton pattern.
+     */
+    TextureCache();
+
+    /**
+     * @brief Destructor.
+     *
+     * Ensures proper cleanup of resources upon destruction.
+     */
+    ~TextureCache();
+
+    mutable std::mutex       m_mutex;     //!< Guards the cache directory.
+    std::string              m_directory; //!< The cache directory, empty if the cache is disabled.
+    std::atomic<std::size_t> m_hits{0};   //!< The number of loads served from the cache.
+    std::atomic<std::size_t> m_misses{0}; //!< The number of loads that decoded the source file.
+
+}; // class TextureCache
+
+} // namespace e2d::internal
+
+#endif //E2D_ENGINE_TEXTURE_CACHE_HPP
@@ -28,6 +28,7 @@
 
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/TextureCache.hpp>
 #include <E2D/Engine/TextureImpl.hpp>
 
 // NOLINTBEGIN
@@ -50,8 +51,15 @@ e2d::internal::TextureImpl::~TextureImpl()
 
 bool e2d::internal::TextureImpl::loadTexture(const char* file)
 {
+    if (!RendererContext::getInstance().isRenderThread())
+    {
+        log::error("Failed to load texture '{}': textures can only be loaded on the render thread", file);
+        return false;
+    }
+
+    // The cache decodes the file without storing it if it is disabled, which it checks only once
     auto* renderer  = internal::RendererContext::getInstance().getRenderer().getNativeRenderer();
-    this->m_texture = IMG_LoadTexture(renderer, file);
+    this->m_texture = TextureCache::getInstance().loadTexture(renderer, file);
     if (this->m_texture == nullptr)
     {
         log::error("Failed to load texture: {}", SDL_GetError());
@@ -68,6 +76,12 @@ bool e2d::internal::TextureImpl::loadTexture(const char* file)
 
 bool e2d::internal::TextureImpl::loadFromMemory(const void* data, std::size_t size)
 {
+    if (!RendererContext::getInstance().isRenderThread())
+    {
+        log::error("Failed to load texture from memory: textures can only be loaded on the render thread");
+        return false;
+    }
+
     SDL_RWops* rw = SDL_RWFromConstMem(data, static_cast<int>(size));
     if (rw == nullptr)
     {
@@ -94,6 +108,55 @@ bool e2d::internal::TextureImpl::loadFromMemory(const void* data, std::size_t si
     return true;
 }
 
+bool e2d::internal::TextureImpl::loadFromSurface(SDL_Surface* surface)
+{
+    if (!RendererContext::getInstance().isRenderThread())
+    {
+        log::error("Failed to load texture from surface: textures can only be loaded on the render thread");
+        return false;
+    }
+
+    auto* renderer = internal::RendererContext::getInstance().getRenderer().getNativeRenderer();
+    auto* texture  = SDL_CreateTextureFromSurface(renderer, surface);
+    if (texture == nullptr)
+    {
+        log::error("Failed to load texture from surface: {}", SDL_GetError());
+        return false;
+    }
+    return this->replaceTexture(texture);
+}
+
+bool e2d::internal::TextureImpl::loadFromImage(const TextureCache::Image& image)
+{
+    if (!RendererContext::getInstance().isRenderThread())
+    {
+        log::error("Failed to load texture from image: textures can only be loaded on the render thread");
+        return false;
+    }
+
+    auto* renderer = internal::RendererContext::getInstance().getRenderer().getNativeRenderer();
+    return this->replaceTexture(TextureCache::createTexture(renderer, image));
+}
+
+bool e2d::internal::TextureImpl::createTarget(const Vector2i& size)
+{
+    if (!RendererContext::getInstance().isRenderThread())
+    {
+        log::error("Failed to create render target: textures can only be created on the render thread");
+        return false;
+    }
+
+    auto* renderer = internal::RendererContext::getInstance().getRenderer().getNativeRenderer();
+    auto* texture  = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, size.x, size.y);
+    if (texture == nullptr)
+    {
+        log::error("Failed to create render target: {}", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return this->replaceTexture(texture);
+}
+
 bool e2d::internal::TextureImpl::isLoaded() const
 {
     return this->m_texture != nullptr;
@@ -118,3 +181,24 @@ SDL_Texture* e2d::internal::TextureImpl::getTexture() const
 {
     return this->m_texture;
 }
+
+bool e2d::internal::TextureImpl::replaceTexture(SDL_Texture* texture)
+{
+    if (texture == nullptr)
+    {
+        return false;
+    }
+
+    Vector2i textureSize;
+    if (SDL_QueryTexture(texture, nullptr, nullptr, &textureSize.x, &textureSize.y) != 0)
+    {
+        log::error("Failed to query texture: '{}'. Destroying texture.", SDL_GetError());
+        SDL_DestroyTexture(texture);
+        return false;
+    }
+
+    this->destroy();
+    this->m_texture     = texture;
+    this->m_textureSize = textureSize;
+    return true;
+}
@@ -32,9 +32,12 @@
 #include <E2D/Core/NonCopyable.hpp>
 #include <E2D/Core/Vector2.hpp>
 
+#include <E2D/Engine/TextureCache.hpp>
+
 #include <cstddef>
 
 struct SDL_Renderer; // Forward declaration of SDL_Renderer
+struct SDL_Surface;  // Forward declaration of SDL_Surface
 struct SDL_Texture;  // Forward declaration of SDL_Texture
 
 namespace e2d::internal
@@ -86,6 +89,39 @@ public:
      */
     bool loadFromMemory(const void* data, std::size_t size);
 
+    /**
+     * @brief Loads the texture from the pixels of a surface.
+     *
+     * Uploads the pixels of an already decoded surface, e.g. an atlas page composed on the CPU.
+     * The surface is not taken over and remains owned by the caller. If the texture is already
+     * loaded, it is only replaced once the new texture has been created successfully.
+     *
+     * @param surface Pointer to the surface containing the pixels.
+     * @return True if the texture is successfully created from the surface, false otherwise.
+     */
+    bool loadFromSurface(SDL_Surface* surface);
+
+    /**
+     * @brief Loads the texture from an image decoded by the texture cache.
+     *
+     * If the texture is already loaded, it is only replaced once the new texture has been created successfully.
+     *
+     * @param image The decoded image.
+     * @return True if the texture is successfully created from the image, false otherwise.
+     */
+    bool loadFromImage(const TextureCache::Image& image);
+
+    /**
+     * @brief Creates a blank texture that can be drawn into.
+     *
+     * The texture is fully transparent and blends with what it is drawn onto. If the texture is
+     * already loaded, it is only replaced once the new texture has been created successfully.
+     *
+     * @param size The width and height of the texture in pixels.
+     * @return True if the texture is successfully created, false otherwise.
+     */
+    bool createTarget(const Vector2i& size);
+
     /**
      * @brief Checks if the texture is loaded and valid.
      *
@@ -122,6 +158,14 @@ public:
     SDL_Texture* getTexture() const;
 
 private:
+    /**
+     * @brief Replaces the current texture with a newly created one.
+     *
+     * @param texture The new texture, taken over by this object. May be null if creating it failed.
+     * @return True if the texture was replaced, false if it is null or could not be queried.
+     */
+    bool replaceTexture(SDL_Texture* texture);
+
     SDL_Texture*  m_texture{nullptr}; //!< Pointer to the underlying SDL_Texture object.
     e2d::Vector2i m_textureSize;      //!< Stores the dimensions of the SDL_Texture object.
 
@@ -0,0 +1,436 @@
+/**
+ * @file TileMap.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Logger.hpp>
+
+#include <E2D/Engine/EngineMetrics.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderSnapshot.hpp>
+#include <E2D/Engine/SDLRenderUtils.hpp>
+#include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/TileMap.hpp>
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+/**
+ * @brief Maps a span of the map, in unscaled pixels, to the screen.
+ *
+ * Both ends are rounded on their own, so neighbouring spans meet without gaps or overlaps.
+ */
+void mapSpan(int begin, int end, int mapStart, int mapLength, float scale, int& screenStart, int& screenLength)
+{
+    const auto first = static_cast<int>(std::lround(static_cast<float>(begin) * std::abs(scale)));
+    const auto last  = static_cast<int>(std::lround(static_cast<float>(end) * std::abs(scale)));
+    screenStart      = scale < 0 ? mapStart + mapLength - last : mapStart + first;
+    screenLength     = last - first;
+}
+
+/**
+ * @brief Finds the range of chunks along one axis that overlaps the render target, usually the screen.
+ */
+void findVisibleChunks(int   mapStart,
+                       int   mapLength,
+                       int   screenLength,
+                       float scale,
+                       int   chunkLength,
+                       int   chunkCount,
+                       int&  first,
+                       int&  last)
+{
+    // The part of the screen covered by the map, in unscaled pixels from the start of the map
+    auto begin = static_cast<float>(-mapStart) / std::abs(scale);
+    auto end   = static_cast<float>(screenLength - mapStart) / std::abs(scale);
+    if (scale < 0)
+    {
+        begin = static_cast<float>(mapStart + mapLength - screenLength) / std::abs(scale);
+        end   = static_cast<float>(mapStart + mapLength) / std::abs(scale);
+    }
+
+    first = std::max(static_cast<int>(std::floor(begin / static_cast<float>(chunkLength))), 0);
+    last  = std::min(static_cast<int>(std::ceil(end / static_cast<float>(chunkLength))), chunkCount);
+}
+} // namespace
+
+e2d::TileMap::TileMap() : e2d::Transformable(), e2d::Renderable()
+{
+    log::debug("Constructing TileMap");
+}
+
+e2d::TileMap::TileMap(const std::string& identifier) : e2d::Object(identifier)
+{
+    log::debug("Constructing TileMap with identifier '{}'", identifier);
+}
+
+e2d::TileMap::~TileMap()
+{
+    log::debug("Destructing TileMap");
+}
+
+void e2d::TileMap::setTileset(const std::shared_ptr<const Texture>& texture, const Vector2i& tileSize)
+{
+    this->setTileset({texture, texture ? IntRect({0, 0}, texture->getSize()) : IntRect()}, tileSize);
+}
+
+void e2d::TileMap::setTileset(const TextureRegion& region, const Vector2i& tileSize)
+{
+    this->m_tileset     = region.texture;
+    this->m_tilesetRect = region.rect;
+    this->m_tileSize    = tileSize;
+    this->invalidate();
+}
+
+std::shared_ptr<const e2d::Texture> e2d::TileMap::getTileset() const
+{
+    return this->m_tileset;
+}
+
+const e2d::Vector2i& e2d::TileMap::getTileSize() const
+{
+    return this->m_tileSize;
+}
+
+bool e2d::TileMap::create(const Vector2i& size, std::size_t layerCount)
+{
+    if (size.x <= 0 || size.y <= 0 || layerCount == 0)
+    {
+        log::error("Failed to create tile map of {}x{} tiles with {} layers", size.x, size.y, layerCount);
+        return false;
+    }
+
+    const auto cellCount = static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y);
+    this->m_mapSize      = size;
+    this->m_chunkCount   = {(size.x + ChunkSize - 1) / ChunkSize, (size.y + ChunkSize - 1) / ChunkSize};
+    this->m_layers.assign(layerCount, std::vector<std::uint16_t>(cellCount, EmptyTile));
+    this->m_chunks = std::vector<Chunk>(static_cast<std::size_t>(this->m_chunkCount.x * this->m_chunkCount.y));
+    this->invalidateLayer();
+    return true;
+}
+
+const e2d::Vector2i& e2d::TileMap::getMapSize() const
+{
+    return this->m_mapSize;
+}
+
+std::size_t e2d::TileMap::getLayerCount() const
+{
+    return this->m_layers.size();
+}
+
+void e2d::TileMap::setTile(std::size_t layer, const Vector2i& position, std::uint16_t tile)
+{
+    const auto index = this->getCellIndex(layer, position);
+    auto&      cell  = this->m_layers[layer][index];
+    if (cell == tile)
+    {
+        return;
+    }
+
+    cell = tile;
+    const Vector2i chunkPosition{position.x / ChunkSize, position.y / ChunkSize};
+    this->m_chunks[static_cast<std::size_t>(chunkPosition.y * this->m_chunkCount.x + chunkPosition.x)].dirty = true;
+    this->invalidateLayer();
+}
+
+std::uint16_t e2d::TileMap::getTile(std::size_t layer, const Vector2i& position) const
+{
+    const auto index = this->getCellIndex(layer, position);
+    return this->m_layers[layer][index];
+}
+
+void e2d::TileMap::setTiles(std::size_t layer, const std::vector<std::uint16_t>& tiles)
+{
+    if (layer >= this->m_layers.size())
+    {
+        throw std::runtime_error("The layer `" + std::to_string(layer) + "` does not exist.");
+    }
+    if (tiles.size() != this->m_layers[layer].size())
+    {
+        throw std::runtime_error("Expected " + std::to_string(this->m_layers[layer].size()) + " tiles, got " +
+                                 std::to_string(tiles.size()) + ".");
+    }
+
+    this->m_layers[layer] = tiles;
+    this->invalidate();
+}
+
+void e2d::TileMap::invalidate()
+{
+    for (auto& chunk : this->m_chunks)
+    {
+        chunk.dirty = true;
+    }
+    this->invalidateLayer();
+}
+
+e2d::Vector2f e2d::TileMap::getSize() const
+{
+    return {static_cast<float>(this->m_mapSize.x * this->m_tileSize.x),
+            static_cast<float>(this->m_mapSize.y * this->m_tileSize.y)};
+}
+
+void e2d::TileMap::onFixedUpdate()
+{
+}
+
+void e2d::TileMap::onVariableUpdate(double deltaTime)
+{
+    (void)deltaTime;
+}
+
+void e2d::TileMap::render() const
+{
+    if (!this->m_tileset || this->m_tileSize.x <= 0 || this->m_tileSize.y <= 0 || this->m_chunks.empty() ||
+        this->getScale().x == 0 || this->getScale().y == 0)
+    {
+        return;
+    }
+
+    // A reloaded or redrawn tileset leaves every chunk showing the old pixels
+    auto* tilesetHandle = this->m_tileset->getNativeTextureHandle();
+    if (tilesetHandle != this->m_bakedTileset || this->m_tileset->getRevision() != this->m_bakedRevision)
+    {
+        for (auto& chunk : this->m_chunks)
+        {
+            chunk.dirty = true;
+        }
+        this->m_bakedTileset  = tilesetHandle;
+        this->m_bakedRevision = this->m_tileset->getRevision();
+    }
+
+    auto& renderer = internal::RendererContext::getInstance().getRenderer();
+
+    const Vector2i targetSize = renderer.getTargetSize();
+
+    const auto& scale   = this->getScale();
+    const auto  mapRect = internal::calculateSDLDestinationRect(
+        IntRect({0, 0}, {this->m_mapSize.x * this->m_tileSize.x, this->m_mapSize.y * this->m_tileSize.y}),
+        this->getPosition(),
+        this->getOrigin(),
+        scale);
+
+    Vector2i first;
+    Vector2i last;
+    findVisibleChunks(mapRect.x,
+                      mapRect.w,
+                      targetSize.x,
+                      scale.x,
+                      ChunkSize * this->m_tileSize.x,
+                      this->m_chunkCount.x,
+                      first.x,
+                      last.x);
+    findVisibleChunks(mapRect.y,
+                      mapRect.h,
+                      targetSize.y,
+                      scale.y,
+                      ChunkSize * this->m_tileSize.y,
+                      this->m_chunkCount.y,
+                      first.y,
+                      last.y);
+
+    const auto toScreen = [&mapRect, &scale](const IntRect& rectangle)
+    {
+        const auto right  = rectangle.left + rectangle.width;
+        const auto bottom = rectangle.top + rectangle.height;
+        SDL_Rect   destination;
+        mapSpan(rectangle.left, right, mapRect.x, mapRect.w, scale.x, destination.x, destination.w);
+        mapSpan(rectangle.top, bottom, mapRect.y, mapRect.h, scale.y, destination.y, destination.h);
+        return destination;
+    };
+
+    internal::RenderCommand command;
+    command.flip     = internal::toSDLRendererFlip(scale);
+    command.priority = this->getRenderPriority();
+
+    for (int y = first.y; y < last.y; ++y)
+    {
+        for (int x = first.x; x < last.x; ++x)
+        {
+            const Vector2i chunkPosition{x, y};
+            const auto&    chunk = this->m_chunks[static_cast<std::size_t>(y * this->m_chunkCount.x + x)];
+            const Vector2i chunkOrigin{x * ChunkSize * this->m_tileSize.x, y * ChunkSize * this->m_tileSize.y};
+
+            if (!this->bake(chunkPosition))
+            {
+                // Still draws the chunk, just one tile at a time
+                command.texture   = static_cast<SDL_Texture*>(tilesetHandle);
+                command.revision  = this->m_tileset->getRevision();
+                command.hasSource = true;
+                this->forEachTile(chunkPosition,
+                                  [&](const IntRect& source, const IntRect& destination)
+                                  {
+                                      command.source      = internal::toSDLRect(source);
+                                      command.destination = toScreen(
+                                          IntRect(chunkOrigin + destination.getPosition(), destination.getSize()));
+                                      renderer.submit(command);
+                                  });
+                continue;
+            }
+            if (chunk.empty)
+            {
+                continue;
+            }
+
+            command.texture     = static_cast<SDL_Texture*>(chunk.texture->getTexture()->getNativeTextureHandle());
+            command.revision    = chunk.texture->getTexture()->getRevision();
+            command.hasSource   = false;
+            command.destination = toScreen(IntRect(chunkOrigin, this->getChunkSize(chunkPosition)));
+            renderer.submit(command);
+        }
+    }
+}
+
+unsigned int e2d::TileMap::getContentRevision() const
+{
+    return this->m_tileset ? this->m_tileset->getRevision() : 0;
+}
+
+bool e2d::TileMap::bake(const Vector2i& chunkPosition) const
+{
+    auto& chunk = this->m_chunks[static_cast<std::size_t>(chunkPosition.y * this->m_chunkCount.x + chunkPosition.x)];
+    if (!chunk.dirty)
+    {
+        return true;
+    }
+
+    const auto tileCount = static_cast<std::size_t>((this->m_tilesetRect.width / this->m_tileSize.x) *
+                                                    (this->m_tilesetRect.height / this->m_tileSize.y));
+    const auto first     = chunkPosition * ChunkSize;
+    const auto last      = Vector2i{std::min(first.x + ChunkSize, this->m_mapSize.x),
+                               std::min(first.y + ChunkSize, this->m_mapSize.y)};
+
+    chunk.empty = true;
+    for (const auto& tiles : this->m_layers)
+    {
+        for (int y = first.y; y < last.y && chunk.empty; ++y)
+        {
+            const auto row = tiles.begin() + y * this->m_mapSize.x;
+            chunk.empty    = std::all_of(row + first.x,
+                                      row + last.x,
+                                      [tileCount](std::uint16_t tile)
+                                      { return tile == EmptyTile || tile > tileCount; });
+        }
+    }
+
+    if (chunk.empty)
+    {
+        // Nothing to draw, so an empty chunk does not need a texture
+        chunk.texture.reset();
+        chunk.dirty = false;
+        return true;
+    }
+
+    if (!chunk.texture)
+    {
+        chunk.texture = std::make_unique<RenderTexture>();
+    }
+
+    auto&      renderer = internal::RendererContext::getInstance().getRenderer();
+    const auto drawTiles = [this, &renderer, &chunkPosition]
+    {
+        internal::RenderCommand command;
+        command.texture   = static_cast<SDL_Texture*>(this->m_tileset->getNativeTextureHandle());
+        command.hasSource = true;
+        this->forEachTile(chunkPosition,
+                          [&renderer, &command](const IntRect& source, const IntRect& destination)
+                          {
+                              command.source      = internal::toSDLRect(source);
+                              command.destination = internal::toSDLRect(destination);
+                              renderer.submit(command);
+                          });
+    };
+
+    // Clearing goes through RenderTexture::drawToTexture(), which bumps the revision of the chunk texture, so
+    // commands drawing the chunk are told apart from those of the previous bake
+    const auto size     = this->getChunkSize(chunkPosition);
+    const bool rendered = (size == chunk.texture->getSize() || chunk.texture->create(size)) && chunk.texture->clear() &&
+                          renderer.renderToTarget(
+                              static_cast<SDL_Texture*>(chunk.texture->getTexture()->getNativeTextureHandle()),
+                              drawTiles);
+    if (!rendered)
+    {
+        chunk.texture.reset();
+        return false;
+    }
+
+    chunk.dirty = false;
+    internal::EngineMetrics::getInstance().chunkBakes.increment();
+    return true;
+}
+
+void e2d::TileMap::forEachTile(const Vector2i&                                            chunkPosition,
+                               const std::function<void(const IntRect&, const IntRect&)>& function) const
+{
+    const auto columns = this->m_tilesetRect.width / this->m_tileSize.x;
+    const auto rows    = this->m_tilesetRect.height / this->m_tileSize.y;
+    const auto first   = chunkPosition * ChunkSize;
+    const auto last    = Vector2i{std::min(first.x + ChunkSize, this->m_mapSize.x),
+                               std::min(first.y + ChunkSize, this->m_mapSize.y)};
+
+    for (const auto& tiles : this->m_layers)
+    {
+        for (int y = first.y; y < last.y; ++y)
+        {
+            for (int x = first.x; x < last.x; ++x)
+            {
+                const int tile = tiles[static_cast<std::size_t>(y * this->m_mapSize.x + x)];
+                if (tile == EmptyTile || tile > columns * rows)
+                {
+                    continue;
+                }
+
+                const Vector2i source{this->m_tilesetRect.left + ((tile - 1) % columns) * this->m_tileSize.x,
+                                      this->m_tilesetRect.top + ((tile - 1) / columns) * this->m_tileSize.y};
+                const Vector2i destination{(x - first.x) * this->m_tileSize.x, (y - first.y) * this->m_tileSize.y};
+                function(IntRect(source, this->m_tileSize), IntRect(destination, this->m_tileSize));
+            }
+        }
+    }
+}
+
+e2d::Vector2i e2d::TileMap::getChunkSize(const Vector2i& chunkPosition) const
+{
+    const auto first = chunkPosition * ChunkSize;
+    return {(std::min(first.x + ChunkSize, this->m_mapSize.x) - first.x) * this->m_tileSize.x,
+            (std::min(first.y + ChunkSize, this->m_mapSize.y) - first.y) * this->m_tileSize.y};
+}
+
+std::size_t e2d::TileMap::getCellIndex(std::size_t layer, const Vector2i& position) const
+{
+    if (layer >= this->m_layers.size() || position.x < 0 || position.y < 0 || position.x >= this->m_mapSize.x ||
+        position.y >= this->m_mapSize.y)
+    {
+        throw std::runtime_error("The cell `" + std::to_string(position.x) + ", " + std::to_string(position.y) +
+                                 "` of layer `" + std::to_string(layer) + "` is outside the map.");
+    }
+    return static_cast<std::size_t>(position.y * this->m_mapSize.x + position.x);
+}
@@ -43,6 +43,7 @@ const e2d::Vector2f& e2d::Transformable::getPosition() const
 void e2d::Transformable::setPosition(const e2d::Vector2f& position)
 {
     this->m_position = position;
+    ++this->m_revision;
 }
 
 const e2d::Vector2f& e2d::Transformable::getOrigin() const
@@ -53,6 +54,7 @@ const e2d::Vector2f& e2d::Transformable::getOrigin() const
 void e2d::Transformable::setOrigin(const e2d::Vector2f& origin)
 {
     this->m_origin = origin;
+    ++this->m_revision;
 }
 
 const e2d::Vector2f& e2d::Transformable::getScale() const
@@ -63,6 +65,7 @@ const e2d::Vector2f& e2d::Transformable::getScale() const
 void e2d::Transformable::setScale(const e2d::Vector2f& scale)
 {
     this->m_scale = scale;
+    ++this->m_revision;
 }
 
 double e2d::Transformable::getRotation() const
@@ -73,6 +76,12 @@ double e2d::Transformable::getRotation() const
 void e2d::Transformable::setRotation(double angle)
 {
     this->m_rotation = angle;
+    ++this->m_revision;
+}
+
+unsigned int e2d::Transformable::getTransformRevision() const
+{
+    return this->m_revision;
 }
 
 e2d::FloatRect e2d::Transformable::getLocalBounds() const
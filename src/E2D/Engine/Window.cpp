@@ -40,10 +40,27 @@ e2d::internal::Window::~Window()
     log::debug("Destructing Window");
 }
 
-bool e2d::internal::Window::create(const char* title, int width, int height)
+bool e2d::internal::Window::create(const char* title, const WindowSettings& settings)
 {
-    log::debug("Creating window with title '{}', width '{}', and height '{}'", title, width, height);
-    this->m_window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, SDL_WINDOW_SHOWN);
+    log::debug("Creating window with title '{}', width '{}', and height '{}'", title, settings.size.x, settings.size.y);
+
+    Uint32 flags = SDL_WINDOW_SHOWN;
+    if (settings.fullscreen)
+    {
+        // Borderless fullscreen covers the desktop at its current resolution instead of changing it
+        flags |= settings.borderless ? SDL_WINDOW_FULLSCREEN_DESKTOP : SDL_WINDOW_FULLSCREEN;
+    }
+    else if (settings.borderless)
+    {
+        flags |= SDL_WINDOW_BORDERLESS;
+    }
+
+    this->m_window = SDL_CreateWindow(title,
+                                      SDL_WINDOWPOS_CENTERED,
+                                      SDL_WINDOWPOS_CENTERED,
+                                      settings.size.x,
+                                      settings.size.y,
+                                      flags);
     if (this->m_window == nullptr)
     {
         log::error("Failed to create window: '{}'", SDL_GetError());
@@ -32,6 +32,8 @@
 #include <E2D/Core/Color.hpp>
 #include <E2D/Core/NonCopyable.hpp>
 
+#include <E2D/Engine/WindowSettings.hpp>
+
 #include <memory>
 #include <string>
 
@@ -68,14 +70,13 @@ public:
     /**
      * @brief Creates a window with the specified properties.
      *
-     * Initializes the window with a title, width, and height.
+     * Initializes the window with a title, size, and fullscreen and border options.
      *
      * @param title The title of the window.
-     * @param width The width of the window in pixels.
-     * @param height The height of the window in pixels.
+     * @param settings The size and style of the window.
      * @return True if the creation was successful, false otherwise.
      */
-    bool create(const char* title, int width, int height);
+    bool create(const char* title, const WindowSettings& settings);
 
     /**
      * @brief Checks if the window is created and valid.
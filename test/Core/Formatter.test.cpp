@@ -28,6 +28,10 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <string>
+#include <string_view>
+
 TEST_CASE("Formatter Tests", "[Format]")
 {
     SECTION("Basic formatting")
@@ -77,3 +81,107 @@ TEST_CASE("Formatter Tests", "[Format]")
         REQUIRE(result == "Escaped braces {} not replaced");
     }
 }
+
+namespace
+{
+struct Streamable
+{
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Streamable& streamable)
+{
+    return os << "Streamable(" << streamable.value << ")";
+}
+} // namespace
+
+TEST_CASE("Formatter formatTo Tests", "[Format]")
+{
+    e2d::FormatBuffer buffer;
+
+    SECTION("Basic formatting")
+    {
+        e2d::Formatter::formatTo(buffer, "Hello, {}!", "world");
+        REQUIRE(buffer.getView() == "Hello, world!");
+    }
+
+    SECTION("Numbers match stream output")
+    {
+        e2d::Formatter::formatTo(buffer,
+                                 "{} {} {} {} {} {}",
+                                 -42,
+                                 18446744073709551615ULL,
+                                 3.14,
+                                 0.5f,
+                                 1e-7,
+                                 true);
+        REQUIRE(buffer.getView() == "-42 18446744073709551615 3.14 0.5 1e-07 1");
+    }
+
+    SECTION("Strings and characters")
+    {
+        const std::string      text = "string";
+        const std::string_view view = "view";
+        const char*            null = nullptr;
+        e2d::Formatter::formatTo(buffer, "{} {} {}{} {}", text, view, 'c', 'h', null);
+        REQUIRE(buffer.getView() == "string view ch (null)");
+    }
+
+    SECTION("Types with a stream operator")
+    {
+        e2d::Formatter::formatTo(buffer, "Value: {}", Streamable{7});
+        REQUIRE(buffer.getView() == "Value: Streamable(7)");
+    }
+
+    SECTION("Escaped braces are never placeholders")
+    {
+        e2d::Formatter::formatTo(buffer, "{{}} {} }}{{", 1);
+        REQUIRE(buffer.getView() == "{} 1 }{");
+    }
+
+    SECTION("Compile-time checked format strings")
+    {
+        e2d::Formatter::formatTo(buffer, E2D_FORMAT("{} + {} = {}"), 1, 1, 2);
+        REQUIRE(buffer.getView() == "1 + 1 = 2");
+        STATIC_REQUIRE(e2d::internal::countPlaceholders("{} {{}} {}") == 2);
+    }
+
+    SECTION("Runtime format strings are validated")
+    {
+        const std::string format = "Only {} placeholder";
+        REQUIRE_THROWS_AS(e2d::Formatter::formatTo(buffer, format, 1, 2), std::runtime_error);
+        e2d::Formatter::formatTo(buffer, format, 1);
+        REQUIRE(buffer.getView() == "Only 1 placeholder");
+    }
+
+#if !defined(__cpp_consteval)
+    SECTION("Character arrays filled at runtime")
+    {
+        // Builds with consteval reject arrays that are not constant, so this only compiles without it
+        char format[32] = "Value: {}\0{} {} left over";
+        e2d::Formatter::formatTo(buffer, format, 1);
+        REQUIRE(buffer.getView() == "Value: 1");
+        REQUIRE_FALSE(e2d::FormatString<1>(format).isStatic());
+        REQUIRE(e2d::FormatString<1>(E2D_FORMAT("Value: {}")).isStatic());
+    }
+#endif
+
+    SECTION("Long text moves to the heap")
+    {
+        const std::string longText(e2d::FormatBuffer::InlineCapacity * 3, 'x');
+        e2d::Formatter::formatTo(buffer, "[{}]", longText);
+        REQUIRE(buffer.getSize() == longText.size() + 2);
+        REQUIRE(buffer.toString() == "[" + longText + "]");
+
+        buffer.clear();
+        REQUIRE(buffer.getView().empty());
+    }
+
+    SECTION("Caller supplied buffer truncates")
+    {
+        std::array<char, 8> storage{};
+        const std::size_t   written = e2d::Formatter::formatTo(storage.data(), storage.size(), "{} {}", 12345, 67890);
+        REQUIRE(written == 7);
+        REQUIRE(std::string_view(storage.data()) == "12345 6");
+    }
+}
@@ -0,0 +1,292 @@
+/**
+ * @file LogSink.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/BinaryLogSink.hpp>
+#include <E2D/Core/ConsoleLogSink.hpp>
+#include <E2D/Core/LogArguments.hpp>
+#include <E2D/Core/Logger.hpp>
+#include <E2D/Core/RingBufferLogSink.hpp>
+#include <E2D/Core/RotatingFileLogSink.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Records the text of every message and the thread it was written on.
+ */
+class RecordingSink : public e2d::LogSink
+{
+public:
+    void write(const e2d::LogMessage& message) override
+    {
+        this->texts.emplace_back(message.text);
+        this->threads.push_back(std::this_thread::get_id());
+    }
+
+    std::vector<std::string>     texts;
+    std::vector<std::thread::id> threads;
+};
+
+std::string readFile(const std::filesystem::path& path)
+{
+    const std::ifstream file(path, std::ios::binary);
+    std::ostringstream  contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+struct Streamable
+{
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Streamable& streamable)
+{
+    return os << "Streamable(" << streamable.value << ")";
+}
+} // namespace
+
+class LogSinkTest
+{
+public:
+    LogSinkTest()
+        : m_directory(std::filesystem::temp_directory_path() / "e2d-log-sink-test")
+    {
+        std::filesystem::remove_all(this->m_directory);
+        std::filesystem::create_directories(this->m_directory);
+        e2d::Logger::clearSinks();
+    }
+
+    ~LogSinkTest()
+    {
+        e2d::Logger::disableAsync();
+        e2d::Logger::clearSinks();
+        e2d::Logger::addSink(std::make_shared<e2d::ConsoleLogSink>());
+        std::filesystem::remove_all(this->m_directory);
+    }
+
+    LogSinkTest(const LogSinkTest&)            = delete;
+    LogSinkTest& operator=(const LogSinkTest&) = delete;
+
+protected:
+    std::filesystem::path m_directory;
+};
+
+TEST_CASE_METHOD(LogSinkTest, "LogSink Tests", "[LogSink]")
+{
+    SECTION("Encoded arguments format like the Formatter")
+    {
+        const std::string text = "text";
+        e2d::FormatBuffer arguments;
+        e2d::LogArguments::encode(arguments, -42, 7U, 2.5, false, 'x', text, "literal", Streamable{3});
+
+        e2d::FormatBuffer formatted;
+        REQUIRE(e2d::LogArguments::format(formatted, "{} {} {} {} {} {} {} {{}} {}", arguments.getView()));
+
+        e2d::FormatBuffer expected;
+        e2d::Formatter::formatTo(expected,
+                                 "{} {} {} {} {} {} {} {{}} {}",
+                                 -42,
+                                 7U,
+                                 2.5,
+                                 false,
+                                 'x',
+                                 text,
+                                 "literal",
+                                 Streamable{3});
+        REQUIRE(formatted.getView() == expected.getView());
+        REQUIRE(formatted.getView() == "-42 7 2.5 0 x text literal {} Streamable(3)");
+
+        e2d::FormatBuffer truncated;
+        const std::string_view incomplete = arguments.getView().substr(0, arguments.getSize() - 1);
+        REQUIRE_FALSE(e2d::LogArguments::format(truncated, "{} {} {} {} {} {} {} {{}} {}", incomplete));
+    }
+
+    SECTION("Sinks run on the writer thread in asynchronous mode")
+    {
+        auto sink = std::make_shared<RecordingSink>();
+        e2d::Logger::addSink(sink);
+
+        e2d::log::info("Synchronous {}", 1);
+        e2d::Logger::enableAsync();
+        e2d::log::info("Asynchronous {}", 2);
+        e2d::Logger::flush();
+
+        REQUIRE(sink->texts == std::vector<std::string>{"Synchronous 1", "Asynchronous 2"});
+        REQUIRE(sink->threads[0] == std::this_thread::get_id());
+        REQUIRE(sink->threads[1] != std::this_thread::get_id());
+
+        e2d::Logger::removeSink(sink);
+        e2d::log::info("Not recorded");
+        e2d::Logger::flush();
+        REQUIRE(sink->texts.size() == 2);
+    }
+
+    SECTION("Runtime format strings outlive the call in asynchronous mode")
+    {
+        auto sink = std::make_shared<RecordingSink>();
+        e2d::Logger::addSink(sink);
+        e2d::Logger::enableAsync();
+
+        {
+            std::string format = "Runtime {}";
+            e2d::Logger::log(e2d::E2D_LOG_LEVEL_INFO, format, 5);
+            format.assign("Overwritten!");
+        }
+        e2d::Logger::flush();
+
+        REQUIRE(sink->texts == std::vector<std::string>{"Runtime 5"});
+    }
+
+#if !defined(__cpp_consteval)
+    SECTION("Format strings in stack buffers outlive the call in asynchronous mode")
+    {
+        const auto binaryPath = this->m_directory / "stack.e2dlog";
+        auto       sink       = std::make_shared<RecordingSink>();
+        auto       binarySink = std::make_shared<e2d::BinaryLogSink>(binaryPath.string());
+        e2d::Logger::addSink(sink);
+        e2d::Logger::addSink(binarySink);
+        e2d::Logger::enableAsync();
+
+        const auto logFromStack = [](const char* text, int value)
+        {
+            // Both calls use the same stack memory, which is overwritten before the messages are written
+            char format[32] = {};
+            std::copy(text, text + std::char_traits<char>::length(text), format);
+            e2d::Logger::log(e2d::E2D_LOG_LEVEL_INFO, format, value);
+            std::fill(std::begin(format), std::end(format), '!');
+        };
+        logFromStack("First {}", 1);
+        logFromStack("Second {}", 2);
+        e2d::Logger::flush();
+        e2d::Logger::disableAsync();
+        e2d::Logger::clearSinks();
+
+        REQUIRE(sink->texts == std::vector<std::string>{"First 1", "Second 2"});
+
+        binarySink.reset();
+        std::ifstream      input(binaryPath, std::ios::binary);
+        std::ostringstream decoded;
+        REQUIRE(e2d::BinaryLogSink::decode(input, decoded));
+        REQUIRE(decoded.str().find("First 1") != std::string::npos);
+        REQUIRE(decoded.str().find("Second 2") != std::string::npos);
+    }
+#endif
+
+    SECTION("Ring buffer keeps the most recent messages")
+    {
+        auto sink = std::make_shared<e2d::RingBufferLogSink>(3);
+        e2d::Logger::addSink(sink);
+
+        for (int i = 0; i < 5; ++i)
+        {
+            e2d::log::warn("Message {}", i);
+        }
+
+        const auto messages = sink->getMessages();
+        REQUIRE(messages.size() == 3);
+        REQUIRE(messages[0].find("Message 2") != std::string::npos);
+        REQUIRE(messages[2].find("Message 4") != std::string::npos);
+        REQUIRE(messages[2].find("WARN") != std::string::npos);
+
+        const auto dumpPath = this->m_directory / "dump.log";
+        REQUIRE(sink->dumpToFile(dumpPath.string()));
+        const std::string dump = readFile(dumpPath);
+        REQUIRE(dump == messages[0] + messages[1] + messages[2]);
+    }
+
+    SECTION("Rotating file sink limits the file size")
+    {
+        const auto            logPath = this->m_directory / "game.log";
+        constexpr std::size_t maxSize = 256;
+        {
+            auto sink = std::make_shared<e2d::RotatingFileLogSink>(logPath.string(), maxSize, 2);
+            REQUIRE(sink->isOpen());
+            e2d::Logger::addSink(sink);
+
+            for (int i = 0; i < 50; ++i)
+            {
+                e2d::log::info("Rotating message {}", i);
+            }
+            e2d::Logger::clearSinks();
+        }
+
+        REQUIRE(std::filesystem::exists(logPath));
+        REQUIRE(std::filesystem::exists(logPath.string() + ".1"));
+        REQUIRE(std::filesystem::exists(logPath.string() + ".2"));
+        REQUIRE_FALSE(std::filesystem::exists(logPath.string() + ".3"));
+        REQUIRE(std::filesystem::file_size(logPath) <= maxSize);
+        REQUIRE(std::filesystem::file_size(logPath.string() + ".1") <= maxSize);
+        REQUIRE(readFile(logPath).find("Rotating message 49") != std::string::npos);
+        REQUIRE(readFile(logPath).find('\033') == std::string::npos);
+    }
+
+    SECTION("Binary sink is decoded to the same text")
+    {
+        const auto binaryPath = this->m_directory / "game.e2dlog";
+        const auto textPath   = this->m_directory / "game.log";
+        {
+            auto binarySink = std::make_shared<e2d::BinaryLogSink>(binaryPath.string());
+            auto textSink   = std::make_shared<e2d::RingBufferLogSink>(1000);
+            REQUIRE(binarySink->isOpen());
+            e2d::Logger::addSink(binarySink);
+            e2d::Logger::addSink(textSink);
+            e2d::Logger::enableAsync();
+
+            for (int i = 0; i < 200; ++i)
+            {
+                e2d::log::info("Loaded texture {} with size {}x{} in {} ms", "player.png", 32, 32, 0.25 * i);
+                e2d::log::error("Failed to open {}", i);
+            }
+            e2d::Logger::disableAsync();
+            e2d::Logger::clearSinks();
+
+            std::ostringstream expected;
+            textSink->dump(expected);
+            std::ofstream(textPath.string() + ".expected", std::ios::binary) << expected.str();
+        }
+
+        REQUIRE(e2d::BinaryLogSink::decodeFile(binaryPath.string(), textPath.string()));
+        const std::string decoded = readFile(textPath);
+        REQUIRE(decoded == readFile(textPath.string() + ".expected"));
+        REQUIRE(decoded.find("Loaded texture player.png with size 32x32 in 49.75 ms") != std::string::npos);
+        REQUIRE(std::filesystem::file_size(binaryPath) * 2 < decoded.size());
+
+        std::istringstream garbage("not a binary log");
+        std::ostringstream output;
+        REQUIRE_FALSE(e2d::BinaryLogSink::decode(garbage, output));
+    }
+}
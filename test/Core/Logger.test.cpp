@@ -0,0 +1,236 @@
+/**
+ * @file Logger.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/LogQueue.hpp>
+#include <E2D/Core/Logger.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Redirects std::cout to a string stream for the lifetime of the object.
+ */
+class CaptureOutput
+{
+public:
+    CaptureOutput()
+        : m_previous(std::cout.rdbuf(m_stream.rdbuf()))
+    {
+    }
+
+    ~CaptureOutput()
+    {
+        std::cout.rdbuf(m_previous);
+    }
+
+    CaptureOutput(const CaptureOutput&)            = delete;
+    CaptureOutput& operator=(const CaptureOutput&) = delete;
+
+    std::string str() const
+    {
+        return m_stream.str();
+    }
+
+    std::size_t countLines() const
+    {
+        const std::string output = m_stream.str();
+        return static_cast<std::size_t>(std::count(output.begin(), output.end(), '\n'));
+    }
+
+private:
+    std::ostringstream m_stream;
+    std::streambuf*    m_previous;
+};
+
+/**
+ * @brief Counts how many times it is written to a stream.
+ */
+struct CountedArgument
+{
+    int* count;
+};
+
+std::ostream& operator<<(std::ostream& os, const CountedArgument& argument)
+{
+    ++*argument.count;
+    return os << "counted";
+}
+} // namespace
+
+TEST_CASE("Logger Tests", "[Logger]")
+{
+    SECTION("LogQueue keeps records in order and reports when full")
+    {
+        e2d::internal::LogQueue queue(3);
+        REQUIRE(queue.getCapacity() == 4);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            REQUIRE(queue.tryPush(e2d::E2D_LOG_LEVEL_INFO, {}, "Message {}", std::to_string(i)));
+        }
+
+        REQUIRE_FALSE(queue.tryPush(e2d::E2D_LOG_LEVEL_INFO, {}, "Message {}", "overflow"));
+        REQUIRE(queue.getEnqueuePosition() == 4);
+
+        e2d::internal::LogRecord record;
+        for (int i = 0; i < 4; ++i)
+        {
+            REQUIRE(queue.tryPop(record));
+            REQUIRE(record.getFormat() == "Message {}");
+            REQUIRE(record.arguments == std::to_string(i));
+        }
+        REQUIRE_FALSE(queue.tryPop(record));
+        const std::string runtimeFormat = "Runtime {}";
+        REQUIRE(queue.tryPush(e2d::E2D_LOG_LEVEL_WARN, {}, runtimeFormat, "overflow"));
+        REQUIRE(queue.tryPop(record));
+        REQUIRE(record.level == e2d::E2D_LOG_LEVEL_WARN);
+        REQUIRE(record.getFormat() == "Runtime {}");
+        REQUIRE(record.getFormat().data() != runtimeFormat.data());
+        REQUIRE(record.arguments == "overflow");
+    }
+
+    SECTION("Synchronous logging writes the message immediately")
+    {
+        const CaptureOutput output;
+        e2d::log::info("Hello, {}!", "world");
+
+        REQUIRE(output.str().find("Hello, world!") != std::string::npos);
+        REQUIRE(output.str().find("INFO") != std::string::npos);
+    }
+
+    SECTION("Filtered messages are not formatted")
+    {
+        const CaptureOutput   output;
+        const e2d::LogLevel   previousLevel = e2d::Logger::getLevel();
+        int                   formatCount   = 0;
+        const CountedArgument argument{&formatCount};
+
+        e2d::Logger::setLevel(e2d::E2D_LOG_LEVEL_WARN);
+        REQUIRE_FALSE(e2d::Logger::isEnabled(e2d::E2D_LOG_LEVEL_INFO));
+        REQUIRE(e2d::Logger::isEnabled(e2d::E2D_LOG_LEVEL_ERROR));
+
+        e2d::log::info("Filtered {}", argument);
+        REQUIRE(formatCount == 0);
+        REQUIRE(output.countLines() == 0);
+
+        e2d::log::error("Written {}", argument);
+        REQUIRE(formatCount == 1);
+        REQUIRE(output.countLines() == 1);
+
+        e2d::Logger::setLevel(previousLevel);
+    }
+
+    SECTION("Debug messages below the compile-time minimum level are removed")
+    {
+        const CaptureOutput output;
+        const e2d::LogLevel previousLevel = e2d::Logger::getLevel();
+        int                 formatCount   = 0;
+
+        e2d::Logger::setLevel(e2d::E2D_LOG_LEVEL_DEBUG);
+        e2d::log::debug("Debug {}", CountedArgument{&formatCount});
+
+        const bool compiledIn = E2D_LOG_MIN_LEVEL <= static_cast<int>(e2d::E2D_LOG_LEVEL_DEBUG);
+        REQUIRE(e2d::Logger::isEnabled(e2d::E2D_LOG_LEVEL_DEBUG) == compiledIn);
+        REQUIRE(formatCount == (compiledIn ? 1 : 0));
+        REQUIRE(output.countLines() == (compiledIn ? 1U : 0U));
+
+        e2d::Logger::setLevel(previousLevel);
+    }
+
+    SECTION("Asynchronous logging writes every message from every thread")
+    {
+        const CaptureOutput output;
+        e2d::Logger::enableAsync(64, e2d::Logger::OverflowPolicy::Block);
+        REQUIRE(e2d::Logger::isAsyncEnabled());
+
+        constexpr int            threadCount = 4;
+        constexpr int            perThread   = 500;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back(
+                [t]
+                {
+                    for (int i = 0; i < perThread; ++i)
+                    {
+                        e2d::log::info("Thread {} message {}", t, i);
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        e2d::Logger::flush();
+        REQUIRE(output.countLines() == threadCount * perThread);
+        REQUIRE(e2d::Logger::getDroppedCount() == 0);
+        REQUIRE(output.str().find("Thread 3 message 499") != std::string::npos);
+
+        e2d::Logger::disableAsync();
+        REQUIRE_FALSE(e2d::Logger::isAsyncEnabled());
+    }
+
+    SECTION("Drop policy accounts for every message")
+    {
+        const CaptureOutput output;
+        e2d::Logger::enableAsync(2, e2d::Logger::OverflowPolicy::Drop);
+
+        constexpr std::size_t messageCount = 5000;
+        for (std::size_t i = 0; i < messageCount; ++i)
+        {
+            e2d::log::info("Message {}", i);
+        }
+
+        e2d::Logger::flush();
+        REQUIRE(output.countLines() + e2d::Logger::getDroppedCount() == messageCount);
+
+        e2d::Logger::disableAsync();
+    }
+
+    SECTION("Disabling asynchronous mode writes pending messages")
+    {
+        const CaptureOutput output;
+        e2d::Logger::enableAsync();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            e2d::log::warn("Pending {}", i);
+        }
+        e2d::Logger::disableAsync();
+
+        REQUIRE(output.countLines() == 100);
+        REQUIRE(output.str().find("Pending 99") != std::string::npos);
+    }
+}
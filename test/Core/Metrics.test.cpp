@@ -0,0 +1,139 @@
+/**
+ * @file Metrics.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Metrics Tests", "[Metrics]")
+{
+    SECTION("Counter sums increments from many threads")
+    {
+        e2d::Counter counter;
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < 8; ++thread)
+        {
+            threads.emplace_back(
+                [&counter]()
+                {
+                    for (int i = 0; i < 10000; ++i)
+                    {
+                        counter.increment();
+                    }
+                    counter.increment(5);
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(counter.getValue() == 8 * 10005);
+
+        counter.reset();
+        REQUIRE(counter.getValue() == 0);
+    }
+
+    SECTION("Gauge goes up and down")
+    {
+        e2d::Gauge gauge;
+        gauge.add(3);
+        gauge.add(-5);
+        REQUIRE(gauge.getValue() == -2);
+
+        gauge.set(42);
+        REQUIRE(gauge.getValue() == 42);
+    }
+
+    SECTION("Histogram percentiles are within its precision")
+    {
+        e2d::Histogram histogram;
+        REQUIRE(histogram.getPercentile(50.0) == 0);
+        REQUIRE(histogram.getSnapshot().count == 0);
+
+        for (std::uint64_t value = 1; value <= 10000; ++value)
+        {
+            histogram.record(value);
+        }
+
+        const auto snapshot = histogram.getSnapshot();
+        REQUIRE(snapshot.count == 10000);
+        REQUIRE(snapshot.sum == 50005000);
+        REQUIRE(snapshot.min == 1);
+        REQUIRE(snapshot.max == 10000);
+        REQUIRE(snapshot.p50 >= 5000);
+        REQUIRE(snapshot.p50 <= 5000 + 5000 / 16);
+        REQUIRE(snapshot.p99 >= 9900);
+        REQUIRE(snapshot.p99 <= 10000);
+        REQUIRE(histogram.getPercentile(100.0) == 10000);
+        REQUIRE(histogram.getPercentile(0.0) == 1);
+
+        // Small values are exact
+        e2d::Histogram small;
+        small.record(7);
+        small.record(7);
+        small.record(9);
+        REQUIRE(small.getPercentile(50.0) == 7);
+        REQUIRE(small.getPercentile(99.0) == 9);
+
+        // The whole range of 64-bit values can be recorded
+        small.record(std::numeric_limits<std::uint64_t>::max());
+        REQUIRE(small.getPercentile(100.0) == std::numeric_limits<std::uint64_t>::max());
+
+        histogram.reset();
+        REQUIRE(histogram.getCount() == 0);
+    }
+
+    SECTION("Registered metrics show up in snapshots")
+    {
+        auto& counter   = e2d::Metrics::getCounter("test.counter");
+        auto& gauge     = e2d::Metrics::getGauge("test.gauge");
+        auto& histogram = e2d::Metrics::getHistogram("test.histogram");
+        REQUIRE(&counter == &e2d::Metrics::getCounter("test.counter"));
+
+        counter.increment(3);
+        gauge.set(-7);
+        histogram.record(20);
+
+        auto snapshot = e2d::Metrics::getSnapshot();
+        REQUIRE(snapshot.counters.at("test.counter") == 3);
+        REQUIRE(snapshot.gauges.at("test.gauge") == -7);
+        REQUIRE(snapshot.histograms.at("test.histogram").count == 1);
+        REQUIRE(snapshot.histograms.at("test.histogram").p50 == 20);
+
+        e2d::Metrics::reset();
+        snapshot = e2d::Metrics::getSnapshot();
+        REQUIRE(snapshot.counters.at("test.counter") == 0);
+        REQUIRE(snapshot.gauges.at("test.gauge") == -7);
+        REQUIRE(snapshot.histograms.at("test.histogram").count == 0);
+    }
+}
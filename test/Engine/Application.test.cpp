@@ -45,4 +45,13 @@ TEST_CASE("Application Tests", "[Application]")
         const ApplicationTestApplication application;
         REQUIRE_FALSE(application.isRunning());
     }
+
+    SECTION("Frame rate limit")
+    {
+        ApplicationTestApplication application;
+        REQUIRE(application.getFrameRateLimit() == 60);
+
+        application.setFrameRateLimit(0);
+        REQUIRE(application.getFrameRateLimit() == 0);
+    }
 }
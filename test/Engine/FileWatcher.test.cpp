@@ -0,0 +1,129 @@
+/**
+ * @file FileWatcher.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/FileWatcher.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+void writeFile(const std::filesystem::path& filepath, const std::string& content)
+{
+    std::ofstream file(filepath, std::ios::trunc);
+    file << content;
+}
+
+template <typename Predicate>
+bool waitFor(Predicate predicate)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+} // namespace
+
+TEST_CASE("FileWatcher Tests", "[FileWatcher]")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "e2d-file-watcher-test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    const auto watchedFile   = directory / "watched.txt";
+    const auto unwatchedFile = directory / "unwatched.txt";
+    writeFile(watchedFile, "initial");
+    writeFile(unwatchedFile, "initial");
+
+    std::mutex               mutex;
+    std::vector<std::string> modified;
+
+    e2d::internal::FileWatcher watcher(
+        [&mutex, &modified](const std::string& filepath)
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            modified.push_back(filepath);
+        });
+    watcher.watch(watchedFile.string());
+
+    const auto modifiedFiles = [&mutex, &modified]()
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return modified;
+    };
+
+    SECTION("The watcher starts and stops")
+    {
+        REQUIRE(watcher.start());
+        REQUIRE(watcher.isRunning());
+        watcher.stop();
+        REQUIRE_FALSE(watcher.isRunning());
+    }
+
+    SECTION("A modification of a watched file is reported with the path it was watched as")
+    {
+        REQUIRE(watcher.start());
+
+        // Make sure the modification time differs even on file systems with coarse timestamps
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        writeFile(watchedFile, "modified");
+        std::filesystem::last_write_time(watchedFile,
+                                         std::filesystem::last_write_time(watchedFile) + std::chrono::seconds(1));
+
+        REQUIRE(waitFor([&modifiedFiles]() { return !modifiedFiles().empty(); }));
+        watcher.stop();
+
+        const auto files = modifiedFiles();
+        REQUIRE(files.size() == 1);
+        REQUIRE(files.front() == watchedFile.string());
+    }
+
+    SECTION("Modifications of files that are not watched are not reported")
+    {
+        REQUIRE(watcher.start());
+
+        writeFile(unwatchedFile, "modified");
+        std::filesystem::last_write_time(unwatchedFile,
+                                         std::filesystem::last_write_time(unwatchedFile) + std::chrono::seconds(1));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(700));
+        watcher.stop();
+
+        REQUIRE(modifiedFiles().empty());
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,164 @@
+/**
+ * @file InputRecording.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/InputRecording.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace
+{
+e2d::Event makeKeyEvent(e2d::Event::EventType type, e2d::Keyboard::Key code, bool shift)
+{
+    e2d::Event event{};
+    event.type         = type;
+    event.key.code     = code;
+    event.key.scancode = e2d::Keyboard::Scancode::Unknown;
+    event.key.shift    = shift;
+    return event;
+}
+
+e2d::Event makeResizedEvent(unsigned int width, unsigned int height)
+{
+    e2d::Event event{};
+    event.type        = e2d::Event::Resized;
+    event.size.width  = width;
+    event.size.height = height;
+    return event;
+}
+} // namespace
+
+TEST_CASE("InputRecording Tests", "[InputRecording]")
+{
+    SECTION("Encoding and decoding a frame")
+    {
+        e2d::internal::RecordedFrame frame;
+        frame.deltaTime = 16666667;
+        frame.events.push_back(makeKeyEvent(e2d::Event::KeyPressed, e2d::Keyboard::Key::Left, true));
+        frame.events.push_back(makeResizedEvent(1920, 1080));
+        e2d::Event focus{};
+        focus.type = e2d::Event::LostFocus;
+        frame.events.push_back(focus);
+
+        std::string data;
+        e2d::internal::InputRecorder::encodeFrame(data, frame);
+
+        e2d::internal::RecordedFrame decoded;
+        std::size_t                  pos = 0;
+        REQUIRE(e2d::internal::InputPlayer::decodeFrame(data, pos, decoded));
+        REQUIRE(pos == data.size());
+        REQUIRE(decoded.deltaTime == frame.deltaTime);
+        REQUIRE(decoded.events.size() == 3);
+        REQUIRE(decoded.events[0].is<e2d::Event::KeyPressed>());
+        REQUIRE(decoded.events[0].key.code == e2d::Keyboard::Key::Left);
+        REQUIRE(decoded.events[0].key.scancode == e2d::Keyboard::Scancode::Unknown);
+        REQUIRE(decoded.events[0].key.shift);
+        REQUIRE_FALSE(decoded.events[0].key.control);
+        REQUIRE(decoded.events[1].is<e2d::Event::Resized>());
+        REQUIRE(decoded.events[1].size.width == 1920);
+        REQUIRE(decoded.events[1].size.height == 1080);
+        REQUIRE(decoded.events[2].is<e2d::Event::LostFocus>());
+    }
+
+    SECTION("Idle frames are compact")
+    {
+        e2d::internal::RecordedFrame frame;
+        frame.deltaTime = 16666667;
+
+        std::string data;
+        e2d::internal::InputRecorder::encodeFrame(data, frame);
+        REQUIRE(data.size() == 5);
+    }
+
+    SECTION("Truncated frames are rejected")
+    {
+        e2d::internal::RecordedFrame frame;
+        frame.events.push_back(makeKeyEvent(e2d::Event::KeyReleased, e2d::Keyboard::Key::A, false));
+
+        std::string data;
+        e2d::internal::InputRecorder::encodeFrame(data, frame);
+        data.pop_back();
+
+        e2d::internal::RecordedFrame decoded;
+        std::size_t                  pos = 0;
+        REQUIRE_FALSE(e2d::internal::InputPlayer::decodeFrame(data, pos, decoded));
+        REQUIRE(pos == 0);
+    }
+
+    SECTION("Recording and replaying a file")
+    {
+        const auto filepath = std::filesystem::temp_directory_path() / "e2d-input-recording-test.bin";
+
+        {
+            e2d::internal::InputRecorder recorder;
+            REQUIRE(recorder.open(filepath.string()));
+            for (std::uint64_t i = 0; i < 100; ++i)
+            {
+                e2d::internal::RecordedFrame frame;
+                frame.deltaTime = 16000000 + i;
+                if (i % 10 == 0)
+                {
+                    frame.events.push_back(makeKeyEvent(e2d::Event::KeyPressed, e2d::Keyboard::Key::Up, false));
+                }
+                REQUIRE(recorder.record(frame));
+            }
+            REQUIRE(recorder.getFrameCount() == 100);
+        }
+
+        e2d::internal::InputPlayer player;
+        REQUIRE(player.open(filepath.string()));
+
+        e2d::internal::RecordedFrame frame;
+        for (std::uint64_t i = 0; i < 100; ++i)
+        {
+            REQUIRE(player.next(frame));
+            REQUIRE(frame.deltaTime == 16000000 + i);
+            REQUIRE(frame.events.size() == (i % 10 == 0 ? 1 : 0));
+        }
+        REQUIRE_FALSE(player.next(frame));
+        REQUIRE(player.getFrameCount() == 100);
+
+        std::filesystem::remove(filepath);
+    }
+
+    SECTION("Files that are not recordings are rejected")
+    {
+        const auto filepath = std::filesystem::temp_directory_path() / "e2d-input-recording-invalid.bin";
+        {
+            std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+            file << "not a recording";
+        }
+
+        e2d::internal::InputPlayer player;
+        REQUIRE_FALSE(player.open(filepath.string()));
+        REQUIRE_FALSE(player.open((filepath.parent_path() / "e2d-input-recording-missing.bin").string()));
+
+        std::filesystem::remove(filepath);
+    }
+}
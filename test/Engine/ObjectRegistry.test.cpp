@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <E2D/Core/Metrics.hpp>
+
 #include <E2D/Engine/ObjectRegistry.hpp>
 #include <E2D/Engine/Sprite.hpp>
 
@@ -102,4 +104,19 @@ TEST_CASE("ObjectRegistry Tests", "[ObjectRegistry]")
         REQUIRE(nonSprites.size() == 1);
         REQUIRE(nonSprites[0]->getIdentifier() == "NonSprite");
     }
+
+    SECTION("Counting Objects Alive")
+    {
+        const auto& objectsAlive = e2d::Metrics::getGauge("objects.alive");
+        const auto  before       = objectsAlive.getValue();
+
+        objectRegistry.createObject<MyObject>("Counted1");
+        objectRegistry.createObject<MyObject>("Counted2");
+        REQUIRE(objectsAlive.getValue() == before + 2);
+
+        objectRegistry.removeObject("Counted1");
+        objectRegistry.clean();
+        REQUIRE(objectsAlive.getValue() == before + 1);
+        REQUIRE(e2d::Metrics::getSnapshot().gauges.at("objects.alive") == before + 1);
+    }
 }
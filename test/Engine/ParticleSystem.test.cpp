@@ -0,0 +1,130 @@
+/**
+ * @file ParticleSystem.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/ParticleSystem.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+e2d::ParticleEmitter makeEmitter()
+{
+    // Every particle moves right at 100 pixels per second for one second
+    e2d::ParticleEmitter emitter;
+    emitter.position    = {100, 100};
+    emitter.spread      = 0;
+    emitter.minSpeed    = 100;
+    emitter.maxSpeed    = 100;
+    emitter.minLifetime = 1;
+    emitter.maxLifetime = 1;
+    emitter.minSize     = 10;
+    emitter.maxSize     = 10;
+    emitter.color       = e2d::Color::Green;
+    return emitter;
+}
+} // namespace
+
+TEST_CASE("ParticleSystem Simulation", "[ParticleSystem]")
+{
+    e2d::ParticleSystem particles;
+    particles.setEmitter(makeEmitter());
+
+    SECTION("A particle system is empty initially")
+    {
+        REQUIRE(particles.getCount() == 0);
+        REQUIRE(particles.getCapacity() == 10000);
+        REQUIRE(particles.getEmissionRate() == 0);
+    }
+
+    SECTION("Bursts are limited by the capacity")
+    {
+        particles.setCapacity(20);
+        REQUIRE(particles.burst(13) == 13);
+        REQUIRE(particles.burst(13) == 7);
+        REQUIRE(particles.getCount() == 20);
+
+        particles.setCapacity(5);
+        REQUIRE(particles.getCount() == 5);
+
+        particles.clear();
+        REQUIRE(particles.getCount() == 0);
+    }
+
+    SECTION("Particles expire at the end of their lifetime")
+    {
+        REQUIRE(particles.burst(13) == 13);
+        particles.update(0.5f);
+        REQUIRE(particles.getCount() == 13);
+        particles.update(0.6f);
+        REQUIRE(particles.getCount() == 0);
+    }
+
+    SECTION("Particles are emitted continuously at the emission rate")
+    {
+        particles.setEmissionRate(100);
+        particles.update(0.105f);
+        REQUIRE(particles.getCount() == 10);
+        particles.update(0.1f);
+        REQUIRE(particles.getCount() == 20);
+    }
+}
+
+TEST_CASE("ParticleSystem Rendering", "[ParticleSystem]")
+{
+    auto& rendererContext = e2d::internal::RendererContext::getInstance();
+    REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+    auto& renderer = rendererContext.getRenderer();
+    renderer.setCaptureEnabled(true);
+
+    const auto& drawCalls = e2d::Metrics::getCounter("renderer.draw_calls");
+
+    SECTION("All particles are drawn with one draw call")
+    {
+        e2d::ParticleSystem particles;
+        particles.setEmitter(makeEmitter());
+        particles.setFadeOut(false);
+
+        // Not a multiple of the SIMD width, so some particles are moved by the scalar loop
+        REQUIRE(particles.burst(1003) == 1003);
+        particles.update(0.5f);
+
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&particles);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls + 1);
+        REQUIRE(renderer.getCapturedFrame().getPixel(100, 100) == e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(150, 100) == e2d::Color::Green);
+    }
+
+    renderer.setCaptureEnabled(false);
+    rendererContext.destroy();
+}
@@ -0,0 +1,108 @@
+/**
+ * @file RenderCommandBuffer.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/RenderCommandBuffer.hpp>
+#include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/Vertex.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::vector<e2d::Vertex> makeTriangle(float x)
+{
+    return {{{x, 0}, e2d::Color::Red, {}}, {{x + 10, 0}, e2d::Color::Red, {}}, {{x, 10}, e2d::Color::Red, {}}};
+}
+} // namespace
+
+TEST_CASE("RenderCommandBuffer Tests", "[RenderCommandBuffer]")
+{
+    e2d::RenderCommandBuffer buffer;
+
+    SECTION("A buffer is empty initially")
+    {
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.getCommandCount() == 0);
+    }
+
+    SECTION("Sprites without a texture are not recorded")
+    {
+        const e2d::Sprite sprite;
+        buffer.drawSprite(sprite);
+        REQUIRE(buffer.isEmpty());
+    }
+
+    SECTION("Geometry is recorded as a single command")
+    {
+        buffer.drawGeometry(nullptr, makeTriangle(0));
+        buffer.drawGeometry(nullptr, makeTriangle(20), {0, 1, 2}, 5);
+        buffer.drawGeometry(nullptr, {});
+        REQUIRE_FALSE(buffer.isEmpty());
+        REQUIRE(buffer.getCommandCount() == 2);
+    }
+
+    SECTION("Clearing removes all commands")
+    {
+        buffer.setClip({{0, 0}, {5, 5}});
+        buffer.drawGeometry(nullptr, makeTriangle(0));
+        buffer.resetClip();
+        buffer.drawGeometry(nullptr, makeTriangle(0));
+        buffer.clear();
+        REQUIRE(buffer.isEmpty());
+
+        buffer.drawGeometry(nullptr, makeTriangle(0));
+        REQUIRE(buffer.getCommandCount() == 1);
+    }
+
+    SECTION("Buffers are recorded in parallel")
+    {
+        std::vector<e2d::RenderCommandBuffer> buffers(4);
+        std::vector<std::thread>              workers;
+        for (auto& workerBuffer : buffers)
+        {
+            workers.emplace_back(
+                [&workerBuffer]
+                {
+                    for (int i = 0; i < 1000; ++i)
+                    {
+                        workerBuffer.drawGeometry(nullptr, makeTriangle(static_cast<float>(i)), {}, i);
+                    }
+                });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (const auto& workerBuffer : buffers)
+        {
+            REQUIRE(workerBuffer.getCommandCount() == 1000);
+        }
+    }
+}
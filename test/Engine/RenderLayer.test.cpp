@@ -0,0 +1,310 @@
+/**
+ * @file RenderLayer.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/Renderable.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderLayer.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/Transformable.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+class EmptyRenderable final : public e2d::Renderable
+{
+public:
+    void render() const final
+    {
+    }
+};
+
+class OrderedRenderable final : public e2d::Renderable, public e2d::Transformable
+{
+public:
+    OrderedRenderable(int id, std::vector<int>& order) : m_id(id), m_order(order)
+    {
+    }
+
+    void render() const final
+    {
+        this->m_order.push_back(this->m_id);
+    }
+
+    e2d::Vector2f getSize() const final
+    {
+        return {};
+    }
+
+private:
+    int               m_id;
+    std::vector<int>& m_order;
+};
+} // namespace
+
+TEST_CASE("RenderLayer Membership", "[RenderLayer]")
+{
+    e2d::RenderLayer layer("Background");
+    EmptyRenderable  renderable;
+
+    SECTION("Renderables are added and removed")
+    {
+        REQUIRE(layer.getName() == "Background");
+        REQUIRE(layer.getCount() == 0);
+
+        REQUIRE(layer.add(renderable));
+        REQUIRE(layer.contains(renderable));
+        REQUIRE(renderable.getLayer() == &layer);
+        REQUIRE(layer.getCount() == 1);
+
+        REQUIRE(layer.remove(renderable));
+        REQUIRE_FALSE(layer.remove(renderable));
+        REQUIRE_FALSE(layer.contains(renderable));
+        REQUIRE(renderable.getLayer() == nullptr);
+    }
+
+    SECTION("A renderable is only in one layer")
+    {
+        e2d::RenderLayer other("Foreground");
+        REQUIRE(layer.add(renderable));
+        REQUIRE(other.add(renderable));
+        REQUIRE_FALSE(layer.contains(renderable));
+        REQUIRE(other.contains(renderable));
+        REQUIRE(layer.getCount() == 0);
+    }
+
+    SECTION("Layers cannot be nested")
+    {
+        e2d::RenderLayer other("Foreground");
+        REQUIRE_FALSE(layer.add(other));
+        REQUIRE(other.getLayer() == nullptr);
+    }
+
+    SECTION("Destroyed renderables leave their layer")
+    {
+        auto temporary = std::make_unique<EmptyRenderable>();
+        REQUIRE(layer.add(*temporary));
+        temporary.reset();
+        REQUIRE(layer.getCount() == 0);
+    }
+}
+
+TEST_CASE("RenderLayer Sorting", "[RenderLayer]")
+{
+    std::vector<int>  order;
+    OrderedRenderable first(1, order);
+    OrderedRenderable second(2, order);
+    OrderedRenderable third(3, order);
+
+    e2d::RenderLayer layer("Characters");
+    REQUIRE(layer.add(first));
+    REQUIRE(layer.add(second));
+    REQUIRE(layer.add(third));
+
+    const auto drawOrder = [&layer, &order]
+    {
+        order.clear();
+        layer.render();
+        return order;
+    };
+
+    SECTION("Renderables are sorted by render priority by default")
+    {
+        REQUIRE(layer.getSortMode() == e2d::RenderLayer::SortMode::Priority);
+        first.setRenderPriority(2);
+        third.setRenderPriority(1);
+        REQUIRE(drawOrder() == std::vector<int>{2, 3, 1});
+    }
+
+    SECTION("Renderables are kept in the order they were added")
+    {
+        layer.setSortMode(e2d::RenderLayer::SortMode::None);
+        first.setRenderPriority(2);
+        REQUIRE(drawOrder() == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Renderables are sorted by Y position as they move")
+    {
+        layer.setSortMode(e2d::RenderLayer::SortMode::PositionY);
+        first.setPosition({0, 30});
+        second.setPosition({0, 10});
+        third.setPosition({0, 20});
+        REQUIRE(drawOrder() == std::vector<int>{2, 3, 1});
+
+        second.setPosition({0, 25});
+        REQUIRE(drawOrder() == std::vector<int>{3, 2, 1});
+
+        first.setPosition({0, 25});
+        REQUIRE(drawOrder() == std::vector<int>{3, 2, 1});
+
+        first.setPosition({0, 0});
+        REQUIRE(drawOrder() == std::vector<int>{1, 3, 2});
+    }
+
+    SECTION("Renderables are sorted by a custom key")
+    {
+        REQUIRE_THROWS_AS(layer.setSortMode(e2d::RenderLayer::SortMode::Custom), std::runtime_error);
+        REQUIRE_THROWS_AS(layer.setSortKey({}), std::runtime_error);
+
+        layer.setSortKey([](const e2d::Renderable& renderable)
+                         { return -static_cast<const OrderedRenderable&>(renderable).getPosition().x; });
+        REQUIRE(layer.getSortMode() == e2d::RenderLayer::SortMode::Custom);
+        first.setPosition({10, 0});
+        second.setPosition({30, 0});
+        third.setPosition({20, 0});
+        REQUIRE(drawOrder() == std::vector<int>{2, 3, 1});
+    }
+
+    SECTION("Added renderables are sorted into place")
+    {
+        layer.setSortMode(e2d::RenderLayer::SortMode::PositionY);
+        first.setPosition({0, 10});
+        second.setPosition({0, 20});
+        third.setPosition({0, 30});
+        REQUIRE(drawOrder() == std::vector<int>{1, 2, 3});
+
+        OrderedRenderable fourth(4, order);
+        fourth.setPosition({0, 15});
+        REQUIRE(layer.add(fourth));
+        REQUIRE(drawOrder() == std::vector<int>{1, 4, 2, 3});
+
+        REQUIRE(layer.remove(second));
+        REQUIRE(drawOrder() == std::vector<int>{1, 4, 3});
+    }
+}
+
+TEST_CASE("RenderLayer Caching", "[RenderLayer]")
+{
+    auto& rendererContext = e2d::internal::RendererContext::getInstance();
+    REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+    auto& renderer = rendererContext.getRenderer();
+    renderer.setCaptureEnabled(true);
+
+    e2d::RenderTexture square;
+    REQUIRE(square.create({10, 10}));
+    REQUIRE(square.clear(e2d::Color::Green));
+
+    e2d::Sprite sprite;
+    sprite.setTexture(square.getTexture());
+    sprite.setTextureRect({{0, 0}, {10, 10}});
+
+    e2d::RenderLayer layer("Background");
+    layer.setStatic(true);
+    REQUIRE(layer.add(sprite));
+
+    const auto& bakes = e2d::Metrics::getCounter("renderer.layer_bakes");
+    const auto  first = bakes.getValue();
+
+    SECTION("A static layer is only rendered again when it changes")
+    {
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 1);
+        REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Green);
+
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 1);
+        REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Green);
+
+        sprite.setPosition({20, 0});
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 2);
+        REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(25, 5) == e2d::Color::Green);
+
+        layer.invalidate();
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 3);
+    }
+
+    SECTION("A static layer does not draw its renderables until it changes")
+    {
+        std::vector<int>  order;
+        OrderedRenderable counted(1, order);
+        REQUIRE(layer.add(counted));
+
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(order == std::vector<int>{1});
+        REQUIRE(bakes.getValue() == first + 1);
+
+        counted.setRenderPriority(1);
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(order == std::vector<int>{1, 1});
+        REQUIRE(bakes.getValue() == first + 2);
+    }
+
+    SECTION("Changed texture pixels are noticed in the frame they are drawn")
+    {
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 1);
+
+        const auto revision = square.getTexture()->getRevision();
+        REQUIRE(square.clear(e2d::Color::Blue));
+        REQUIRE(square.getTexture()->getRevision() != revision);
+
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 2);
+        REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Blue);
+
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 2);
+    }
+
+    SECTION("A layer that is not static draws its renderables directly")
+    {
+        layer.setStatic(false);
+        renderer.draw(&layer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first);
+        REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Green);
+    }
+
+    renderer.setCaptureEnabled(false);
+    layer.setStatic(false);
+    square.destroy();
+    rendererContext.destroy();
+}
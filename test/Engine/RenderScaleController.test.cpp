@@ -0,0 +1,82 @@
+/**
+ * @file RenderScaleController.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RenderScaleController.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+
+namespace
+{
+float runFrames(e2d::internal::RenderScaleController& controller, double frameTime, float renderScale)
+{
+    for (std::size_t i = 0; i < e2d::internal::RenderScaleController::SampleCount; ++i)
+    {
+        renderScale = controller.update(frameTime, renderScale);
+    }
+    return renderScale;
+}
+} // namespace
+
+TEST_CASE("RenderScaleController", "[RenderScaleController]")
+{
+    e2d::internal::RenderScaleController controller;
+
+    SECTION("Without a budget the render scale is kept")
+    {
+        REQUIRE(controller.getBudget() == 0);
+        REQUIRE(runFrames(controller, 1.0, 0.8f) == 0.8f);
+    }
+
+    SECTION("Over budget the render scale is lowered by the share of pixels that have to go")
+    {
+        controller.setBudget(0.25);
+        REQUIRE(controller.update(1.0, 1.f) == 1.f);
+        REQUIRE(runFrames(controller, 1.0, 1.f) == 0.5f);
+    }
+
+    SECTION("The render scale is kept within the budget and its headroom")
+    {
+        controller.setBudget(0.010);
+        REQUIRE(runFrames(controller, 0.009, 0.5f) == 0.5f);
+    }
+
+    SECTION("Well within budget the render scale is raised in steps")
+    {
+        controller.setBudget(0.010);
+        const auto raised = runFrames(controller, 0.001, 0.5f);
+        REQUIRE(raised == 0.5f + e2d::internal::RenderScaleController::RaiseStep);
+        REQUIRE(runFrames(controller, 0.001, 1.f) == 1.f);
+    }
+
+    SECTION("The render scale is not lowered below the minimum")
+    {
+        controller.setBudget(0.001);
+        REQUIRE(runFrames(controller, 1.0, 0.5f) == e2d::internal::Renderer::MinRenderScale);
+    }
+}
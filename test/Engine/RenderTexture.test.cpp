@@ -0,0 +1,119 @@
+/**
+ * @file RenderTexture.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/RenderCommandBuffer.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+class RenderTextureTest
+{
+public:
+    RenderTextureTest()
+    {
+        // Setup (runs before each SECTION)
+        e2d::internal::RendererContext::getInstance().initialize(e2d::RenderMode::Headless);
+        e2d::internal::RendererContext::getInstance().getRenderer().setCaptureEnabled(true);
+    }
+
+    ~RenderTextureTest()
+    {
+        e2d::internal::RendererContext::getInstance().getRenderer().setCaptureEnabled(false);
+        e2d::internal::RendererContext::getInstance().destroy();
+    }
+};
+
+TEST_CASE_METHOD(RenderTextureTest, "RenderTexture Tests", "[RenderTexture]")
+{
+    auto&              renderer = e2d::internal::RendererContext::getInstance().getRenderer();
+    e2d::RenderTexture renderTexture;
+
+    SECTION("A render texture is not loaded initially")
+    {
+        REQUIRE_FALSE(renderTexture.isLoaded());
+        REQUIRE_FALSE(renderTexture.clear(e2d::Color::Red));
+        REQUIRE(renderTexture.getTexture() != nullptr);
+    }
+
+    SECTION("A created render texture is drawn by sprites")
+    {
+        REQUIRE(renderTexture.create({100, 50}));
+        REQUIRE(renderTexture.isLoaded());
+        REQUIRE(renderTexture.getSize() == e2d::Vector2i(100, 50));
+        REQUIRE(renderTexture.clear(e2d::Color::Green));
+
+        e2d::Sprite sprite;
+        sprite.setTexture(renderTexture.getTexture());
+        sprite.setTextureRect({{0, 0}, {100, 50}});
+        renderer.draw(&sprite);
+        renderer.render(e2d::Color::Red);
+
+        const auto& capture = renderer.getCapturedFrame();
+        REQUIRE(capture.getPixel(50, 25) == e2d::Color::Green);
+        REQUIRE(capture.getPixel(150, 25) == e2d::Color::Red);
+    }
+
+    SECTION("Command buffers are drawn into a render texture")
+    {
+        REQUIRE(renderTexture.create({100, 100}));
+
+        const std::vector<e2d::Vertex> triangle = {{{0, 0}, e2d::Color::Blue, {}},
+                                                   {{100, 0}, e2d::Color::Blue, {}},
+                                                   {{0, 100}, e2d::Color::Blue, {}}};
+
+        e2d::RenderCommandBuffer buffer;
+        buffer.drawGeometry(nullptr, triangle);
+        REQUIRE(renderTexture.draw(buffer));
+
+        e2d::Sprite sprite;
+        sprite.setTexture(renderTexture.getTexture());
+        sprite.setTextureRect({{0, 0}, {100, 100}});
+        renderer.draw(&sprite);
+        renderer.render(e2d::Color::Red);
+
+        // The lower right half of the texture stays transparent
+        const auto& capture = renderer.getCapturedFrame();
+        REQUIRE(capture.getPixel(10, 10) == e2d::Color::Blue);
+        REQUIRE(capture.getPixel(90, 90) == e2d::Color::Red);
+    }
+
+    SECTION("A render texture is loaded from an image")
+    {
+        e2d::Texture image;
+        REQUIRE(image.loadFromFile("resources/hello-world.png"));
+
+        REQUIRE(renderTexture.loadFromFile("resources/hello-world.png"));
+        REQUIRE(renderTexture.getSize() == image.getSize());
+        REQUIRE_FALSE(renderTexture.loadFromFile("resources/does-not-exist.png"));
+    }
+}
@@ -24,12 +24,35 @@
  * THE SOFTWARE.
  */
 
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/RenderCommandBuffer.hpp>
 #include <E2D/Engine/Renderer.hpp>
 #include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RendererSettings.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/ScaleFilter.hpp>
 #include <E2D/Engine/Window.hpp>
+#include <E2D/Engine/WindowSettings.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <vector>
+
+namespace
+{
+std::vector<e2d::Vertex> makeQuad(const e2d::FloatRect& rectangle, const e2d::Color& color)
+{
+    const auto right  = rectangle.left + rectangle.width;
+    const auto bottom = rectangle.top + rectangle.height;
+    return {{{rectangle.left, rectangle.top}, color, {}},
+            {{right, rectangle.top}, color, {}},
+            {{right, bottom}, color, {}},
+            {{rectangle.left, bottom}, color, {}}};
+}
+} // namespace
+
 TEST_CASE("RendererContext Initialization and Destruction", "[RendererContext]")
 {
     SECTION("Initialize RendererContext")
@@ -63,4 +86,219 @@ TEST_CASE("RendererContext Initialization and Destruction", "[RendererContext]")
         REQUIRE_FALSE(rendererContext.getWindow().isCreated());
         REQUIRE_FALSE(rendererContext.getRenderer().isCreated());
     }
+
+    SECTION("Initialize headless RendererContext")
+    {
+        auto& rendererContext = e2d::internal::RendererContext::getInstance();
+
+        REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+        REQUIRE(rendererContext.isInitialized());
+        REQUIRE(rendererContext.getRenderMode() == e2d::RenderMode::Headless);
+        REQUIRE_FALSE(rendererContext.getWindow().isCreated());
+        REQUIRE(rendererContext.getRenderer().isCreated());
+
+        rendererContext.destroy();
+
+        REQUIRE_FALSE(rendererContext.isInitialized());
+        REQUIRE_FALSE(rendererContext.getRenderer().isCreated());
+    }
+
+    SECTION("Capture headless frame")
+    {
+        auto& rendererContext = e2d::internal::RendererContext::getInstance();
+        REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+        auto& renderer = rendererContext.getRenderer();
+        REQUIRE_FALSE(renderer.isCaptureEnabled());
+        REQUIRE(renderer.getCapturedFrame().pixels.empty());
+
+        renderer.setCaptureEnabled(true);
+        renderer.render(e2d::Color::Red);
+
+        const e2d::FrameCapture& capture = renderer.getCapturedFrame();
+        REQUIRE(capture.size == e2d::Vector2i(800, 600));
+        REQUIRE(capture.pixels.size() == 800 * 600 * 4);
+        REQUIRE(capture.getPixel(0, 0) == e2d::Color::Red);
+        REQUIRE(capture.getPixel(799, 599) == e2d::Color::Red);
+
+        renderer.setCaptureEnabled(false);
+        rendererContext.destroy();
+    }
+
+    SECTION("Capture headless frame of a custom size")
+    {
+        auto& rendererContext = e2d::internal::RendererContext::getInstance();
+
+        e2d::WindowSettings windowSettings;
+        windowSettings.size = {320, 240};
+        e2d::RendererSettings rendererSettings;
+        rendererSettings.batching      = false;
+        rendererSettings.textureFilter = e2d::ScaleFilter::Linear;
+        REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless, "Test", windowSettings, rendererSettings));
+
+        auto& renderer = rendererContext.getRenderer();
+        REQUIRE(renderer.getOutputSize() == e2d::Vector2i(320, 240));
+
+        renderer.setCaptureEnabled(true);
+        renderer.render(e2d::Color::Blue);
+
+        const e2d::FrameCapture& capture = renderer.getCapturedFrame();
+        REQUIRE(capture.size == e2d::Vector2i(320, 240));
+        REQUIRE(capture.getPixel(319, 239) == e2d::Color::Blue);
+
+        renderer.setCaptureEnabled(false);
+        rendererContext.destroy();
+    }
+
+    SECTION("Redraw only what changed")
+    {
+        auto& rendererContext = e2d::internal::RendererContext::getInstance();
+        REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+        auto& renderer = rendererContext.getRenderer();
+        renderer.setCaptureEnabled(true);
+        REQUIRE(renderer.setPartialRedraw(true));
+        REQUIRE(renderer.isPartialRedraw());
+
+        const auto& drawCalls = e2d::Metrics::getCounter("renderer.draw_calls");
+        const auto& skipped   = e2d::Metrics::getCounter("renderer.frames_skipped");
+
+        const std::vector<int>   quad = {0, 1, 2, 0, 2, 3};
+        e2d::RenderCommandBuffer buffer;
+        const auto               drawFrame = [&](float greenTop, const e2d::Color& background)
+        {
+            buffer.clear();
+            buffer.drawGeometry(nullptr, makeQuad({{0, greenTop}, {100, 100}}, e2d::Color::Green), quad, 0);
+            buffer.drawGeometry(nullptr, makeQuad({{400, 0}, {100, 100}}, e2d::Color::Blue), quad, 0);
+            renderer.submit(buffer);
+            renderer.render(background);
+        };
+
+        auto calls = drawCalls.getValue();
+        drawFrame(0, e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls + 2);
+        REQUIRE(renderer.getCapturedFrame().getPixel(50, 50) == e2d::Color::Green);
+        REQUIRE(renderer.getCapturedFrame().getPixel(450, 50) == e2d::Color::Blue);
+        REQUIRE(renderer.getCapturedFrame().getPixel(700, 500) == e2d::Color::Red);
+
+        // Nothing changed, so the frame is not drawn or presented
+        const auto frame = renderer.getCapturedFrame().frame;
+        const auto skips = skipped.getValue();
+        calls            = drawCalls.getValue();
+        drawFrame(0, e2d::Color::Red);
+        REQUIRE(skipped.getValue() == skips + 1);
+        REQUIRE(drawCalls.getValue() == calls);
+        REQUIRE(renderer.getCapturedFrame().frame == frame);
+
+        // Only the green quad is drawn again, as the blue one is outside of the area it left and entered
+        drawFrame(200, e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls + 1);
+        REQUIRE(renderer.getCapturedFrame().getPixel(50, 50) == e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(50, 250) == e2d::Color::Green);
+        REQUIRE(renderer.getCapturedFrame().getPixel(450, 50) == e2d::Color::Blue);
+
+        // A new background color redraws everything
+        calls = drawCalls.getValue();
+        drawFrame(200, e2d::Color::Yellow);
+        REQUIRE(drawCalls.getValue() == calls + 2);
+        REQUIRE(renderer.getCapturedFrame().getPixel(700, 500) == e2d::Color::Yellow);
+
+        // A texture drawn into again keeps its address, but the area it covers is still drawn anew
+        e2d::RenderTexture texture;
+        REQUIRE(texture.create({4, 4}));
+        REQUIRE(texture.clear(e2d::Color::Green));
+        const auto drawTextured = [&]
+        {
+            buffer.clear();
+            buffer.drawGeometry(texture.getTexture(), makeQuad({{600, 400}, {100, 100}}, e2d::Color::White), quad, 0);
+            renderer.submit(buffer);
+            renderer.render(e2d::Color::Yellow);
+        };
+        drawTextured();
+        REQUIRE(renderer.getCapturedFrame().getPixel(650, 450) == e2d::Color::Green);
+        REQUIRE(texture.clear(e2d::Color::Blue));
+        drawTextured();
+        REQUIRE(renderer.getCapturedFrame().getPixel(650, 450) == e2d::Color::Blue);
+        texture.destroy();
+
+        REQUIRE(renderer.setPartialRedraw(false));
+        REQUIRE_FALSE(renderer.isPartialRedraw());
+        renderer.setCaptureEnabled(false);
+        rendererContext.destroy();
+    }
+
+    SECTION("Render at a reduced scale")
+    {
+        auto& rendererContext = e2d::internal::RendererContext::getInstance();
+        REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+        auto& renderer = rendererContext.getRenderer();
+        renderer.setCaptureEnabled(true);
+
+        renderer.setRenderScale(0.1f);
+        REQUIRE(renderer.getRenderScale() == e2d::internal::Renderer::MinRenderScale);
+        renderer.setRenderScale(0.5f);
+        renderer.setScaleFilter(e2d::ScaleFilter::Nearest);
+        REQUIRE(renderer.getScaleFilter() == e2d::ScaleFilter::Nearest);
+
+        const std::vector<int>   quad = {0, 1, 2, 0, 2, 3};
+        e2d::RenderCommandBuffer buffer;
+        buffer.drawGeometry(nullptr, makeQuad({{0, 0}, {400, 300}}, e2d::Color::Green), quad, 0);
+        renderer.submit(buffer);
+        renderer.render(e2d::Color::Red);
+
+        // Objects keep drawing in the coordinates of the screen, which is still captured at full size
+        REQUIRE(renderer.getOutputSize() == e2d::Vector2i(800, 600));
+        const e2d::FrameCapture& capture = renderer.getCapturedFrame();
+        REQUIRE(capture.size == e2d::Vector2i(800, 600));
+        REQUIRE(capture.getPixel(200, 150) == e2d::Color::Green);
+        REQUIRE(capture.getPixel(390, 290) == e2d::Color::Green);
+        REQUIRE(capture.getPixel(410, 310) == e2d::Color::Red);
+
+        // Partial redraw draws into the same reduced back buffer
+        REQUIRE(renderer.setPartialRedraw(true));
+        renderer.submit(buffer);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(200, 150) == e2d::Color::Green);
+        REQUIRE(renderer.getCapturedFrame().getPixel(600, 450) == e2d::Color::Red);
+
+        renderer.setRenderScale(1);
+        renderer.setCaptureEnabled(false);
+        rendererContext.destroy();
+    }
+
+    SECTION("Draw merged command buffers")
+    {
+        auto& rendererContext = e2d::internal::RendererContext::getInstance();
+        REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+        auto& renderer = rendererContext.getRenderer();
+        renderer.setCaptureEnabled(true);
+
+        const std::vector<int>   quad = {0, 1, 2, 0, 2, 3};
+        e2d::RenderCommandBuffer front;
+        e2d::RenderCommandBuffer back;
+        front.drawGeometry(nullptr, makeQuad({{0, 0}, {400, 600}}, e2d::Color::Green), quad, 1);
+        back.drawGeometry(nullptr, makeQuad({{0, 0}, {800, 600}}, e2d::Color::Blue), quad, 0);
+        back.setClip({{600, 0}, {200, 600}});
+        back.drawGeometry(nullptr, makeQuad({{0, 0}, {800, 600}}, e2d::Color::Yellow), quad, 0);
+
+        // The front buffer is submitted first, but its higher priority draws it on top
+        renderer.submit(front);
+        renderer.submit(back);
+        renderer.render(e2d::Color::Red);
+
+        const e2d::FrameCapture& capture = renderer.getCapturedFrame();
+        REQUIRE(capture.getPixel(200, 300) == e2d::Color::Green);
+        REQUIRE(capture.getPixel(500, 300) == e2d::Color::Blue);
+        REQUIRE(capture.getPixel(700, 300) == e2d::Color::Yellow);
+
+        // Submitted commands are only drawn with a single frame
+        renderer.render(e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(200, 300) == e2d::Color::Red);
+
+        renderer.setCaptureEnabled(false);
+        rendererContext.destroy();
+    }
 }
@@ -37,7 +37,13 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 class DummyFileResource final : public e2d::Resource
 {
@@ -173,4 +179,173 @@ TEST_CASE_METHOD(ResourceRegistryTest, "ResourceRegistry Tests", "[ResourceRegis
 
         REQUIRE_FALSE(resource == nullptr);
     }
+
+    SECTION("Generic resources are loaded and retrieved concurrently")
+    {
+        const int threadCount = 8;
+
+        std::atomic<int>         loaded{0};
+        std::atomic<int>         mismatches{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [&resourceRegistry, &loaded, &mismatches, i]()
+                {
+                    const auto identifier = "MyConcurrentDummyFileResource" + std::to_string(i % 2);
+                    if (resourceRegistry.loadFromFile<DummyFileResource>(identifier, "/some/path/to/resource.ext"))
+                    {
+                        ++loaded;
+                    }
+                    for (int j = 0; j < 100; ++j)
+                    {
+                        if (resourceRegistry.exists<DummyFileResource>(identifier) &&
+                            resourceRegistry.get<DummyFileResource>(identifier)->mTest != 123)
+                        {
+                            ++mismatches;
+                        }
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(loaded == 2);
+        REQUIRE(mismatches == 0);
+        REQUIRE(resourceRegistry.exists<DummyFileResource>("MyConcurrentDummyFileResource0"));
+        REQUIRE(resourceRegistry.exists<DummyFileResource>("MyConcurrentDummyFileResource1"));
+    }
+
+    SECTION("A texture resource cannot be loaded outside of the render thread")
+    {
+        bool loaded = true;
+        std::thread([&resourceRegistry, &loaded]()
+                    { loaded = resourceRegistry.loadFromFile<e2d::Texture>("HelloWorld4", "resources/hello-world.png"); })
+            .join();
+
+        REQUIRE_FALSE(loaded);
+        REQUIRE_FALSE(resourceRegistry.exists<e2d::Texture>("HelloWorld4"));
+    }
+
+    SECTION("A texture resource is decoded once and then loaded from the texture cache")
+    {
+        const auto cacheDirectory = std::filesystem::temp_directory_path() / "e2d-texture-cache-test";
+        std::filesystem::remove_all(cacheDirectory);
+
+        REQUIRE(resourceRegistry.enableTextureCache(cacheDirectory.string()));
+        REQUIRE(resourceRegistry.isTextureCacheEnabled());
+        resourceRegistry.resetTextureCacheStats();
+
+        REQUIRE(resourceRegistry.loadFromFile<e2d::Texture>("HelloWorld5", "resources/hello-world.png"));
+        REQUIRE(resourceRegistry.getTextureCacheStats().hits == 0);
+        REQUIRE(resourceRegistry.getTextureCacheStats().misses == 1);
+
+        REQUIRE(resourceRegistry.loadFromFile<e2d::Texture>("HelloWorld6", "resources/hello-world.png"));
+        REQUIRE(resourceRegistry.getTextureCacheStats().hits == 1);
+        REQUIRE(resourceRegistry.getTextureCacheStats().misses == 1);
+
+        auto cachedTexture = resourceRegistry.get<e2d::Texture>("HelloWorld6");
+        REQUIRE(cachedTexture->isLoaded() == true);
+        REQUIRE(cachedTexture->getSize() == e2d::Vector2i{320, 240});
+
+        resourceRegistry.disableTextureCache();
+        REQUIRE_FALSE(resourceRegistry.isTextureCacheEnabled());
+
+        // A disabled cache still decodes the file, but writes no entry
+        std::filesystem::remove_all(cacheDirectory);
+        std::filesystem::create_directories(cacheDirectory);
+        REQUIRE(resourceRegistry.loadFromFile<e2d::Texture>("HelloWorld11", "resources/hello-world.png"));
+        REQUIRE(std::filesystem::is_empty(cacheDirectory));
+        std::filesystem::remove_all(cacheDirectory);
+    }
+
+    SECTION("Resources listed in a manifest are loaded as one batch")
+    {
+        const std::string manifest = "# Resources of the test\n"
+                                     "texture HelloWorld8 resources/hello-world.png\n"
+                                     "\n"
+                                     "font    OpenSans4   resources/OpenSans.ttf\n"
+                                     "texture HelloWorld8 resources/hello-world.png\n";
+
+        std::vector<std::pair<std::size_t, std::size_t>> progress;
+        REQUIRE(resourceRegistry.loadManifestFromMemory(manifest.data(),
+                                                        manifest.size(),
+                                                        [&progress](std::size_t loaded, std::size_t total)
+                                                        { progress.emplace_back(loaded, total); }));
+
+        REQUIRE(progress.size() == 2);
+        REQUIRE(progress.front() == std::make_pair(std::size_t{1}, std::size_t{2}));
+        REQUIRE(progress.back() == std::make_pair(std::size_t{2}, std::size_t{2}));
+
+        REQUIRE(resourceRegistry.exists<e2d::Texture>("HelloWorld8"));
+        REQUIRE(resourceRegistry.get<e2d::Texture>("HelloWorld8")->getSize() == e2d::Vector2i{320, 240});
+        REQUIRE(resourceRegistry.exists<e2d::Font>("OpenSans4"));
+
+        // Loading the same manifest again skips everything that is already loaded
+        progress.clear();
+        REQUIRE(resourceRegistry.loadManifestFromMemory(manifest.data(),
+                                                        manifest.size(),
+                                                        [&progress](std::size_t loaded, std::size_t total)
+                                                        { progress.emplace_back(loaded, total); }));
+        REQUIRE(progress.empty());
+    }
+
+    SECTION("A manifest with invalid entries is not loaded")
+    {
+        const std::string unknownType = "texture HelloWorld9 resources/hello-world.png\n"
+                                        "sound   Sound1      resources/sound.wav\n";
+        REQUIRE_FALSE(resourceRegistry.loadManifestFromMemory(unknownType.data(), unknownType.size()));
+        REQUIRE_FALSE(resourceRegistry.exists<e2d::Texture>("HelloWorld9"));
+
+        const std::string conflictingIdentifier = "texture HelloWorld9 resources/hello-world.png\n"
+                                                  "font    HelloWorld9 resources/OpenSans.ttf\n";
+        REQUIRE_FALSE(
+            resourceRegistry.loadManifestFromMemory(conflictingIdentifier.data(), conflictingIdentifier.size()));
+        REQUIRE_FALSE(resourceRegistry.exists<e2d::Texture>("HelloWorld9"));
+
+        const std::string missingFile = "texture HelloWorld10 resources/missing.png\n";
+        REQUIRE_FALSE(resourceRegistry.loadManifestFromMemory(missingFile.data(), missingFile.size()));
+        REQUIRE_FALSE(resourceRegistry.exists<e2d::Texture>("HelloWorld10"));
+    }
+
+    SECTION("A texture resource is reloaded in place when its file changes")
+    {
+        const auto texturePath = std::filesystem::temp_directory_path() / "e2d-hot-reload-test.png";
+        std::filesystem::copy_file("resources/hello-world.png",
+                                   texturePath,
+                                   std::filesystem::copy_options::overwrite_existing);
+
+        REQUIRE(resourceRegistry.loadFromFile<e2d::Texture>("HelloWorld7", texturePath.string()));
+        auto texture       = resourceRegistry.get<e2d::Texture>("HelloWorld7");
+        auto nativeTexture = texture->getNativeTextureHandle();
+
+        REQUIRE(resourceRegistry.enableHotReload());
+        REQUIRE(resourceRegistry.isHotReloadEnabled());
+        REQUIRE(resourceRegistry.applyPendingReloads() == 0);
+
+        std::filesystem::copy_file("resources/hello-world.png",
+                                   texturePath,
+                                   std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::last_write_time(texturePath,
+                                         std::filesystem::last_write_time(texturePath) + std::chrono::seconds(1));
+
+        std::size_t reloaded = 0;
+        for (int attempt = 0; attempt < 500 && reloaded == 0; ++attempt)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            reloaded = resourceRegistry.applyPendingReloads();
+        }
+
+        REQUIRE(reloaded == 1);
+        REQUIRE(resourceRegistry.get<e2d::Texture>("HelloWorld7") == texture);
+        REQUIRE(texture->isLoaded() == true);
+        REQUIRE(texture->getSize() == e2d::Vector2i{320, 240});
+        REQUIRE_FALSE(texture->getNativeTextureHandle() == nativeTexture);
+
+        resourceRegistry.disableHotReload();
+        REQUIRE_FALSE(resourceRegistry.isHotReloadEnabled());
+        std::filesystem::remove(texturePath);
+    }
 }
@@ -28,6 +28,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <vector>
+
 TEST_CASE("toSDLRect", "[SDLRenderUtils]")
 {
     SECTION("Converts positive rectangle correctly")
@@ -141,3 +143,22 @@ TEST_CASE("toSDLRendererFlip", "[SDLRenderUtils]")
         REQUIRE(flip == (SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL));
     }
 }
+
+TEST_CASE("extendSDLQuadIndices", "[SDLRenderUtils]")
+{
+    std::vector<int> indices;
+
+    SECTION("Each quad is drawn as two triangles")
+    {
+        e2d::internal::extendSDLQuadIndices(indices, 2);
+        REQUIRE(indices == std::vector<int>{0, 1, 2, 2, 3, 0, 4, 5, 6, 6, 7, 4});
+    }
+
+    SECTION("Indices are only ever extended")
+    {
+        e2d::internal::extendSDLQuadIndices(indices, 3);
+        e2d::internal::extendSDLQuadIndices(indices, 1);
+        REQUIRE(indices.size() == 18);
+        REQUIRE(indices[12] == 8);
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * @file ShapeRenderer.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/DebugDraw.hpp>
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/ShapeRenderer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+TEST_CASE("ShapeRenderer Rendering", "[ShapeRenderer]")
+{
+    auto& rendererContext = e2d::internal::RendererContext::getInstance();
+    REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+    auto& renderer = rendererContext.getRenderer();
+    renderer.setCaptureEnabled(true);
+
+    const auto& drawCalls = e2d::Metrics::getCounter("renderer.draw_calls");
+
+    e2d::ShapeRenderer shapes;
+
+    SECTION("All shapes are drawn with one draw call")
+    {
+        shapes.setLineThickness(2);
+        shapes.fillRect({{10, 10}, {20, 20}}, e2d::Color::Green);
+        shapes.drawRect({{50, 10}, {20, 20}}, e2d::Color::Blue);
+        shapes.fillCircle({100, 20}, 10, e2d::Color::Green);
+        shapes.drawCircle({150, 20}, 10, e2d::Color::Blue);
+        shapes.fillPolygon({{200, 10}, {220, 10}, {220, 30}}, e2d::Color::Green);
+        shapes.drawLine({0, 50}, {100, 50}, e2d::Color::Blue);
+        REQUIRE_FALSE(shapes.isEmpty());
+
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&shapes);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls + 1);
+
+        const auto& frame = renderer.getCapturedFrame();
+        REQUIRE(frame.getPixel(20, 20) == e2d::Color::Green);
+        REQUIRE(frame.getPixel(50, 20) == e2d::Color::Blue);
+        REQUIRE(frame.getPixel(60, 20) == e2d::Color::Red);
+        REQUIRE(frame.getPixel(100, 20) == e2d::Color::Green);
+        REQUIRE(frame.getPixel(160, 20) == e2d::Color::Blue);
+        REQUIRE(frame.getPixel(150, 20) == e2d::Color::Red);
+        REQUIRE(frame.getPixel(218, 25) == e2d::Color::Green);
+        REQUIRE(frame.getPixel(202, 25) == e2d::Color::Red);
+        REQUIRE(frame.getPixel(50, 50) == e2d::Color::Blue);
+    }
+
+    SECTION("Shapes are discarded once rendered")
+    {
+        shapes.fillRect({{10, 10}, {20, 20}}, e2d::Color::Green);
+        renderer.draw(&shapes);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(shapes.isEmpty());
+
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&shapes);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls);
+        REQUIRE(renderer.getCapturedFrame().getPixel(20, 20) == e2d::Color::Red);
+    }
+
+    renderer.setCaptureEnabled(false);
+    rendererContext.destroy();
+}
+
+TEST_CASE("DebugDraw", "[ShapeRenderer]")
+{
+    e2d::DebugDraw debugDraw;
+    REQUIRE(debugDraw.getRenderPriority() == std::numeric_limits<int>::max());
+
+    debugDraw.fillRect({{10, 10}, {20, 20}}, e2d::Color::Green);
+    debugDraw.drawCircle({100, 20}, 10, e2d::Color::Blue);
+    if constexpr (E2D_DEBUG_DRAW)
+    {
+        REQUIRE_FALSE(debugDraw.isEmpty());
+    }
+    else
+    {
+        REQUIRE(debugDraw.isEmpty());
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file SkylinePacker.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/SkylinePacker.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+namespace
+{
+bool overlaps(const e2d::IntRect& lhs, const e2d::IntRect& rhs)
+{
+    return lhs.left < rhs.left + rhs.width && rhs.left < lhs.left + lhs.width && lhs.top < rhs.top + rhs.height &&
+           rhs.top < lhs.top + lhs.height;
+}
+} // namespace
+
+TEST_CASE("SkylinePacker Tests", "[SkylinePacker]")
+{
+    e2d::internal::SkylinePacker packer({64, 64});
+
+    SECTION("The first rectangle is placed in the top left corner")
+    {
+        const auto rectangle = packer.insert({16, 8});
+        REQUIRE(rectangle.has_value());
+        REQUIRE(rectangle->left == 0);
+        REQUIRE(rectangle->top == 0);
+        REQUIRE(rectangle->width == 16);
+        REQUIRE(rectangle->height == 8);
+        REQUIRE(packer.getUsedSize() == e2d::Vector2i{16, 8});
+    }
+
+    SECTION("Rectangles are placed next to each other before stacking")
+    {
+        const auto first  = packer.insert({32, 16});
+        const auto second = packer.insert({32, 16});
+        const auto third  = packer.insert({32, 16});
+        REQUIRE(first.has_value());
+        REQUIRE(second.has_value());
+        REQUIRE(third.has_value());
+        REQUIRE(second->left == 32);
+        REQUIRE(second->top == 0);
+        REQUIRE(third->left == 0);
+        REQUIRE(third->top == 16);
+        REQUIRE(packer.getUsedSize() == e2d::Vector2i{64, 32});
+    }
+
+    SECTION("Rectangles fill the lowest gap in the skyline")
+    {
+        REQUIRE(packer.insert({16, 32}).has_value());
+        REQUIRE(packer.insert({16, 8}).has_value());
+        const auto rectangle = packer.insert({16, 8});
+        REQUIRE(rectangle.has_value());
+        REQUIRE(rectangle->left == 32);
+        REQUIRE(rectangle->top == 0);
+    }
+
+    SECTION("Rectangles that do not fit are rejected")
+    {
+        REQUIRE_FALSE(packer.insert({65, 1}).has_value());
+        REQUIRE_FALSE(packer.insert({1, 65}).has_value());
+        REQUIRE_FALSE(packer.insert({0, 0}).has_value());
+        REQUIRE(packer.insert({64, 64}).has_value());
+        REQUIRE_FALSE(packer.insert({1, 1}).has_value());
+    }
+
+    SECTION("Inserted rectangles never overlap and stay within the bin")
+    {
+        std::vector<e2d::IntRect> rectangles;
+        for (int index = 0; index < 200; ++index)
+        {
+            const auto rectangle = packer.insert({1 + (index * 7) % 13, 1 + (index * 5) % 11});
+            if (rectangle)
+            {
+                rectangles.push_back(*rectangle);
+            }
+        }
+
+        REQUIRE(rectangles.size() > 20);
+        for (std::size_t lhs = 0; lhs < rectangles.size(); ++lhs)
+        {
+            REQUIRE(rectangles[lhs].left >= 0);
+            REQUIRE(rectangles[lhs].top >= 0);
+            REQUIRE(rectangles[lhs].left + rectangles[lhs].width <= 64);
+            REQUIRE(rectangles[lhs].top + rectangles[lhs].height <= 64);
+            for (std::size_t rhs = lhs + 1; rhs < rectangles.size(); ++rhs)
+            {
+                REQUIRE_FALSE(overlaps(rectangles[lhs], rectangles[rhs]));
+            }
+        }
+    }
+
+    SECTION("Clearing the packer makes the full bin available again")
+    {
+        REQUIRE(packer.insert({64, 64}).has_value());
+        packer.clear();
+        REQUIRE(packer.getUsedSize() == e2d::Vector2i{0, 0});
+        REQUIRE(packer.insert({64, 64}).has_value());
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @file SpriteBatch.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/SpriteBatch.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+namespace
+{
+e2d::SpriteInstance makeInstance(const e2d::Vector2f& position)
+{
+    e2d::SpriteInstance instance;
+    instance.position    = position;
+    instance.textureRect = {{0, 0}, {10, 10}};
+    return instance;
+}
+} // namespace
+
+TEST_CASE("SpriteBatch Instances", "[SpriteBatch]")
+{
+    e2d::SpriteBatch batch;
+
+    SECTION("Instances are addressed by their index")
+    {
+        REQUIRE(batch.add(makeInstance({1, 0})) == 0);
+        REQUIRE(batch.add(makeInstance({2, 0})) == 1);
+        REQUIRE(batch.add(makeInstance({3, 0})) == 2);
+        REQUIRE(batch.getCount() == 3);
+
+        auto instance       = batch.getInstance(1);
+        instance.position.y = 5;
+        batch.setInstance(1, instance);
+        REQUIRE(batch.getInstances()[1].position == e2d::Vector2f(2, 5));
+    }
+
+    SECTION("The last instance takes the place of a removed one")
+    {
+        batch.add(makeInstance({1, 0}));
+        batch.add(makeInstance({2, 0}));
+        batch.add(makeInstance({3, 0}));
+
+        batch.remove(0);
+        REQUIRE(batch.getCount() == 2);
+        REQUIRE(batch.getInstance(0).position.x == 3);
+        REQUIRE(batch.getInstance(1).position.x == 2);
+
+        batch.remove(1);
+        REQUIRE(batch.getCount() == 1);
+
+        batch.clear();
+        REQUIRE(batch.getCount() == 0);
+    }
+
+    SECTION("Missing instances are rejected")
+    {
+        REQUIRE_THROWS_AS(batch.getInstance(0), std::runtime_error);
+        REQUIRE_THROWS_AS(batch.setInstance(0, makeInstance({0, 0})), std::runtime_error);
+        REQUIRE_THROWS_AS(batch.remove(0), std::runtime_error);
+    }
+}
+
+TEST_CASE("SpriteBatch Rendering", "[SpriteBatch]")
+{
+    auto& rendererContext = e2d::internal::RendererContext::getInstance();
+    REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+    auto& renderer = rendererContext.getRenderer();
+    renderer.setCaptureEnabled(true);
+
+    e2d::RenderTexture square;
+    REQUIRE(square.create({10, 10}));
+    REQUIRE(square.clear(e2d::Color::Green));
+
+    e2d::SpriteBatch batch;
+    batch.setTexture(square.getTexture());
+
+    const auto& drawCalls = e2d::Metrics::getCounter("renderer.draw_calls");
+
+    SECTION("All instances are drawn with one draw call")
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            batch.add(makeInstance({static_cast<float>(i % 50) * 16, static_cast<float>(i / 50) * 16}));
+        }
+
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&batch);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls + 1);
+        REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Green);
+        REQUIRE(renderer.getCapturedFrame().getPixel(13, 5) == e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(789, 309) == e2d::Color::Green);
+    }
+
+    SECTION("Instances are transformed like sprites")
+    {
+        auto instance     = makeInstance({100, 100});
+        instance.origin   = {5, 5};
+        instance.scale    = {4, 1};
+        instance.rotation = 90;
+        batch.add(instance);
+
+        renderer.draw(&batch);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(100, 115) == e2d::Color::Green);
+        REQUIRE(renderer.getCapturedFrame().getPixel(115, 100) == e2d::Color::Red);
+    }
+
+    SECTION("Instances outside the screen are not drawn")
+    {
+        batch.add(makeInstance({-20, 100}));
+        batch.add(makeInstance({900, 100}));
+
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&batch);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(drawCalls.getValue() == calls);
+    }
+
+    SECTION("Instances are culled against the render texture drawn into")
+    {
+        batch.add(makeInstance({900, 5}));
+
+        e2d::RenderTexture wide;
+        REQUIRE(wide.create({1000, 20}));
+        auto calls = drawCalls.getValue();
+        REQUIRE(wide.draw(batch));
+        REQUIRE(drawCalls.getValue() == calls + 1);
+
+        e2d::RenderTexture small;
+        REQUIRE(small.create({20, 20}));
+        calls = drawCalls.getValue();
+        REQUIRE(small.draw(batch));
+        REQUIRE(drawCalls.getValue() == calls);
+    }
+
+    renderer.setCaptureEnabled(false);
+    batch.setTexture(nullptr);
+    square.destroy();
+    rendererContext.destroy();
+}
@@ -0,0 +1,154 @@
+/**
+ * @file TextureAtlas.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Engine/CoreSystem.hpp>
+#include <E2D/Engine/GraphicsSystem.hpp>
+#include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/SystemManager.hpp>
+#include <E2D/Engine/Texture.hpp>
+#include <E2D/Engine/TextureAtlas.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <string>
+
+class TextureAtlasTest
+{
+public:
+    TextureAtlasTest()
+    {
+        // Setup (runs before each SECTION)
+        e2d::SystemManager::getInstance().initialize<e2d::CoreSystem>();
+        e2d::SystemManager::getInstance().initialize<e2d::GraphicsSystem>();
+    }
+
+    ~TextureAtlasTest()
+    {
+        e2d::SystemManager::getInstance().shutdown();
+    }
+};
+
+TEST_CASE_METHOD(TextureAtlasTest, "TextureAtlas Tests", "[TextureAtlas]")
+{
+    e2d::TextureAtlas atlas;
+
+    SECTION("An atlas is not loaded initially")
+    {
+        REQUIRE_FALSE(atlas.isLoaded());
+        REQUIRE(atlas.getPageCount() == 0);
+        REQUIRE(atlas.getPage(0) == nullptr);
+        REQUIRE_FALSE(atlas.hasRegion("HelloWorld"));
+        REQUIRE_THROWS(atlas.getRegion("HelloWorld"));
+    }
+
+    SECTION("Images with invalid or duplicate names are rejected")
+    {
+        REQUIRE_FALSE(atlas.add("", "resources/hello-world.png"));
+        REQUIRE_FALSE(atlas.add("Hello World", "resources/hello-world.png"));
+        REQUIRE(atlas.add("HelloWorld", "resources/hello-world.png"));
+        REQUIRE_FALSE(atlas.add("HelloWorld", "resources/hello-world.png"));
+    }
+
+    SECTION("Images are packed onto a single page")
+    {
+        REQUIRE(atlas.add("HelloWorld1", "resources/hello-world.png"));
+        REQUIRE(atlas.add("HelloWorld2", "resources/hello-world.png"));
+        REQUIRE(atlas.pack());
+
+        REQUIRE(atlas.isLoaded());
+        REQUIRE(atlas.getPageCount() == 1);
+
+        const auto& first  = atlas.getRegion("HelloWorld1");
+        const auto& second = atlas.getRegion("HelloWorld2");
+        REQUIRE(first.texture == atlas.getPage(0));
+        REQUIRE(second.texture == atlas.getPage(0));
+        REQUIRE(first.rect.getSize() == e2d::Vector2i{320, 240});
+        REQUIRE(second.rect.getSize() == e2d::Vector2i{320, 240});
+        REQUIRE_FALSE(first.rect.getPosition() == second.rect.getPosition());
+    }
+
+    SECTION("Images that do not fit on one page are spread over several pages")
+    {
+        atlas.setMaxPageSize({400, 400});
+        REQUIRE(atlas.add("HelloWorld1", "resources/hello-world.png"));
+        REQUIRE(atlas.add("HelloWorld2", "resources/hello-world.png"));
+        REQUIRE(atlas.pack());
+
+        REQUIRE(atlas.getPageCount() == 2);
+        REQUIRE_FALSE(atlas.getRegion("HelloWorld1").texture == atlas.getRegion("HelloWorld2").texture);
+    }
+
+    SECTION("Images larger than a page cannot be packed")
+    {
+        atlas.setMaxPageSize({256, 256});
+        REQUIRE(atlas.add("HelloWorld", "resources/hello-world.png"));
+        REQUIRE_FALSE(atlas.pack());
+        REQUIRE_FALSE(atlas.isLoaded());
+    }
+
+    SECTION("A saved layout is loaded without packing again")
+    {
+        const auto layout = (std::filesystem::temp_directory_path() / "e2d-texture-atlas-test.layout").string();
+
+        REQUIRE(atlas.add("HelloWorld1", "resources/hello-world.png"));
+        REQUIRE(atlas.add("HelloWorld2", "resources/hello-world.png"));
+        REQUIRE(atlas.pack());
+        REQUIRE(atlas.saveLayout(layout));
+
+        e2d::TextureAtlas loadedAtlas;
+        REQUIRE(loadedAtlas.loadFromFile(layout));
+        REQUIRE(loadedAtlas.getPageCount() == atlas.getPageCount());
+        REQUIRE(loadedAtlas.getPage(0)->getSize() == atlas.getPage(0)->getSize());
+        REQUIRE(loadedAtlas.getRegion("HelloWorld1").rect == atlas.getRegion("HelloWorld1").rect);
+        REQUIRE(loadedAtlas.getRegion("HelloWorld2").rect == atlas.getRegion("HelloWorld2").rect);
+
+        std::filesystem::remove(layout);
+    }
+
+    SECTION("A malformed layout is not loaded")
+    {
+        const std::string layout = "atlas 1\npage 0 64 64\nregion HelloWorld 0 0 0 320 240 resources/hello-world.png\n";
+        REQUIRE_FALSE(atlas.loadFromMemory(layout.data(), layout.size()));
+        REQUIRE_FALSE(atlas.isLoaded());
+    }
+
+    SECTION("A sprite renders from a region as if it was a texture of its own")
+    {
+        REQUIRE(atlas.add("HelloWorld1", "resources/hello-world.png"));
+        REQUIRE(atlas.add("HelloWorld2", "resources/hello-world.png"));
+        REQUIRE(atlas.pack());
+
+        e2d::Sprite sprite;
+        sprite.setTexture(atlas.getRegion("HelloWorld2"));
+        REQUIRE(sprite.getTexture() == atlas.getPage(0));
+        REQUIRE(sprite.getTextureRect() == e2d::IntRect({0, 0}, {320, 240}));
+        REQUIRE(sprite.getSize() == e2d::Vector2f{320.f, 240.f});
+
+        sprite.setTextureRect(e2d::IntRect({10, 20}, {30, 40}));
+        REQUIRE(sprite.getTextureRect() == e2d::IntRect({10, 20}, {30, 40}));
+    }
+}
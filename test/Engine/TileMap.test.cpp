@@ -0,0 +1,182 @@
+/**
+ * @file TileMap.test.cpp
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Emil Hörnlund
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <E2D/Core/Metrics.hpp>
+
+#include <E2D/Engine/FrameCapture.hpp>
+#include <E2D/Engine/Renderer.hpp>
+#include <E2D/Engine/RendererContext.hpp>
+#include <E2D/Engine/RenderTexture.hpp>
+#include <E2D/Engine/Sprite.hpp>
+#include <E2D/Engine/TileMap.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("TileMap Tiles", "[TileMap]")
+{
+    e2d::TileMap tileMap;
+
+    SECTION("A tile map is empty initially")
+    {
+        REQUIRE(tileMap.getMapSize() == e2d::Vector2i(0, 0));
+        REQUIRE(tileMap.getLayerCount() == 0);
+        REQUIRE(tileMap.getTileset() == nullptr);
+        REQUIRE_FALSE(tileMap.create({0, 10}));
+        REQUIRE_FALSE(tileMap.create({10, 10}, 0));
+    }
+
+    SECTION("Tiles are stored per layer")
+    {
+        REQUIRE(tileMap.create({40, 20}, 2));
+        REQUIRE(tileMap.getMapSize() == e2d::Vector2i(40, 20));
+        REQUIRE(tileMap.getLayerCount() == 2);
+        REQUIRE(tileMap.getTile(0, {39, 19}) == e2d::TileMap::EmptyTile);
+
+        tileMap.setTile(1, {39, 19}, 7);
+        REQUIRE(tileMap.getTile(1, {39, 19}) == 7);
+        REQUIRE(tileMap.getTile(0, {39, 19}) == e2d::TileMap::EmptyTile);
+
+        tileMap.setTiles(0, std::vector<std::uint16_t>(40 * 20, 3));
+        REQUIRE(tileMap.getTile(0, {12, 5}) == 3);
+        REQUIRE(tileMap.getTile(1, {12, 5}) == e2d::TileMap::EmptyTile);
+    }
+
+    SECTION("Cells outside the map are rejected")
+    {
+        REQUIRE(tileMap.create({40, 20}));
+        REQUIRE_THROWS_AS(tileMap.setTile(0, {40, 0}, 1), std::runtime_error);
+        REQUIRE_THROWS_AS(tileMap.getTile(0, {0, -1}), std::runtime_error);
+        REQUIRE_THROWS_AS(tileMap.getTile(1, {0, 0}), std::runtime_error);
+        REQUIRE_THROWS_AS(tileMap.setTiles(0, std::vector<std::uint16_t>(10, 1)), std::runtime_error);
+    }
+
+    SECTION("The size of a tile map is measured in pixels")
+    {
+        REQUIRE(tileMap.create({40, 20}));
+        tileMap.setTileset(nullptr, {16, 8});
+        REQUIRE(tileMap.getSize() == e2d::Vector2f(640, 160));
+    }
+}
+
+TEST_CASE("TileMap Rendering", "[TileMap]")
+{
+    auto& rendererContext = e2d::internal::RendererContext::getInstance();
+    REQUIRE(rendererContext.initialize(e2d::RenderMode::Headless));
+
+    auto& renderer = rendererContext.getRenderer();
+    renderer.setCaptureEnabled(true);
+
+    // A tileset of two tiles, green and blue
+    e2d::RenderTexture square;
+    REQUIRE(square.create({10, 10}));
+    REQUIRE(square.clear(e2d::Color::Green));
+
+    e2d::Sprite sprite;
+    sprite.setTexture(square.getTexture());
+    sprite.setTextureRect({{0, 0}, {10, 10}});
+
+    e2d::RenderTexture tileset;
+    REQUIRE(tileset.create({20, 10}));
+    REQUIRE(tileset.clear(e2d::Color::Blue));
+    REQUIRE(tileset.draw(sprite));
+
+    // 1000x1000 pixels in chunks of 160x160, of which 5x4 cover the 800x600 screen
+    e2d::TileMap tileMap;
+    tileMap.setTileset(tileset.getTexture(), {10, 10});
+    REQUIRE(tileMap.create({100, 100}, 2));
+    tileMap.setTiles(0, std::vector<std::uint16_t>(100 * 100, 1));
+
+    const auto& bakes     = e2d::Metrics::getCounter("renderer.chunk_bakes");
+    const auto& drawCalls = e2d::Metrics::getCounter("renderer.draw_calls");
+    const auto  first     = bakes.getValue();
+
+    renderer.draw(&tileMap);
+    renderer.render(e2d::Color::Red);
+    REQUIRE(bakes.getValue() == first + 20);
+    REQUIRE(renderer.getCapturedFrame().getPixel(5, 5) == e2d::Color::Green);
+    REQUIRE(renderer.getCapturedFrame().getPixel(795, 595) == e2d::Color::Green);
+
+    SECTION("Visible chunks are drawn from their textures")
+    {
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&tileMap);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 20);
+        REQUIRE(drawCalls.getValue() == calls + 20);
+    }
+
+    SECTION("Only changed chunks are rendered again")
+    {
+        tileMap.setTile(1, {3, 3}, 2);
+        tileMap.setTile(1, {90, 90}, 2);
+        renderer.draw(&tileMap);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 21);
+        REQUIRE(renderer.getCapturedFrame().getPixel(35, 35) == e2d::Color::Blue);
+        REQUIRE(renderer.getCapturedFrame().getPixel(45, 35) == e2d::Color::Green);
+
+        tileMap.invalidate();
+        renderer.draw(&tileMap);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 41);
+    }
+
+    SECTION("Chunks off the screen are culled")
+    {
+        tileMap.setPosition({700, 500});
+        const auto calls = drawCalls.getValue();
+        renderer.draw(&tileMap);
+        renderer.render(e2d::Color::Red);
+        REQUIRE(bakes.getValue() == first + 20);
+        REQUIRE(drawCalls.getValue() == calls + 1);
+        REQUIRE(renderer.getCapturedFrame().getPixel(695, 495) == e2d::Color::Red);
+        REQUIRE(renderer.getCapturedFrame().getPixel(705, 505) == e2d::Color::Green);
+    }
+
+    SECTION("Chunks are culled against the render texture drawn into")
+    {
+        e2d::RenderTexture small;
+        REQUIRE(small.create({100, 100}));
+        const auto calls = drawCalls.getValue();
+        REQUIRE(small.draw(tileMap));
+        REQUIRE(drawCalls.getValue() == calls + 1);
+
+        e2d::RenderTexture large;
+        REQUIRE(large.create({1000, 1000}));
+        REQUIRE(large.draw(tileMap));
+        REQUIRE(bakes.getValue() == first + 49);
+    }
+
+    renderer.setCaptureEnabled(false);
+    tileMap.setTileset(nullptr, {10, 10});
+    tileset.destroy();
+    square.destroy();
+    rendererContext.destroy();
+}